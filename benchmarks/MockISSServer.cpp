@@ -0,0 +1,146 @@
+// Minimal local HTTP stand-in for the ISS position API (POSIX only)
+#include "MockISSServer.h"
+
+#ifndef _WIN32
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <vector>
+
+namespace MetaImGUI {
+
+namespace {
+constexpr int POLL_TIMEOUT_MS = 100;
+
+bool SendAll(int fd, const std::string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        const ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) {
+            return false;
+        }
+        sent += static_cast<size_t>(n);
+    }
+    return true;
+}
+} // namespace
+
+MockISSServer::~MockISSServer() {
+    Stop();
+}
+
+bool MockISSServer::Start() {
+    m_listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (m_listenFd < 0) {
+        return false;
+    }
+
+    const int reuse = 1;
+    setsockopt(m_listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0; // Ephemeral
+
+    socklen_t length = sizeof(address);
+    if (bind(m_listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(m_listenFd, SOMAXCONN) != 0 ||
+        getsockname(m_listenFd, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+        close(m_listenFd);
+        m_listenFd = -1;
+        return false;
+    }
+
+    m_port = ntohs(address.sin_port);
+    m_thread = std::jthread([this](const std::stop_token& stopToken) { ServeLoop(stopToken); });
+    return true;
+}
+
+void MockISSServer::Stop() {
+    if (m_thread.joinable()) {
+        m_thread.request_stop();
+        m_thread.join();
+    }
+    if (m_listenFd >= 0) {
+        close(m_listenFd);
+        m_listenFd = -1;
+    }
+}
+
+std::string MockISSServer::GetUrl() const {
+    return "http://127.0.0.1:" + std::to_string(m_port) + "/v1/satellites/25544";
+}
+
+void MockISSServer::ServeLoop(const std::stop_token& stopToken) {
+    std::vector<Connection> connections;
+    std::vector<pollfd> fds;
+
+    while (!stopToken.stop_requested()) {
+        fds.clear();
+        fds.push_back({m_listenFd, POLLIN, 0});
+        for (const auto& connection : connections) {
+            fds.push_back({connection.fd, POLLIN, 0});
+        }
+        if (poll(fds.data(), fds.size(), POLL_TIMEOUT_MS) <= 0) {
+            continue;
+        }
+
+        // Serve existing connections first; fds[i + 1] mirrors connections[i]
+        size_t kept = 0;
+        for (size_t i = 0; i < connections.size(); ++i) {
+            if ((fds[i + 1].revents & (POLLIN | POLLERR | POLLHUP)) != 0 && !ServeReadable(connections[i])) {
+                close(connections[i].fd);
+                continue;
+            }
+            connections[kept++] = std::move(connections[i]);
+        }
+        connections.resize(kept);
+
+        if ((fds[0].revents & POLLIN) != 0) {
+            const int fd = accept(m_listenFd, nullptr, nullptr);
+            if (fd >= 0) {
+                connections.push_back({fd, {}});
+            }
+        }
+    }
+
+    for (const auto& connection : connections) {
+        close(connection.fd);
+    }
+}
+
+bool MockISSServer::ServeReadable(Connection& connection) {
+    std::array<char, 4096> buffer{};
+    const ssize_t n = recv(connection.fd, buffer.data(), buffer.size(), 0);
+    if (n <= 0) {
+        return false; // Client closed the connection
+    }
+    connection.request.append(buffer.data(), static_cast<size_t>(n));
+
+    // Answer every complete request header; requests carry no body
+    size_t end = 0;
+    while ((end = connection.request.find("\r\n\r\n")) != std::string::npos) {
+        connection.request.erase(0, end + 4);
+
+        const std::string body = m_source.Fetch();
+        const std::string response = "HTTP/1.1 200 OK\r\n"
+                                     "Content-Type: application/json\r\n"
+                                     "Content-Length: " +
+                                     std::to_string(body.size()) + "\r\n\r\n" + body;
+        if (!SendAll(connection.fd, response)) {
+            return false;
+        }
+        ++m_requests;
+    }
+    return true;
+}
+
+} // namespace MetaImGUI
+
+#endif // _WIN32
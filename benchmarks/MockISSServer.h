@@ -0,0 +1,64 @@
+// Minimal local HTTP stand-in for the ISS position API (POSIX only)
+#pragma once
+
+#ifndef _WIN32
+
+#include "ISSDataSource.h"
+
+#include <atomic>
+#include <cstdint>
+#include <stop_token>
+#include <string>
+#include <thread>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Serves synthetic ISS positions over HTTP/1.1 on 127.0.0.1
+ *
+ * Binds an ephemeral port and answers every request with a SyntheticDataSource
+ * response, honouring keep-alive. Connections are multiplexed with poll() on one
+ * thread, so concurrent clients are served without blocking each other.
+ */
+class MockISSServer {
+public:
+    MockISSServer() = default;
+    ~MockISSServer();
+
+    MockISSServer(const MockISSServer&) = delete;
+    MockISSServer& operator=(const MockISSServer&) = delete;
+    MockISSServer(MockISSServer&&) = delete;
+    MockISSServer& operator=(MockISSServer&&) = delete;
+
+    /**
+     * @brief Bind and start serving on a background thread
+     * @return true if the socket could be bound
+     */
+    bool Start();
+    void Stop();
+
+    [[nodiscard]] std::string GetUrl() const;
+    [[nodiscard]] size_t GetRequestCount() const {
+        return m_requests;
+    }
+
+private:
+    void ServeLoop(const std::stop_token& stopToken);
+    struct Connection {
+        int fd;
+        std::string request;
+    };
+
+    // Answers every complete request read from the connection; false once it should be closed
+    bool ServeReadable(Connection& connection);
+
+    int m_listenFd = -1;
+    uint16_t m_port = 0;
+    std::atomic<size_t> m_requests{0};
+    SyntheticDataSource m_source{1000.0};
+    std::jthread m_thread;
+};
+
+} // namespace MetaImGUI
+
+#endif // _WIN32
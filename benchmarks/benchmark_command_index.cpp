@@ -0,0 +1,49 @@
+// Command palette search benchmarks over generated command labels
+#include "CommandIndex.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace MetaImGUI;
+
+namespace {
+constexpr size_t COMMAND_COUNT = 10000;
+
+std::vector<std::string> GenerateLabels() {
+    static constexpr const char* CATEGORIES[] = {"File", "View", "Theme", "Language", "Dialogs", "Help"};
+    std::vector<std::string> labels;
+    labels.reserve(COMMAND_COUNT);
+    for (size_t i = 0; i < COMMAND_COUNT; ++i) {
+        labels.push_back(std::string(CATEGORIES[i % 6]) + " Toggle Window Setting " + std::to_string(i));
+    }
+    return labels;
+}
+} // namespace
+
+// Building the index, as the palette does on a worker after a language change
+static void BM_CommandIndexBuild(benchmark::State& state) {
+    const std::vector<std::string> labels = GenerateLabels();
+    for (auto _ : state) {
+        const CommandIndex index(labels);
+        benchmark::DoNotOptimize(index.GetCount());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COMMAND_COUNT));
+}
+BENCHMARK(BM_CommandIndexBuild)->Unit(benchmark::kMicrosecond);
+
+// Typing "vws42" one key at a time: the first key prefilters the index, the others re-score the previous results
+static void BM_CommandSearchTypeAhead(benchmark::State& state) {
+    CommandSearch search;
+    search.SetIndex(std::make_shared<const CommandIndex>(GenerateLabels()));
+    for (auto _ : state) {
+        for (const char* query : {"v", "vw", "vws", "vws4", "vws42"}) {
+            search.SetQuery(query);
+        }
+        benchmark::DoNotOptimize(search.GetResults().size());
+        search.SetQuery("");
+    }
+}
+BENCHMARK(BM_CommandSearchTypeAhead)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,24 @@
+// Draw data fingerprinting benchmarks
+#include "FrameFingerprint.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace MetaImGUI;
+
+// range(0) bytes of vertex data; a busy ImGui frame is a few hundred KB
+static void BM_FingerprintFrame(benchmark::State& state) {
+    std::vector<uint8_t> vertices(static_cast<size_t>(state.range(0)));
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        vertices[i] = static_cast<uint8_t>(i * 2654435761u >> 24);
+    }
+    for (auto _ : state) {
+        FrameHasher hasher;
+        hasher.Add(vertices.data(), vertices.size());
+        benchmark::DoNotOptimize(hasher.Finish());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_FingerprintFrame)->Arg(16 << 10)->Arg(256 << 10)->Arg(1 << 20);
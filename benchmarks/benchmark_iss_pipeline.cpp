@@ -0,0 +1,114 @@
+// ISS tracker pipeline benchmarks: fetch -> parse -> publish -> render-side copy
+#include "HttpClient.h"
+#include "ISSDataSource.h"
+#include "ISSTracker.h"
+#include "Logger.h"
+#include "MockISSServer.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace MetaImGUI;
+
+namespace {
+// Roughly a 1000 px wide plot at two points per pixel
+constexpr size_t RENDER_POINT_BUDGET = 2000;
+constexpr int FIXES_PER_ITERATION = 1000;
+
+// Publish fixes from the tracker thread as fast as the source allows, then read the
+// decimated trail the way the UI does once per frame
+void RunTrackerPipeline(benchmark::State& state, const std::shared_ptr<ISSDataSource>& source) {
+    Logger::Instance().SetLevel(LogLevel::Warning);
+
+    std::atomic<int64_t> published{0}; // Outlives the tracker thread that increments it
+    ISSTracker tracker;
+    tracker.SetDataSource(source);
+    tracker.SetPollInterval(std::chrono::milliseconds(0));
+
+    tracker.StartTracking([&published](const ISSPosition&) { published.fetch_add(1, std::memory_order_relaxed); });
+
+    std::vector<double> latitudes, longitudes;
+    std::vector<size_t> segmentStarts;
+    for (auto _ : state) {
+        const int64_t target = published.load(std::memory_order_relaxed) + FIXES_PER_ITERATION;
+        while (published.load(std::memory_order_relaxed) < target) {
+            std::this_thread::yield();
+        }
+        tracker.GetPositionHistory(latitudes, longitudes, segmentStarts, RENDER_POINT_BUDGET);
+        benchmark::DoNotOptimize(latitudes.data());
+    }
+
+    tracker.StopTracking();
+    state.SetItemsProcessed(state.iterations() * FIXES_PER_ITERATION);
+}
+
+AsyncTask<void> FetchAndCount(HttpClient& client, HttpRequest request, std::atomic<int>& completed) {
+    const HttpResponse response = co_await client.Get(std::move(request));
+    benchmark::DoNotOptimize(response.body.data());
+    completed.fetch_add(1, std::memory_order_release);
+}
+} // namespace
+
+// Synthetic response generation and parsing only
+static void BM_SyntheticFetchParse(benchmark::State& state) {
+    Logger::Instance().SetLevel(LogLevel::Warning);
+    SyntheticDataSource source(1000.0);
+
+    for (auto _ : state) {
+        const ISSPosition position = ISSTracker::ParseJSON(source.Fetch());
+        benchmark::DoNotOptimize(position);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SyntheticFetchParse);
+
+// Full pipeline fed by the synthetic generator
+static void BM_TrackerPipelineSynthetic(benchmark::State& state) {
+    RunTrackerPipeline(state, std::make_shared<SyntheticDataSource>(1000.0));
+}
+BENCHMARK(BM_TrackerPipelineSynthetic)->UseRealTime();
+
+#ifndef _WIN32
+// Full pipeline over HTTP against the local mock server
+static void BM_TrackerPipelineMockHttp(benchmark::State& state) {
+    MockISSServer server;
+    if (!server.Start()) {
+        state.SkipWithError("Failed to start mock ISS server");
+        return;
+    }
+    RunTrackerPipeline(state, std::make_shared<HttpDataSource>(server.GetUrl()));
+}
+BENCHMARK(BM_TrackerPipelineMockHttp)->UseRealTime();
+
+// Batches of concurrent requests through the shared HTTP client; threads stay constant as the batch grows
+static void BM_HttpClientConcurrentFetch(benchmark::State& state) {
+    Logger::Instance().SetLevel(LogLevel::Warning);
+    MockISSServer server;
+    if (!server.Start()) {
+        state.SkipWithError("Failed to start mock ISS server");
+        return;
+    }
+
+    HttpClient client;
+    HttpRequest request;
+    request.url = server.GetUrl();
+    const auto batchSize = static_cast<int>(state.range(0));
+
+    std::atomic<int> completed{0};
+    for (auto _ : state) {
+        completed.store(0, std::memory_order_relaxed);
+        for (int i = 0; i < batchSize; ++i) {
+            FetchAndCount(client, request, completed).Start();
+        }
+        while (completed.load(std::memory_order_acquire) < batchSize) {
+            std::this_thread::yield();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batchSize);
+}
+BENCHMARK(BM_HttpClientConcurrentFetch)->Arg(1)->Arg(8)->Arg(64)->UseRealTime();
+#endif
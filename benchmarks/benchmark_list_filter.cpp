@@ -0,0 +1,61 @@
+// List dialog filter benchmarks over a million generated items
+#include "ListDataProvider.h"
+#include "ListFilter.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdio>
+
+using namespace MetaImGUI;
+
+namespace {
+constexpr size_t ITEM_COUNT = 1000000;
+
+class GeneratedProvider : public ListDataProvider {
+public:
+    [[nodiscard]] size_t GetCount() const override {
+        return ITEM_COUNT;
+    }
+
+    [[nodiscard]] const char* GetItem(size_t index) const override {
+        std::snprintf(m_buffer.data(), m_buffer.size(), "Catalogue entry %zu", index);
+        return m_buffer.data();
+    }
+
+private:
+    mutable std::array<char, 48> m_buffer{};
+};
+} // namespace
+
+// Folding every item into the index, as the dialog does in the background
+static void BM_ListFilterIndex(benchmark::State& state) {
+    const GeneratedProvider items;
+    for (auto _ : state) {
+        ListFilter filter(items);
+        while (!filter.Step(ITEM_COUNT)) {
+        }
+        benchmark::DoNotOptimize(filter.GetIndexedCount());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ITEM_COUNT));
+}
+BENCHMARK(BM_ListFilterIndex)->Unit(benchmark::kMillisecond);
+
+// Typing "entry 4", "entry 42", "entry 421" over an indexed list: the first query scans,
+// the later ones only re-test the previous matches
+static void BM_ListFilterTypeAhead(benchmark::State& state) {
+    const GeneratedProvider items;
+    ListFilter filter(items);
+    while (!filter.Step(ITEM_COUNT)) {
+    }
+    for (auto _ : state) {
+        for (const char* query : {"entry 4", "entry 42", "entry 421"}) {
+            filter.SetQuery(query);
+            while (!filter.Step(ITEM_COUNT)) {
+            }
+        }
+        benchmark::DoNotOptimize(filter.GetRowCount());
+        filter.SetQuery("");
+    }
+}
+BENCHMARK(BM_ListFilterTypeAhead)->Unit(benchmark::kMillisecond);
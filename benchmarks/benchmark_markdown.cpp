@@ -0,0 +1,70 @@
+// Release notes markdown parse and layout benchmarks
+#include "MarkdownDocument.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+using namespace MetaImGUI;
+
+namespace {
+// Release notes shaped like GitHub's generated ones
+std::string MakeReleaseNotes() {
+    std::string notes = "## What's Changed\n\n";
+    for (int i = 0; i < 60; ++i) {
+        notes += "* Fix **tracker** reconnect handling when the `poll_interval` changes by @contributor in "
+                 "https://github.com/owner/repo/pull/" +
+                 std::to_string(1000 + i) + "\n";
+    }
+    notes += "\n### Notes\n\nUpgrading is *recommended*. See [the changelog](https://example.com/changelog).\n\n"
+             "```\nsha256sum -c MetaImGUI.sha256\n```\n\n"
+             "**Full Changelog**: https://github.com/owner/repo/compare/v1.0.0...v1.1.0\n";
+    return notes;
+}
+
+// Proportional-ish stand-in for the font measurement
+MarkdownMetrics MakeMetrics() {
+    MarkdownMetrics metrics;
+    metrics.measure = [](const void*, std::string_view text, uint8_t style, float fontScale) {
+        float width = 0.0f;
+        for (const char c : text) {
+            width += (c == 'i' || c == 'l' || c == ' ') ? 4.0f : 7.0f;
+        }
+        return width * fontScale + (((style & MarkdownStyle::STRONG) != 0) ? 1.0f : 0.0f);
+    };
+    return metrics;
+}
+} // namespace
+
+static void BM_MarkdownParse(benchmark::State& state) {
+    const std::string notes = MakeReleaseNotes();
+    MarkdownDocument document;
+    for (auto _ : state) {
+        document.Parse(notes);
+        benchmark::DoNotOptimize(document.GetSpans().data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * notes.size()));
+}
+BENCHMARK(BM_MarkdownParse);
+
+// What a resize costs: the whole document is re-wrapped
+static void BM_MarkdownRelayout(benchmark::State& state) {
+    MarkdownDocument document(MakeReleaseNotes());
+    const MarkdownMetrics metrics = MakeMetrics();
+    float width = 400.0f;
+    for (auto _ : state) {
+        width = (width == 400.0f) ? 401.0f : 400.0f;
+        benchmark::DoNotOptimize(document.Layout(width, 1, metrics).height);
+    }
+}
+BENCHMARK(BM_MarkdownRelayout);
+
+// What a steady frame costs: the cached layout is returned
+static void BM_MarkdownCachedLayout(benchmark::State& state) {
+    MarkdownDocument document(MakeReleaseNotes());
+    const MarkdownMetrics metrics = MakeMetrics();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(document.Layout(400.0f, 1, metrics).height);
+    }
+}
+BENCHMARK(BM_MarkdownCachedLayout);
@@ -0,0 +1,41 @@
+// Version parsing and comparison benchmarks
+#include "SemVer.h"
+#include "UpdateChecker.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+using namespace MetaImGUI;
+
+namespace {
+const std::string CURRENT = "1.1.0";
+const std::string LATEST = "v1.2.0-rc.11+build.5114f85";
+} // namespace
+
+static void BM_SemVerParse(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(SemVer::Parse(LATEST));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SemVerParse);
+
+// Pre-parsed versions sharing a core version, the slowest comparison path
+static void BM_SemVerComparePreRelease(benchmark::State& state) {
+    const SemVer a = *SemVer::Parse("1.2.0-rc.2");
+    const SemVer b = *SemVer::Parse("1.2.0-rc.11");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a < b);
+    }
+}
+BENCHMARK(BM_SemVerComparePreRelease);
+
+// Full string-to-result path as used by the update checker
+static void BM_CompareVersions(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UpdateChecker::CompareVersions(CURRENT, LATEST));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CompareVersions);
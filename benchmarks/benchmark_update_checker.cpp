@@ -0,0 +1,57 @@
+// Release list scanning benchmarks
+#include "UpdateChecker.h"
+
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+
+#include <string>
+
+using namespace MetaImGUI;
+
+namespace {
+// A /releases page shaped like GitHub's: newest first, notes and per-asset uploader objects included.
+// Releases before stableIndex are nightlies, so the stable channel has to scan past them.
+std::string MakeReleasePage(int stableIndex) {
+    nlohmann::json page = nlohmann::json::array();
+    for (int i = 0; i < UpdateChecker::RELEASES_PER_PAGE; ++i) {
+        const std::string version = "2." + std::to_string(100 - i) + ".0";
+        const std::string tag = (i < stableIndex) ? "v" + version + "-nightly." + std::to_string(i) : "v" + version;
+        nlohmann::json release = {{"tag_name", tag},
+                                  {"html_url", "https://github.com/owner/repo/releases/tag/" + tag},
+                                  {"prerelease", i < stableIndex},
+                                  {"draft", false},
+                                  {"body", std::string(2000, 'n')},
+                                  {"author", {{"login", "owner"}, {"id", 1}, {"type", "User"}}}};
+        for (const char* suffix : {"-linux-x64.AppImage", "-linux-x64.tar.gz", "-Setup.exe", "-macos-x64.dmg"}) {
+            const std::string name = "MetaImGUI-" + version + suffix;
+            release["assets"].push_back({{"name", name},
+                                         {"size", 12345678},
+                                         {"browser_download_url", "https://github.com/owner/repo/" + name},
+                                         {"uploader", {{"login", "github-actions[bot]"}, {"id", 2}}}});
+        }
+        page.push_back(std::move(release));
+    }
+    return page.dump();
+}
+} // namespace
+
+// Streaming scan that stops at the first stable release; range(0) nightlies come before it
+static void BM_FindStableRelease(benchmark::State& state) {
+    const std::string page = MakeReleasePage(static_cast<int>(state.range(0)));
+    const UpdateAssetFilter filter = UpdateAssetFilter::ForThisBuild();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UpdateChecker::FindRelease(page, UpdateChannel::Stable, filter));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * page.size()));
+}
+BENCHMARK(BM_FindStableRelease)->Arg(0)->Arg(10)->Arg(UpdateChecker::RELEASES_PER_PAGE - 1);
+
+// Baseline: materializing the whole page as a DOM before looking at it
+static void BM_ParseReleasePageDom(benchmark::State& state) {
+    const std::string page = MakeReleasePage(0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nlohmann::json::parse(page));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * page.size()));
+}
+BENCHMARK(BM_ParseReleasePageDom);
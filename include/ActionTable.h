@@ -0,0 +1,79 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace MetaImGUI {
+
+/**
+ * @brief User-triggerable application actions, shared by menus, buttons and shortcuts
+ */
+enum class ActionId : uint8_t {
+    Exit,
+    CheckForUpdates,
+    DownloadUpdate,
+    ShowAbout,
+    ShowDemoWindow,
+    ToggleDemoWindow,
+    ShowInputDialog,
+    ToggleISSTracker,
+    TogglePerformanceOverlay,
+    ShowCommandPalette,
+    Count
+};
+
+/**
+ * @brief Fixed table of action handlers, bound once at startup
+ *
+ * UI code receives the table by reference and invokes actions by id, so drawing a menu
+ * or button row does not construct any callables per frame.
+ */
+class ActionTable {
+public:
+    static constexpr size_t ACTION_COUNT = static_cast<size_t>(ActionId::Count);
+
+    void Bind(ActionId id, std::function<void()> handler) {
+        m_handlers[Index(id)] = std::move(handler);
+    }
+
+    // Runs the handler bound to id; unbound actions do nothing
+    void Invoke(ActionId id) const {
+        if (const auto& handler = m_handlers[Index(id)]) {
+            handler();
+        }
+    }
+
+    [[nodiscard]] bool IsBound(ActionId id) const {
+        return static_cast<bool>(m_handlers[Index(id)]);
+    }
+
+private:
+    static constexpr size_t Index(ActionId id) {
+        return static_cast<size_t>(id);
+    }
+
+    std::array<std::function<void()>, ACTION_COUNT> m_handlers;
+};
+
+} // namespace MetaImGUI
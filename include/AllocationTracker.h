@@ -0,0 +1,92 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace MetaImGUI {
+
+struct AllocationCounts {
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+};
+
+/**
+ * @brief Per-frame heap allocation counters, attributed to the active AllocationScope
+ *
+ * Builds configured with METAIMGUI_TRACK_ALLOCATIONS replace the global operator new so
+ * every allocation is counted against the calling thread's innermost scope. Allocations
+ * outside any scope, including those of worker threads, are counted as UNSCOPED. Without
+ * the option nothing is hooked and all counts stay zero.
+ *
+ * EndFrame() is called once per frame on the main thread; the Get* accessors report the
+ * frame it closed.
+ */
+class AllocationTracker {
+public:
+    static constexpr size_t MAX_SCOPES = 32; // Including UNSCOPED; further names are counted as unscoped
+    static constexpr const char* UNSCOPED = "(unscoped)";
+
+    struct ScopeCounts {
+        const char* name = nullptr;
+        AllocationCounts counts;
+    };
+
+    // True when this build counts allocations (METAIMGUI_TRACK_ALLOCATIONS)
+    [[nodiscard]] static bool IsEnabled();
+
+    // Counts one allocation against the calling thread's scope; safe to call from allocators
+    static void RecordAllocation(size_t bytes) noexcept;
+
+    // malloc/free that record the allocation, with the signatures ImGui::SetAllocatorFunctions() takes
+    static void* TrackedMalloc(size_t bytes, void* userData);
+    static void TrackedFree(void* pointer, void* userData);
+
+    // Closes the current frame: its counts become the last frame's and counting restarts
+    static void EndFrame();
+
+    [[nodiscard]] static AllocationCounts GetLastFrame();
+
+    // Every scope seen so far, UNSCOPED first, with its counts in the last frame
+    [[nodiscard]] static std::span<const ScopeCounts> GetLastFrameScopes();
+};
+
+/**
+ * @brief Names the work on this thread for allocation attribution until destroyed
+ *
+ * Scopes nest; the innermost one is charged. The name must be a string literal (or
+ * otherwise outlive the program), as it is kept rather than copied.
+ */
+class AllocationScope {
+public:
+    explicit AllocationScope(const char* name) noexcept;
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+    AllocationScope(AllocationScope&&) = delete;
+    AllocationScope& operator=(AllocationScope&&) = delete;
+
+private:
+    size_t m_previous;
+};
+
+} // namespace MetaImGUI
@@ -18,8 +18,11 @@
 
 #pragma once
 
+#include "ActionTable.h"
+
+#include <chrono>
+#include <cstdint>
 #include <memory>
-#include <mutex>
 #include <string>
 
 // Forward declarations
@@ -27,10 +30,15 @@ namespace MetaImGUI {
 class WindowManager;
 class UIRenderer;
 class UpdateChecker;
+class CommandPalette;
 class ConfigManager;
 class DialogManager;
 class ISSTracker;
+class MainThreadDispatcher;
+template <typename T>
+class MainThreadSlot;
 struct UpdateInfo;
+struct UpdateDownloadResult;
 } // namespace MetaImGUI
 
 namespace MetaImGUI {
@@ -135,13 +143,18 @@ public:
     [[nodiscard]] bool ShouldClose() const;
 
 private:
-    // Subsystem managers
+    // Subsystem managers (dispatcher first: it must outlive every thread that posts to it)
+    std::unique_ptr<MainThreadDispatcher> m_dispatcher;
+    // Results that must reach the main thread even when the dispatcher's ring is full
+    std::unique_ptr<MainThreadSlot<UpdateInfo>> m_updateResult;
+    std::unique_ptr<MainThreadSlot<UpdateDownloadResult>> m_downloadResult;
     std::unique_ptr<WindowManager> m_windowManager;
     std::unique_ptr<UIRenderer> m_uiRenderer;
     std::unique_ptr<UpdateChecker> m_updateChecker;
     std::unique_ptr<ConfigManager> m_configManager;
     std::unique_ptr<DialogManager> m_dialogManager;
     std::unique_ptr<ISSTracker> m_issTracker;
+    std::unique_ptr<CommandPalette> m_commandPalette;
 
     // Application state
     bool m_initialized = false;
@@ -151,23 +164,33 @@ private:
     bool m_updateCheckInProgress = false;
     bool m_showExitDialog = false;
     bool m_showISSTracker = false;
+    bool m_showPerformanceOverlay = false;
+
+    // Menu, button and shortcut handlers, bound once in Initialize()
+    ActionTable m_actions;
 
     // Update checking
     std::unique_ptr<UpdateInfo> m_latestUpdateInfo;
-
-    // Thread-safe handoff of update results from worker thread to main thread
-    std::mutex m_updateResultMutex;
-    std::unique_ptr<UpdateInfo> m_pendingUpdateResult;
+    bool m_startupUpdateCheckPending = false; // Deferred until the first frames are on screen
+    uint64_t m_framesPresented = 0; // Submitted and swapped; unchanged frames left on screen are not counted
+    uint64_t m_framesRendered = 0;  // Every frame, presented or not
+    int m_updateDownloadDialog = 0; // Progress dialog of the running download; 0 if none
 
     // Status bar state
     std::string m_statusMessage;
     float m_lastFrameTime = 0.0f;
 
     // Private methods
+    void BindActions();
     void ProcessInput();
     void Render();
-    void CheckForUpdates();
+    void CheckForUpdates(std::chrono::milliseconds delay = std::chrono::milliseconds(0));
+    [[nodiscard]] bool IsStartupUpdateCheckDue() const;
+    void MaybeStartDeferredUpdateCheck();
     void OnUpdateCheckComplete(const UpdateInfo& updateInfo);
+    void ApplyUpdateResult(UpdateInfo& updateInfo);
+    void OnDownloadUpdateRequested();
+    void ApplyDownloadResult(const UpdateDownloadResult& result);
 
     // Context recovery
     bool OnContextLoss();
@@ -184,11 +207,25 @@ private:
     void OnShowAboutRequested();
     void OnShowInputDialogRequested();
     void OnToggleISSTracker();
+    void OnTogglePerformanceOverlay();
 
     // Window size constants
     static constexpr int DEFAULT_WIDTH = 1200;
     static constexpr int DEFAULT_HEIGHT = 800;
     static constexpr const char* WINDOW_TITLE = "MetaImGUI - ImGui Application Template";
+
+    // Time per frame spent running work posted from background threads
+    static constexpr std::chrono::microseconds DISPATCH_BUDGET{2000};
+
+    // Startup update check: once this many frames are presented and the UI is idle, or unconditionally
+    // after the maximum number of rendered frames
+    static constexpr uint64_t STARTUP_CHECK_MIN_FRAMES = 3;
+    static constexpr uint64_t STARTUP_CHECK_MAX_FRAMES = 300;
+    // Random extra delay so the check does not coincide with other startup work
+    static constexpr std::chrono::milliseconds STARTUP_CHECK_JITTER_MIN{2000};
+    static constexpr std::chrono::milliseconds STARTUP_CHECK_JITTER_MAX{8000};
+    // Skip the startup check if the last successful one is more recent (config: update_check_interval_hours)
+    static constexpr int DEFAULT_UPDATE_CHECK_INTERVAL_HOURS = 24;
 };
 
 } // namespace MetaImGUI
@@ -0,0 +1,291 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace MetaImGUI {
+
+template <typename T>
+class AsyncTask;
+
+namespace detail {
+
+// Resumes whoever awaited the task once it finishes
+struct FinalAwaiter {
+    [[nodiscard]] bool await_ready() const noexcept {
+        return false;
+    }
+
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+        const std::coroutine_handle<> continuation = handle.promise().continuation;
+        return continuation ? continuation : std::noop_coroutine();
+    }
+
+    void await_resume() const noexcept {}
+};
+
+class PromiseBase {
+public:
+    std::suspend_always initial_suspend() const noexcept {
+        return {};
+    }
+
+    FinalAwaiter final_suspend() const noexcept {
+        return {};
+    }
+
+    void unhandled_exception() noexcept {
+        m_exception = std::current_exception();
+    }
+
+    std::coroutine_handle<> continuation;
+
+protected:
+    void RethrowIfFailed() const {
+        if (m_exception) {
+            std::rethrow_exception(m_exception);
+        }
+    }
+
+private:
+    std::exception_ptr m_exception;
+};
+
+template <typename T>
+class Promise : public PromiseBase {
+public:
+    AsyncTask<T> get_return_object() noexcept;
+
+    template <typename U>
+    void return_value(U&& value) {
+        m_value.emplace(std::forward<U>(value));
+    }
+
+    T TakeResult() {
+        RethrowIfFailed();
+        return std::move(*m_value);
+    }
+
+private:
+    std::optional<T> m_value;
+};
+
+template <>
+class Promise<void> : public PromiseBase {
+public:
+    AsyncTask<void> get_return_object() noexcept;
+
+    void return_void() const noexcept {}
+
+    void TakeResult() const {
+        RethrowIfFailed();
+    }
+};
+
+// Eagerly started, self-destroying frame used to run a task without an awaiting coroutine
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() const noexcept {
+            return {};
+        }
+        std::suspend_never initial_suspend() const noexcept {
+            return {};
+        }
+        std::suspend_never final_suspend() const noexcept {
+            return {};
+        }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept {
+            std::terminate();
+        }
+    };
+};
+
+} // namespace detail
+
+/**
+ * @brief Lazily started coroutine producing a T
+ *
+ * The body does not run until the task is awaited (or started with Start() or
+ * SyncWait()). When the body finishes, the awaiting coroutine is resumed on the same
+ * thread through symmetric transfer.
+ * Exceptions thrown by the body are rethrown to the awaiter.
+ *
+ * A task runs on whichever thread resumes it; hop explicitly with an executor:
+ * @code
+ * AsyncTask<UpdateInfo> Check(std::stop_token stopToken) {
+ *     const HttpResponse response = co_await http.Get(request, stopToken); // I/O thread
+ *     co_await scheduler.Schedule();                                       // worker pool
+ *     co_return Parse(response.body);
+ * }
+ * @endcode
+ */
+template <typename T>
+class [[nodiscard]] AsyncTask {
+public:
+    using promise_type = detail::Promise<T>;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    AsyncTask() noexcept = default;
+
+    AsyncTask(AsyncTask&& other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+
+    AsyncTask& operator=(AsyncTask&& other) noexcept {
+        if (this != &other) {
+            Destroy();
+            m_handle = std::exchange(other.m_handle, {});
+        }
+        return *this;
+    }
+
+    AsyncTask(const AsyncTask&) = delete;
+    AsyncTask& operator=(const AsyncTask&) = delete;
+
+    ~AsyncTask() {
+        Destroy();
+    }
+
+    [[nodiscard]] bool Valid() const noexcept {
+        return static_cast<bool>(m_handle);
+    }
+
+    // Awaiting starts the body and suspends the caller until it finishes
+    auto operator co_await() && noexcept {
+        struct Awaiter {
+            Handle handle;
+
+            [[nodiscard]] bool await_ready() const noexcept {
+                return !handle || handle.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+
+            T await_resume() {
+                return handle.promise().TakeResult();
+            }
+        };
+        return Awaiter{m_handle};
+    }
+
+    /**
+     * @brief Run the task to completion, blocking the calling thread
+     * @note Must not be called from the thread the task needs to resume on
+     */
+    T SyncWait() && {
+        const AsyncTask task = std::move(*this);
+        SyncState state;
+        RunAndSignal(task.m_handle, state);
+
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.finishedCv.wait(lock, [&state] { return state.finished; });
+        lock.unlock();
+        return task.m_handle.promise().TakeResult();
+    }
+
+    /**
+     * @brief Start the task without awaiting it
+     *
+     * The task owns itself until it finishes and its result is discarded.
+     *
+     * @param onComplete Called on the finishing thread with the exception that escaped
+     *                   the body, or nullptr if it completed normally
+     */
+    void Start(std::function<void(std::exception_ptr)> onComplete = nullptr) && {
+        StartDetached(std::move(*this), std::move(onComplete));
+    }
+
+private:
+    friend class detail::Promise<T>;
+
+    explicit AsyncTask(Handle handle) noexcept : m_handle(handle) {}
+
+    void Destroy() noexcept {
+        if (m_handle) {
+            m_handle.destroy();
+            m_handle = {};
+        }
+    }
+
+    struct SyncState {
+        std::mutex mutex;
+        std::condition_variable finishedCv;
+        bool finished = false;
+    };
+
+    // Runs the body without taking ownership of it, so the waiter can read the result
+    static detail::DetachedTask RunAndSignal(Handle handle, SyncState& state) {
+        struct Runner {
+            Handle handle;
+            [[nodiscard]] bool await_ready() const noexcept {
+                return handle.done();
+            }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) const noexcept {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+            void await_resume() const noexcept {}
+        };
+        co_await Runner{handle};
+
+        // Notify under the lock so the waiter cannot destroy the state while it is in use
+        const std::lock_guard<std::mutex> lock(state.mutex);
+        state.finished = true;
+        state.finishedCv.notify_all();
+    }
+
+    static detail::DetachedTask StartDetached(AsyncTask task, std::function<void(std::exception_ptr)> onComplete) {
+        std::exception_ptr exception;
+        try {
+            co_await std::move(task);
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        if (onComplete) {
+            onComplete(exception);
+        }
+    }
+
+    Handle m_handle;
+};
+
+namespace detail {
+
+template <typename T>
+AsyncTask<T> Promise<T>::get_return_object() noexcept {
+    return AsyncTask<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+}
+
+inline AsyncTask<void> Promise<void>::get_return_object() noexcept {
+    return AsyncTask<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+
+} // namespace detail
+
+} // namespace MetaImGUI
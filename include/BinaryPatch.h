@@ -0,0 +1,60 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <stop_token>
+#include <string>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Applies bsdiff binary patches in a single streaming pass
+ *
+ * Reads the classic BSDIFF40 format written by the bsdiff tool: a header followed by
+ * bzip2-compressed control, diff and extra sections. The three sections are decompressed
+ * side by side and the output is written sequentially, so memory use is a few fixed
+ * buffers plus the bzip2 decoder state regardless of file size. The output is hashed
+ * while it is written.
+ *
+ * Patches are treated as untrusted input: every control record is bounds-checked and
+ * a corrupt or truncated patch fails cleanly without leaving an output file behind.
+ */
+class BinaryPatch {
+public:
+    static constexpr size_t BUFFER_SIZE = 64 * 1024;
+
+    struct Result {
+        bool succeeded = false;
+        uint64_t size = 0;  // Bytes written
+        std::string sha256; // Lower-case hex digest of the output
+        std::string error;
+    };
+
+    /**
+     * @brief Reconstruct newFile from oldFile and a BSDIFF40 patch
+     * @param stopToken Abandons the patch between control records
+     */
+    static Result Apply(const std::filesystem::path& oldFile, const std::filesystem::path& patchFile,
+                        const std::filesystem::path& newFile, std::stop_token stopToken = {});
+};
+
+} // namespace MetaImGUI
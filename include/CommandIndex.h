@@ -0,0 +1,125 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Immutable fuzzy-search index over command labels
+ *
+ * Built once per label set (typically on a worker thread) and shared read-only afterwards.
+ * Each label is stored lower-cased (ASCII) in one contiguous buffer, with a flag per
+ * character marking word starts and a 64-bit mask of the characters it contains.
+ *
+ * A query matches a label when its characters appear in the label in order, not
+ * necessarily adjacent ("shdw" matches "Show Demo Window"). The character masks reject
+ * most labels with one AND and compare each before any text is read.
+ */
+class CommandIndex {
+public:
+    explicit CommandIndex(const std::vector<std::string>& labels);
+
+    [[nodiscard]] size_t GetCount() const {
+        return m_masks.size();
+    }
+
+    // Lower-cases (ASCII) and drops spaces, which only separate words in a query
+    [[nodiscard]] static std::string FoldQuery(std::string_view query);
+
+    // Characters of folded text as a set; a label can only match queries whose mask is a subset of its own
+    [[nodiscard]] static uint64_t CharacterMask(std::string_view folded);
+
+    // Appends every command whose mask contains queryMask, in index order
+    void Prefilter(uint64_t queryMask, std::vector<uint32_t>& out) const;
+
+    /**
+     * @brief Score a command against a folded query
+     * @return 0 if the query is not a subsequence of the label, otherwise a positive score that
+     *         favours matches at word starts, consecutive runs and the start of the label
+     */
+    [[nodiscard]] int32_t Score(size_t command, std::string_view foldedQuery) const;
+
+private:
+    std::string m_folded;               // Lower-cased labels, back to back
+    std::vector<uint8_t> m_wordStarts;  // 1 where a word starts in m_folded
+    std::vector<uint32_t> m_offsets;    // Start of each label in m_folded, plus the end
+    std::vector<uint64_t> m_masks;      // CharacterMask() of each label
+
+    static constexpr int32_t SCORE_MATCH = 16;
+    static constexpr int32_t BONUS_WORD_START = 24;
+    static constexpr int32_t BONUS_CONSECUTIVE = 16;
+    static constexpr int32_t BONUS_LABEL_START = 16;
+    static constexpr int32_t PENALTY_GAP = 2;      // Per skipped character between matches
+    static constexpr int32_t PENALTY_GAP_MAX = 12; // Per gap
+};
+
+/**
+ * @brief Incremental fuzzy search over a CommandIndex
+ *
+ * A query that contains the previous one as a subsequence (typically one more character)
+ * re-scores only the previous results, since nothing else can match it; any other query
+ * prefilters the whole index by character mask and scores the survivors. Results are
+ * ordered by descending score, ties in index order.
+ */
+class CommandSearch {
+public:
+    struct Result {
+        uint32_t command;
+        int32_t score;
+    };
+
+    // Replaces the index and re-runs the current query against it
+    void SetIndex(std::shared_ptr<const CommandIndex> index);
+    [[nodiscard]] const std::shared_ptr<const CommandIndex>& GetIndex() const {
+        return m_index;
+    }
+
+    void SetQuery(std::string_view query);
+    [[nodiscard]] const std::string& GetQuery() const {
+        return m_query;
+    }
+
+    // Every command, in index order, while the query is empty
+    [[nodiscard]] const std::vector<Result>& GetResults() const {
+        return m_results;
+    }
+
+    // Commands scored by the last query update, after the mask prefilter
+    [[nodiscard]] size_t GetScoredCount() const {
+        return m_scored;
+    }
+
+private:
+    void Update(bool narrowing);
+
+    std::shared_ptr<const CommandIndex> m_index;
+    std::string m_query; // Folded
+    std::vector<Result> m_results;
+    std::vector<uint32_t> m_candidates;
+    size_t m_scored = 0;
+};
+
+} // namespace MetaImGUI
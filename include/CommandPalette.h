@@ -0,0 +1,109 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "CommandIndex.h"
+#include "TaskScheduler.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Keyboard-driven palette that fuzzy-searches every UI command (Ctrl+P)
+ *
+ * The commands come from a source callback, called on the main thread so it can use
+ * Localization. Their search index is built on a TaskScheduler worker and installed by
+ * Update() once finished; a language change triggers a rebuild, and the previous index
+ * stays searchable until then. Each keystroke re-scores only the previous results
+ * (see CommandSearch), and only the visible rows are drawn.
+ */
+class CommandPalette {
+public:
+    struct Command {
+        std::string category; // Shown before the label, and searched with it
+        std::string label;
+        std::function<void()> run;
+    };
+
+    // Lists every command in the current language
+    using CommandSource = std::function<std::vector<Command>()>;
+
+    explicit CommandPalette(CommandSource source, TaskScheduler& scheduler = TaskScheduler::Instance());
+    ~CommandPalette();
+
+    CommandPalette(const CommandPalette&) = delete;
+    CommandPalette& operator=(const CommandPalette&) = delete;
+    CommandPalette(CommandPalette&&) = delete;
+    CommandPalette& operator=(CommandPalette&&) = delete;
+
+    // Shows the palette with an empty query and the input focused
+    void Open();
+    void Close();
+    [[nodiscard]] bool IsOpen() const {
+        return m_open;
+    }
+
+    /**
+     * @brief Start a rebuild if the language changed, install a finished one
+     * @note Call once per frame, before Render(); does not allocate when nothing changed
+     */
+    void Update();
+
+    /**
+     * @brief Draw the palette if open and run the command the user picked
+     */
+    void Render();
+
+private:
+    struct PendingBuild; // Shared with the build task, so the palette may go away first
+
+    void RequestBuild();
+    void MoveSelection(int delta);
+
+    CommandSource m_source;
+    TaskScheduler& m_scheduler;
+
+    std::vector<Command> m_commands;         // Commands of the installed index, in index order
+    std::vector<Command> m_buildingCommands; // Commands of the latest requested build
+    std::shared_ptr<PendingBuild> m_pending;
+    TaskHandle m_buildTask;
+    uint64_t m_requestedBuild = 0;
+    uint64_t m_installedBuild = 0;
+    std::string m_language; // Language of the latest requested build
+
+    CommandSearch m_search;
+    std::array<char, 256> m_query{};
+    size_t m_selected = 0; // Row in the results
+    bool m_open = false;
+    bool m_focusInput = false;
+    bool m_scrollToSelected = false;
+
+    static constexpr float PALETTE_WIDTH = 520.0f;
+    static constexpr float PALETTE_TOP_OFFSET = 60.0f; // Below the menu bar
+    static constexpr float CATEGORY_COLUMN_WIDTH = 130.0f;
+    static constexpr int VISIBLE_ROWS = 12;
+};
+
+} // namespace MetaImGUI
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
 #include <map>
 #include <memory>
@@ -101,6 +102,10 @@ public:
     void SetInt(const std::string& key, int value);
     [[nodiscard]] std::optional<int> GetInt(const std::string& key) const;
 
+    // 64-bit values such as Unix timestamps
+    void SetInt64(const std::string& key, int64_t value);
+    [[nodiscard]] std::optional<int64_t> GetInt64(const std::string& key) const;
+
     void SetBool(const std::string& key, bool value);
     [[nodiscard]] std::optional<bool> GetBool(const std::string& key) const;
 
@@ -116,13 +121,13 @@ public:
     // Get all keys
     [[nodiscard]] std::vector<std::string> GetAllKeys() const;
 
+    // Per-user directory holding the config file and other persisted state
+    static std::filesystem::path GetConfigDirectory();
+
 private:
     struct Impl;
     std::unique_ptr<Impl> m_impl;
 
-    // Helper to get config directory
-    static std::filesystem::path GetConfigDirectory();
-
     // Helper to ensure config directory exists
     static bool EnsureConfigDirectoryExists();
 };
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include "ListDataProvider.h"
+
 #include <functional>
 #include <memory>
 #include <string>
@@ -103,9 +105,11 @@ public:
      * @brief Show a progress dialog
      * @param title Dialog title
      * @param message Progress message
+     * @param onCancel If set, a Cancel button closes the dialog and calls this
      * @return Dialog ID for updating progress
      */
-    int ShowProgressDialog(const std::string& title, const std::string& message = "");
+    int ShowProgressDialog(const std::string& title, const std::string& message = "",
+                           std::function<void()> onCancel = nullptr);
 
     /**
      * @brief Update progress dialog
@@ -125,12 +129,25 @@ public:
     /**
      * @brief Show a list selection dialog
      * @param title Dialog title
-     * @param items List of items to choose from
+     * @param items List of items to choose from (copied)
      * @param callback Function called with selected index (-1 if cancelled)
      */
     void ShowListDialog(const std::string& title, const std::vector<std::string>& items,
                         std::function<void(int)> callback = nullptr);
 
+    /**
+     * @brief Show a list selection dialog over items read on demand
+     *
+     * Only visible rows are read, and the type-ahead filter indexes the items a bounded
+     * number per frame, so the dialog opens at once however long the list is.
+     *
+     * @param title Dialog title
+     * @param items Item source, kept alive while the dialog is open
+     * @param callback Function called with the selected item index (-1 if cancelled)
+     */
+    void ShowListDialog(const std::string& title, std::shared_ptr<const ListDataProvider> items,
+                        std::function<void(int)> callback = nullptr);
+
     // Confirmation Dialog (convenience wrapper)
     /**
      * @brief Show a confirmation dialog (Yes/No)
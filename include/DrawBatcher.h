@@ -0,0 +1,100 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Draw commands submitted versus GPU draw calls issued for one frame
+ */
+struct DrawCallStats {
+    size_t commands = 0;  // Draw commands with geometry, excluding callbacks
+    size_t drawCalls = 0; // Draw calls the renderer issued for them
+    size_t vertices = 0;
+    size_t indices = 0;
+};
+
+/**
+ * @brief Merges consecutive draw commands that share a texture into multi-draw batches
+ *
+ * With clipping done per vertex instead of by scissor, the texture is the only state
+ * that separates ImGui draw commands. Each run of commands with the same texture becomes
+ * one batch whose index ranges feed a single glMultiDrawElementsBaseVertex. Ranges that
+ * continue the previous one with the same base vertex are joined, so a list that stays
+ * on one texture collapses to a single range. Commands are never reordered; blending
+ * depends on submission order.
+ *
+ * Storage is reused between frames, so steady-state batching does not allocate.
+ */
+class DrawBatcher {
+public:
+    struct Batch {
+        uint64_t texture = 0;
+        size_t firstRange = 0; // Into the range arrays
+        size_t rangeCount = 0;
+    };
+
+    // Forget the previous frame's batches, keeping their storage
+    void Reset();
+
+    /**
+     * @brief Append a draw command
+     * @param texture Texture the command samples
+     * @param firstIndex First index, counted from the start of the index buffer
+     * @param indexCount Number of indices
+     * @param baseVertex Added to every index to address the vertex buffer
+     */
+    void Add(uint64_t texture, size_t firstIndex, uint32_t indexCount, int32_t baseVertex);
+
+    [[nodiscard]] bool IsEmpty() const {
+        return m_batches.empty();
+    }
+    [[nodiscard]] const std::vector<Batch>& GetBatches() const {
+        return m_batches;
+    }
+
+    // Parallel arrays indexed by range, in the layout glMultiDrawElementsBaseVertex takes
+    [[nodiscard]] const std::vector<int32_t>& GetCounts() const {
+        return m_counts;
+    }
+    [[nodiscard]] const std::vector<size_t>& GetFirstIndices() const {
+        return m_firstIndices;
+    }
+    [[nodiscard]] const std::vector<int32_t>& GetBaseVertices() const {
+        return m_baseVertices;
+    }
+
+    // Commands added since the last Reset()
+    [[nodiscard]] size_t GetCommandCount() const {
+        return m_commandCount;
+    }
+
+private:
+    std::vector<Batch> m_batches;
+    std::vector<int32_t> m_counts;
+    std::vector<size_t> m_firstIndices;
+    std::vector<int32_t> m_baseVertices;
+    size_t m_commandCount = 0;
+};
+
+} // namespace MetaImGUI
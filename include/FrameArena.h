@@ -0,0 +1,108 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Bump allocator for memory that lives no longer than one UI frame
+ *
+ * Scratch containers built while drawing a frame (std::pmr::vector, std::pmr::string)
+ * take their memory from the arena by bumping a pointer. Deallocation is a no-op, and
+ * Reset() at the end of the frame reclaims everything at once. Memory is kept across
+ * frames: when a frame spills into extra chunks, Reset() merges them into one chunk
+ * big enough for that frame, so steady-state frames never reach the heap.
+ *
+ * Not thread-safe; Instance() is for the main (UI) thread only.
+ */
+class FrameArena : public std::pmr::memory_resource {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 256 * 1024;
+
+    explicit FrameArena(size_t initialCapacity = DEFAULT_CAPACITY,
+                        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+    ~FrameArena() override;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+    FrameArena(FrameArena&&) = delete;
+    FrameArena& operator=(FrameArena&&) = delete;
+
+    /**
+     * @brief The arena shared by UI code on the main thread, reset by UIRenderer::EndFrame()
+     */
+    static FrameArena& Instance();
+
+    /**
+     * @brief Reclaim everything allocated since the last reset
+     *
+     * Anything still pointing into the arena is invalidated.
+     */
+    void Reset();
+
+    // Bytes handed out since the last reset, including alignment padding
+    [[nodiscard]] size_t GetBytesUsed() const {
+        return m_bytesUsed;
+    }
+    [[nodiscard]] size_t GetCapacity() const;
+    [[nodiscard]] size_t GetPeakBytes() const {
+        return m_peakBytes;
+    }
+
+    // Chunks taken from the upstream (heap) resource since the last reset; zero once warmed up
+    [[nodiscard]] size_t GetHeapAllocations() const {
+        return m_heapAllocations;
+    }
+
+    // Totals of the frame before the last reset, for display after the frame is gone
+    [[nodiscard]] size_t GetLastFrameBytes() const {
+        return m_lastFrameBytes;
+    }
+    [[nodiscard]] size_t GetLastFrameHeapAllocations() const {
+        return m_lastFrameHeapAllocations;
+    }
+
+private:
+    struct Chunk {
+        std::byte* data = nullptr;
+        size_t size = 0;
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    void AddChunk(size_t size);
+    void ReleaseChunks();
+
+    std::pmr::memory_resource* m_upstream;
+    std::vector<Chunk> m_chunks; // Allocation happens in the last one
+    size_t m_offset = 0;         // Into the last chunk
+    size_t m_bytesUsed = 0;
+    size_t m_peakBytes = 0;
+    size_t m_heapAllocations = 0;
+    size_t m_lastFrameBytes = 0;
+    size_t m_lastFrameHeapAllocations = 0;
+};
+
+} // namespace MetaImGUI
@@ -0,0 +1,89 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Fast non-cryptographic 64-bit hash for fingerprinting a frame's draw data
+ *
+ * Consumes input a word at a time over four independent lanes, so hashing the vertex and
+ * index buffers of a typical frame costs a few microseconds. Not stable across versions;
+ * fingerprints are only compared within one run.
+ */
+class FrameHasher {
+public:
+    void Add(const void* data, size_t size);
+
+    template <typename T>
+    void AddValue(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Only plain values can be hashed by bytes");
+        Add(&value, sizeof(value));
+    }
+
+    [[nodiscard]] uint64_t Finish() const;
+
+private:
+    std::array<uint64_t, 4> m_lanes = {0x243F6A8885A308D3ULL, 0x13198A2E03707344ULL, 0xA4093822299F31D0ULL,
+                                       0x082EFA98EC4E6C89ULL};
+    uint64_t m_length = 0;
+};
+
+/**
+ * @brief Decides whether a rendered frame has to reach the screen
+ *
+ * A frame whose fingerprint matches the last presented one would draw the same pixels,
+ * so its GPU submission and buffer swap can be skipped and the previous image stays on
+ * screen. Anything that loses the window contents (resize, expose, context reset) must
+ * call Invalidate() so the next frame is presented regardless.
+ */
+class PresentGate {
+public:
+    /**
+     * @brief Whether the frame must be submitted and presented
+     * @param fingerprint Hash of the frame's draw data
+     * @param forcePresent Present even if unchanged, e.g. while texture uploads are pending
+     */
+    bool ShouldPresent(uint64_t fingerprint, bool forcePresent = false);
+
+    // The screen no longer shows the last presented frame
+    void Invalidate() {
+        m_valid = false;
+    }
+
+    [[nodiscard]] uint64_t GetPresentedFrames() const {
+        return m_presented;
+    }
+    [[nodiscard]] uint64_t GetSkippedFrames() const {
+        return m_skipped;
+    }
+
+private:
+    uint64_t m_lastFingerprint = 0;
+    bool m_valid = false;
+    uint64_t m_presented = 0;
+    uint64_t m_skipped = 0;
+};
+
+} // namespace MetaImGUI
@@ -0,0 +1,91 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "DrawBatcher.h"
+
+#include <cstddef>
+#include <memory>
+
+// Forward declarations
+struct ImDrawData;
+
+namespace MetaImGUI {
+
+/**
+ * @brief ImGui draw data renderer that streams geometry through persistently mapped buffers
+ *
+ * The stock OpenGL3 backend re-specifies its vertex and index buffers with glBufferData
+ * every frame, which makes the driver copy the data and orphan or stall on the previous
+ * storage. This renderer allocates immutable storage once (GL_ARB_buffer_storage, core in
+ * OpenGL 4.4), keeps it mapped for the lifetime of the context, and splits it into
+ * REGION_COUNT regions used round-robin. Each frame writes its geometry straight into the
+ * next region and fences it; the CPU only waits if the GPU is still reading that region
+ * from REGION_COUNT frames ago.
+ *
+ * Clip rects are written per vertex and applied in the fragment shader instead of by
+ * glScissor, which leaves the texture as the only state between draw commands. Runs of
+ * commands on the same texture are merged by DrawBatcher into one
+ * glMultiDrawElementsBaseVertex call.
+ *
+ * Textures are still created and updated by the stock backend, which must be initialized.
+ * Initialize() fails on contexts without buffer storage (macOS tops out at OpenGL 4.1), and
+ * the caller keeps rendering through the stock backend.
+ */
+class GLStreamRenderer {
+public:
+    static constexpr size_t REGION_COUNT = 3;
+    // Per region; regions grow to the next power of two when a frame does not fit
+    static constexpr size_t INITIAL_VERTEX_CAPACITY = 64 * 1024;
+    static constexpr size_t INITIAL_INDEX_CAPACITY = 128 * 1024;
+
+    GLStreamRenderer();
+    ~GLStreamRenderer();
+
+    // Disable copy and move
+    GLStreamRenderer(const GLStreamRenderer&) = delete;
+    GLStreamRenderer& operator=(const GLStreamRenderer&) = delete;
+    GLStreamRenderer(GLStreamRenderer&&) = delete;
+    GLStreamRenderer& operator=(GLStreamRenderer&&) = delete;
+
+    /**
+     * @brief Load the GL entry points and create the program and mapped buffers
+     * @return false if the current context lacks buffer storage or setup failed
+     */
+    bool Initialize();
+
+    /**
+     * @brief Release GL objects; the context must still be current
+     */
+    void Shutdown();
+
+    /**
+     * @brief Render a frame's draw data, as ImGui_ImplOpenGL3_RenderDrawData does
+     */
+    void RenderDrawData(ImDrawData* drawData);
+
+    // Draw commands and draw calls of the last rendered frame
+    [[nodiscard]] const DrawCallStats& GetStats() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+};
+
+} // namespace MetaImGUI
@@ -0,0 +1,164 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "HttpClient.h"
+#include "TaskScheduler.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Private HTTP response cache, in memory and optionally on disk
+ *
+ * Stores successful GET responses that carry a validator (ETag or Last-Modified)
+ * or an explicit max-age, following Cache-Control: no-store responses are never
+ * stored, no-cache ones are always revalidated, and max-age (less Age) sets how long an
+ * entry may be served without contacting the server. Stale entries supply
+ * If-None-Match / If-Modified-Since headers so an unchanged resource costs a 304
+ * with no body.
+ *
+ * Entries on disk survive restarts: per URL, a small JSON file of metadata and a file
+ * holding the raw body. Store() and Revalidate() update memory at once and queue the disk
+ * write for a TaskScheduler worker, so callers on the HTTP I/O thread never wait on the
+ * file system; a revalidation rewrites only the metadata. All methods are thread-safe.
+ */
+class HttpCache {
+public:
+    using Clock = std::chrono::system_clock;
+
+    static constexpr size_t MAX_MEMORY_ENTRIES = 64;
+    static constexpr size_t MAX_ENTRY_BYTES = 8 * 1024 * 1024;
+
+    struct Entry {
+        std::string url;
+        std::string body;
+        std::string etag;
+        std::string lastModified;
+        Clock::time_point freshUntil{}; // Epoch if the entry must always be revalidated
+
+        [[nodiscard]] bool IsFresh(Clock::time_point now) const {
+            return now < freshUntil;
+        }
+
+        /**
+         * @brief Append the conditional request headers for revalidating this entry
+         */
+        void AddConditionalHeaders(std::vector<std::string>& headers) const;
+
+        /**
+         * @brief The cached 200 response
+         */
+        [[nodiscard]] HttpResponse ToResponse() const;
+    };
+
+    struct Stats {
+        uint64_t freshHits = 0;   // Served without a request
+        uint64_t revalidated = 0; // Answered 304 Not Modified
+        uint64_t stored = 0;      // Full responses stored
+    };
+
+    /**
+     * @param directory Directory for persisted entries; empty keeps the cache in memory only
+     */
+    explicit HttpCache(std::filesystem::path directory = {}, TaskScheduler& scheduler = TaskScheduler::Instance());
+    ~HttpCache(); // Flushes queued disk writes
+
+    HttpCache(const HttpCache&) = delete;
+    HttpCache& operator=(const HttpCache&) = delete;
+    HttpCache(HttpCache&&) = delete;
+    HttpCache& operator=(HttpCache&&) = delete;
+
+    /**
+     * @brief Find the entry for a URL, loading it from disk if it is not in memory
+     */
+    [[nodiscard]] std::optional<Entry> Lookup(const std::string& url);
+
+    /**
+     * @brief Store a full response if its headers allow reuse
+     * @return true if the response was cached
+     */
+    bool Store(const std::string& url, const HttpResponse& response);
+
+    /**
+     * @brief Apply a 304 response to the stored entry, refreshing its lifetime
+     * @return The refreshed entry, or nullopt if it has been evicted meanwhile
+     */
+    std::optional<Entry> Revalidate(const std::string& url, const HttpResponse& notModified);
+
+    /**
+     * @brief Drop all entries from memory and disk
+     */
+    void Clear();
+
+    /**
+     * @brief Block until every queued disk write has been written
+     */
+    void Flush();
+
+    [[nodiscard]] size_t GetMemoryEntryCount() const;
+    [[nodiscard]] Stats GetStats() const;
+
+    /**
+     * @brief Freshness deadline for a response from its Cache-Control and Age headers
+     * @return nullopt if the response must not be stored (no-store)
+     */
+    static std::optional<Clock::time_point> ComputeFreshUntil(const HttpResponse& response, Clock::time_point now);
+
+private:
+    struct Slot {
+        Entry entry;
+        uint64_t lastUsed = 0;
+    };
+
+    // Queued disk writes, shared with the worker task writing them
+    struct DiskWriter;
+
+    void InsertLocked(Entry entry);
+    void QueueWrite(const Entry& entry, bool writeBody);
+    [[nodiscard]] std::optional<Entry> LoadFromDisk(const std::string& url) const;
+    [[nodiscard]] static std::filesystem::path EntryPath(const std::filesystem::path& directory,
+                                                         const std::string& url);
+    static void SaveToDisk(const std::filesystem::path& directory, const Entry& entry, bool writeBody);
+
+    std::filesystem::path m_directory;
+    TaskScheduler& m_scheduler;
+    std::shared_ptr<DiskWriter> m_writer; // Null when caching in memory only
+
+    mutable std::mutex m_mutex; // Protects m_entries and m_useCounter
+    std::unordered_map<std::string, Slot> m_entries;
+    uint64_t m_useCounter = 0;
+
+    std::atomic<uint64_t> m_freshHits{0};
+    std::atomic<uint64_t> m_revalidated{0};
+    std::atomic<uint64_t> m_stored{0};
+};
+
+} // namespace MetaImGUI
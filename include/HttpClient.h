@@ -0,0 +1,179 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "AsyncTask.h"
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace MetaImGUI {
+
+class HttpCache;
+
+struct HttpRequest {
+    std::string url;
+    std::vector<std::string> headers; // "Name: value"
+    std::string userAgent = "MetaImGUI/1.0";
+    long timeoutSeconds = 30;     // Whole transfer; 0 for no limit
+    long stallTimeoutSeconds = 0; // Abort after this long without receiving data; 0 to disable
+    uint64_t rangeStart = 0;      // Request the body from this offset (206, or 200 if the server ignores it)
+
+    // Receives the body in chunks, on the I/O thread, instead of HttpResponse::body.
+    // Return false to abort the transfer. Such requests bypass the response cache.
+    std::function<bool(long statusCode, std::string_view chunk)> onBody;
+};
+
+struct HttpResponse {
+    long statusCode = 0; // 0 for non-HTTP URLs such as file://
+    std::string body;
+    std::string error;                          // Transport error; empty if the transfer completed
+    std::map<std::string, std::string> headers; // Of the final response, names lower-cased
+    bool fromCache = false;                     // Served or revalidated from the HttpCache
+
+    /**
+     * @brief Look up a response header
+     * @param name Lower-case header name
+     * @return The value, or an empty string if absent
+     */
+    [[nodiscard]] std::string GetHeader(const std::string& name) const {
+        const auto it = headers.find(name);
+        return (it != headers.end()) ? it->second : std::string{};
+    }
+
+    /**
+     * @brief Check if the transfer completed (HTTP error statuses still count as completed)
+     */
+    [[nodiscard]] bool Succeeded() const {
+        return error.empty();
+    }
+};
+
+/**
+ * @brief Asynchronous HTTP client driving all transfers from one I/O thread
+ *
+ * Requests are multiplexed with libcurl's multi interface, so any number of concurrent
+ * fetches share a single thread, its connection pool, and its DNS and TLS session caches.
+ * On Linux socket readiness is driven by epoll. HTTPS requests negotiate HTTP/2 where
+ * libcurl supports it, so requests to the same host share one connection. libcurl, its
+ * TLS backend and the I/O thread are only initialized by the first request, so creating
+ * a client costs nothing at startup.
+ *
+ * Awaiting Get() suspends the coroutine without occupying a thread; it resumes on the
+ * I/O thread when the transfer finishes, so continuations should be short or hop to an
+ * executor first.
+ *
+ * @code
+ * AsyncTask<void> Poll(std::stop_token stopToken) {
+ *     const HttpResponse response = co_await HttpClient::Instance().Get({.url = url}, stopToken);
+ *     co_await TaskScheduler::Instance().Schedule();
+ *     Parse(response.body);
+ * }
+ * @endcode
+ */
+class HttpClient {
+public:
+    HttpClient();
+    ~HttpClient();
+
+    HttpClient(const HttpClient&) = delete;
+    HttpClient& operator=(const HttpClient&) = delete;
+    HttpClient(HttpClient&&) = delete;
+    HttpClient& operator=(HttpClient&&) = delete;
+
+    /**
+     * @brief Application-wide client, created on first use
+     */
+    static HttpClient& Instance();
+
+    /**
+     * @brief Fetch a URL
+     *
+     * A stop request aborts the transfer and completes it with an error.
+     * Must not be SyncWait()ed on the I/O thread itself.
+     *
+     * With a cache attached, fresh entries are returned without a transfer and stale
+     * ones are revalidated with a conditional request; a 304 answer is returned as the
+     * cached 200 response. Streamed (onBody) and ranged requests are never cached.
+     */
+    AsyncTask<HttpResponse> Get(HttpRequest request, std::stop_token stopToken = {});
+
+    /**
+     * @brief Attach a response cache used by all subsequent requests
+     * @param cache Cache to use, or nullptr to disable caching
+     */
+    void SetCache(std::shared_ptr<HttpCache> cache);
+    [[nodiscard]] std::shared_ptr<HttpCache> GetCache() const;
+
+    /**
+     * @brief Abort all transfers and join the I/O thread
+     *
+     * Safe to call multiple times. Requests made afterwards fail immediately.
+     * Call before GlobalCleanup().
+     */
+    void Shutdown();
+
+    /**
+     * @brief Release libcurl's global state if a request initialized it
+     *
+     * Call once at exit, after every client has shut down.
+     */
+    static void GlobalCleanup();
+
+    /**
+     * @brief Number of transfers queued or in progress
+     */
+    [[nodiscard]] size_t GetActiveTransferCount() const;
+
+private:
+    struct Impl;
+    struct Transfer;
+
+    class GetAwaiter {
+    public:
+        GetAwaiter(Impl& impl, HttpRequest request, std::stop_token stopToken)
+            : m_impl(impl), m_request(std::move(request)), m_stopToken(std::move(stopToken)) {}
+
+        [[nodiscard]] bool await_ready() const noexcept {
+            return false;
+        }
+        bool await_suspend(std::coroutine_handle<> handle);
+        HttpResponse await_resume() {
+            return std::move(m_response);
+        }
+
+    private:
+        Impl& m_impl;
+        HttpRequest m_request;
+        std::stop_token m_stopToken;
+        HttpResponse m_response;
+    };
+
+    std::unique_ptr<Impl> m_impl;
+};
+
+} // namespace MetaImGUI
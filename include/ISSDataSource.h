@@ -0,0 +1,164 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "AsyncTask.h"
+#include "HttpClient.h"
+
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <vector>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Source of raw ISS position responses for ISSTracker
+ *
+ * Every source yields responses in the wheretheiss.at JSON format so the tracker's
+ * parse, record and publish path is exercised identically whatever the origin.
+ * ISSTracker fetches through FetchAsync(); the default implementation calls Fetch()
+ * inline, serialized per instance, so Fetch() need not be thread-safe.
+ */
+class ISSDataSource {
+public:
+    ISSDataSource() = default;
+    virtual ~ISSDataSource() = default;
+
+    ISSDataSource(const ISSDataSource&) = delete;
+    ISSDataSource& operator=(const ISSDataSource&) = delete;
+    ISSDataSource(ISSDataSource&&) = delete;
+    ISSDataSource& operator=(ISSDataSource&&) = delete;
+
+    /**
+     * @brief Fetch one raw response
+     * @return JSON response, or an empty string on failure
+     */
+    virtual std::string Fetch() = 0;
+
+    /**
+     * @brief Fetch one raw response without blocking a thread where the source allows it
+     * @param stopToken Abandons the fetch; the result is then empty
+     * @return JSON response, or an empty string on failure
+     */
+    virtual AsyncTask<std::string> FetchAsync(std::stop_token stopToken);
+
+    /**
+     * @brief Short description for log messages
+     */
+    [[nodiscard]] virtual std::string GetName() const = 0;
+
+private:
+    std::mutex m_fetchMutex; // Serializes the default FetchAsync()
+};
+
+/**
+ * @brief Fetches positions over HTTP(S) through the shared HttpClient
+ *
+ * Fetches are awaited on the client's I/O thread, and its connection cache keeps the
+ * connection alive between polls.
+ */
+class HttpDataSource : public ISSDataSource {
+public:
+    static constexpr const char* DEFAULT_URL = "https://api.wheretheiss.at/v1/satellites/25544";
+
+    explicit HttpDataSource(std::string url = DEFAULT_URL, HttpClient& client = HttpClient::Instance());
+    ~HttpDataSource() override = default;
+
+    HttpDataSource(const HttpDataSource&) = delete;
+    HttpDataSource& operator=(const HttpDataSource&) = delete;
+    HttpDataSource(HttpDataSource&&) = delete;
+    HttpDataSource& operator=(HttpDataSource&&) = delete;
+
+    /**
+     * @brief Blocking fetch; must not be called on the HttpClient I/O thread
+     */
+    std::string Fetch() override;
+    AsyncTask<std::string> FetchAsync(std::stop_token stopToken) override;
+    [[nodiscard]] std::string GetName() const override;
+
+private:
+    std::string m_url;
+    HttpClient& m_client;
+};
+
+/**
+ * @brief Serves responses from a recorded session, one per Fetch()
+ *
+ * Reads the JSON-lines log written by ISSTracker recording. The file is read once on
+ * construction; empty lines and lines starting with '#' are skipped.
+ */
+class FileDataSource : public ISSDataSource {
+public:
+    /**
+     * @param path Recorded response log
+     * @param loop Start over from the first response once the log is exhausted
+     */
+    explicit FileDataSource(const std::filesystem::path& path, bool loop = true);
+
+    std::string Fetch() override;
+    [[nodiscard]] std::string GetName() const override;
+
+    [[nodiscard]] size_t GetResponseCount() const {
+        return m_responses.size();
+    }
+
+private:
+    std::string m_name;
+    std::vector<std::string> m_responses;
+    size_t m_next = 0;
+    bool m_loop;
+};
+
+/**
+ * @brief Generates positions along a simulated ISS orbit
+ *
+ * Each Fetch() advances simulated time by 1 / sampleRate seconds, so the generated
+ * track stays physically plausible at any polling rate. Combined with
+ * ISSTracker::SetPollInterval this drives the tracker far beyond the real API's rate.
+ */
+class SyntheticDataSource : public ISSDataSource {
+public:
+    static constexpr double INCLINATION_DEG = 51.6;
+    static constexpr double ORBITAL_PERIOD_S = 5556.0;
+    static constexpr double ALTITUDE_KM = 420.0;
+    static constexpr double VELOCITY_KMH = 27600.0;
+
+    /**
+     * @param sampleRate Simulated samples per second (Hz)
+     * @param startTime Unix timestamp of the first sample
+     */
+    explicit SyntheticDataSource(double sampleRate = 1.0, long startTime = 0);
+
+    std::string Fetch() override;
+    [[nodiscard]] std::string GetName() const override;
+
+    [[nodiscard]] size_t GetSampleCount() const {
+        return m_sample;
+    }
+
+private:
+    double m_sampleRate;
+    long m_startTime;
+    size_t m_sample = 0;
+};
+
+} // namespace MetaImGUI
@@ -18,17 +18,28 @@
 
 #pragma once
 
+#include "AsyncTask.h"
+#include "TaskScheduler.h"
+#include "TrackHistory.h"
+#include "TrackerMetrics.h"
+
 #include <atomic>
-#include <deque>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <stop_token>
 #include <string>
-#include <thread>
+#include <vector>
 
 namespace MetaImGUI {
 
+class ISSDataSource;
+class MainThreadDispatcher;
+class TrackReplay;
+
 // ISS position data structure
 struct ISSPosition {
     double latitude = 0.0;
@@ -43,14 +54,21 @@ struct ISSPosition {
  * @brief ISS Tracker that fetches ISS position data asynchronously
  *
  * This class demonstrates:
- * - Properly threaded async JSON requests using std::jthread
+ * - Coroutine polling: fetches are awaited without holding a thread, parsing and
+ *   publishing run on the shared TaskScheduler
  * - JSON decoding with nlohmann/json
  * - Thread-safe data access for ImGui/ImPlot rendering
- * - Circular buffer for historical position tracking
+ * - Level-of-detail history for long orbit trails
+ * - Recording and time-scrubbed replay of tracker sessions
+ * - Pluggable data sources (HTTP, recorded log, synthetic) for offline load testing
+ * - Lock-free throughput and latency metrics
  */
 class ISSTracker {
 public:
-    ISSTracker();
+    /**
+     * @param scheduler Scheduler the polling coroutine and replay task run on; must outlive the tracker
+     */
+    explicit ISSTracker(TaskScheduler& scheduler = TaskScheduler::Instance());
     ~ISSTracker();
 
     // Disable copy and move
@@ -61,17 +79,18 @@ public:
 
     /**
      * @brief Start tracking ISS position asynchronously
-     * @param callback Function to call when new position data is available
+     * @param callback Function to call when new position data is available; runs on a
+     *                 scheduler worker unless a callback dispatcher is set
      */
     void StartTracking(std::function<void(const ISSPosition&)> callback = nullptr);
 
     /**
-     * @brief Stop tracking
+     * @brief Stop tracking (live or replay)
      */
     void StopTracking();
 
     /**
-     * @brief Check if tracking is active
+     * @brief Check if tracking is active (live or replay)
      */
     bool IsTracking() const;
 
@@ -84,8 +103,24 @@ public:
      * @brief Get position history for orbit trail (thread-safe)
      * @param latitudes Output vector for latitude values
      * @param longitudes Output vector for longitude values
+     * @param maxPoints Point budget for the trail; the history is decimated to fit (0 = all samples)
      */
-    void GetPositionHistory(std::vector<double>& latitudes, std::vector<double>& longitudes) const;
+    void GetPositionHistory(std::vector<double>& latitudes, std::vector<double>& longitudes,
+                            size_t maxPoints = 0) const;
+
+    /**
+     * @brief Get position history split into antimeridian-free segments (thread-safe)
+     * @param latitudes Output vector for latitude values
+     * @param longitudes Output vector for longitude values
+     * @param segmentStarts Output offsets into latitudes/longitudes where each segment starts
+     * @param maxPoints Point budget for the trail; the history is decimated to fit (0 = all samples)
+     */
+    void GetPositionHistory(std::vector<double>& latitudes, std::vector<double>& longitudes,
+                            std::vector<size_t>& segmentStarts, size_t maxPoints = 0) const;
+
+    // As above, into polymorphic-allocator vectors so the UI can use frame scratch memory
+    void GetPositionHistory(std::pmr::vector<double>& latitudes, std::pmr::vector<double>& longitudes,
+                            std::pmr::vector<size_t>& segmentStarts, size_t maxPoints = 0) const;
 
     /**
      * @brief Get the maximum number of positions stored in history
@@ -99,32 +134,213 @@ public:
      */
     ISSPosition FetchPositionSync();
 
-private:
-    // API endpoint
-    static constexpr const char* ISS_API_URL = "https://api.wheretheiss.at/v1/satellites/25544";
+    /**
+     * @brief Fetch ISS position once; continues on a scheduler worker after the fetch
+     * @param stopToken Abandons the fetch
+     */
+    AsyncTask<ISSPosition> FetchPositionAsync(std::stop_token stopToken = {});
+
+    /**
+     * @brief Replace the source live positions are fetched from
+     *
+     * Defaults to HttpDataSource on the public API. Takes effect on the next fetch.
+     * @param source New source; nullptr restores the default
+     */
+    void SetDataSource(std::shared_ptr<ISSDataSource> source);
+
+    /**
+     * @brief Set the delay between live fetches
+     * @param interval Delay after each fetch; zero polls back to back. Applies from the next delay.
+     */
+    void SetPollInterval(std::chrono::milliseconds interval);
+    std::chrono::milliseconds GetPollInterval() const;
+
+    static constexpr std::chrono::milliseconds DEFAULT_POLL_INTERVAL{5000};
+
+    /**
+     * @brief Deliver callbacks on the dispatcher's thread instead of the tracker thread
+     *
+     * Each new position is posted to the dispatcher without allocating. If the queue is
+     * full the callback for that position is dropped and counted in the metrics.
+     * The dispatcher must outlive the tracker.
+     *
+     * @param dispatcher Dispatcher to post to; nullptr invokes callbacks directly
+     */
+    void SetCallbackDispatcher(MainThreadDispatcher* dispatcher);
+
+    // Metrics
+
+    /**
+     * @brief Snapshot of fetch/parse/callback latencies, byte and outcome counters
+     */
+    TrackerMetrics::Snapshot GetMetrics() const;
+
+    /**
+     * @brief Clear all metrics
+     */
+    void ResetMetrics();
+
+    /**
+     * @brief Age of the current position against its API timestamp
+     * @return Milliseconds, or -1 if there is no position
+     */
+    int64_t GetCurrentSampleAgeMs() const;
+
+    // Session replay
+
+    /**
+     * @brief Load a recorded session for replay
+     *
+     * The file is parsed and indexed once; see TrackReplay for the accepted formats.
+     * Any running replay is stopped.
+     *
+     * @param path Captured response log or history file
+     * @return true if the session contains at least one valid sample
+     */
+    bool LoadReplay(const std::filesystem::path& path);
+
+    /**
+     * @brief Check if a replay session is loaded
+     */
+    bool HasReplay() const;
+
+    /**
+     * @brief Start or resume playback of the loaded session
+     *
+     * Stops live tracking. Samples are published through the same path as live
+     * fixes, so history, current position and callback behave identically.
+     */
+    void StartReplay();
+
+    /**
+     * @brief Pause playback, keeping the replay position
+     */
+    void PauseReplay();
+
+    /**
+     * @brief Check if the tracker is in replay mode (playing or paused)
+     */
+    bool IsReplaying() const;
+
+    /**
+     * @brief Check if playback is paused (also true once the end is reached)
+     */
+    bool IsReplayPaused() const;
+
+    /**
+     * @brief Set playback speed as a multiple of real time
+     * @param speed Clamped to [MIN_REPLAY_SPEED, MAX_REPLAY_SPEED]
+     */
+    void SetReplaySpeed(double speed);
+    double GetReplaySpeed() const;
+
+    /**
+     * @brief Jump to a point in the session
+     *
+     * The target is located with a binary search over the pre-indexed samples and the
+     * orbit trail is rebuilt from the samples leading up to it.
+     *
+     * @param timestamp Unix timestamp within the session range
+     */
+    void SeekReplay(long timestamp);
+
+    long GetReplayStartTime() const;
+    long GetReplayEndTime() const;
+
+    /**
+     * @brief Current playback position (Unix timestamp)
+     */
+    long GetReplayTime() const;
+
+    // Recording
 
-    // Maximum number of historical positions to store
-    static constexpr size_t m_maxHistorySize = 100;
+    /**
+     * @brief Append every raw API response to a log, one JSON object per line
+     * @param path Log file (appended to if it exists)
+     * @return true if the file could be opened
+     */
+    bool StartRecording(const std::filesystem::path& path);
+
+    /**
+     * @brief Stop recording responses
+     */
+    void StopRecording();
+
+    /**
+     * @brief Check if responses are being recorded
+     */
+    bool IsRecording() const;
+
+    /**
+     * @brief Parse an API response into a position
+     * @return Position with valid == false if required fields are missing
+     */
+    static ISSPosition ParseJSON(const std::string& jsonResponse);
+
+    static constexpr double MIN_REPLAY_SPEED = 1.0;
+    static constexpr double MAX_REPLAY_SPEED = 1000.0;
+
+private:
+    // Maximum number of historical positions to store (24 hours at 1 Hz)
+    static constexpr size_t m_maxHistorySize = 86400;
 
     // Current position and history
     ISSPosition m_currentPosition;
-    std::deque<ISSPosition> m_positionHistory;
+    TrackHistory m_positionHistory{m_maxHistorySize};
     mutable std::mutex m_dataMutex;
 
-    // Threading
+    bool m_historyFromReplay = false; // Protected by m_dataMutex
+
+    // Data source (m_sourceMutex also serializes Fetch calls)
+    std::shared_ptr<ISSDataSource> m_dataSource;
+    std::mutex m_sourceMutex;
+
+    // Threading (the task handle is protected by m_threadMutex)
+    TaskScheduler& m_scheduler;
+    TaskHandle m_trackingTask;
     std::atomic<bool> m_tracking;
-    std::jthread m_trackingThread;
     mutable std::mutex m_threadMutex;
+    std::atomic<std::chrono::milliseconds::rep> m_pollIntervalMs{DEFAULT_POLL_INTERVAL.count()};
+
+    // Replay (session protected by m_threadMutex; the replay task keeps its own reference)
+    std::shared_ptr<const TrackReplay> m_replay;
+    std::atomic<bool> m_replaying{false};
+    std::atomic<bool> m_replayPaused{false};
+    std::atomic<double> m_replaySpeed{MIN_REPLAY_SPEED};
+    std::atomic<long> m_replayTime{0};
+    std::atomic<long> m_seekTarget{0};
+    std::atomic<bool> m_seekPending{false};
+
+    // Recording (protected by m_recordMutex)
+    std::ofstream m_recordFile;
+    mutable std::mutex m_recordMutex;
+
+    TrackerMetrics m_metrics;
+    std::atomic<MainThreadDispatcher*> m_callbackDispatcher{nullptr};
 
     // Callback (protected by m_callbackMutex)
     std::function<void(const ISSPosition&)> m_callback;
     mutable std::mutex m_callbackMutex;
 
+    // Playback state carried between replay ticks
+    struct ReplayCursor {
+        std::shared_ptr<const TrackReplay> replay;
+        double sessionTime = 0.0;
+        size_t cursor = 0;
+        std::chrono::steady_clock::time_point lastTick;
+    };
+
+    static constexpr std::chrono::milliseconds REPLAY_TICK{16};
+
     // Internal methods
-    void TrackingLoop(const std::stop_token& stopToken);
-    ISSPosition FetchPositionImpl();
-    std::string FetchJSON(const std::string& url);
-    ISSPosition ParseJSON(const std::string& jsonResponse);
+    AsyncTask<void> TrackLoop(std::stop_token stopToken);
+    void ReplayTick(const std::stop_token& stopToken, ReplayCursor& state);
+    void StopTaskLocked();
+    void PublishPosition(const ISSPosition& position);
+    void InvokeCallback(const ISSPosition& position);
+    void RunCallback(const ISSPosition& position);
+    void RebuildHistoryFromReplay(const TrackReplay& replay, size_t sampleCount);
+    void RecordResponse(const std::string& jsonResponse);
     void AddToHistory(const ISSPosition& position);
 };
 
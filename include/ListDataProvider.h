@@ -0,0 +1,65 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Items shown by a list dialog, read on demand
+ *
+ * The dialog only asks for the rows it draws (and, while filtering, for the rows it has
+ * not indexed yet), so a provider can generate or look up items lazily instead of
+ * materializing the whole list. Items must not change while a dialog shows them;
+ * items appended at the end are picked up.
+ */
+class ListDataProvider {
+public:
+    virtual ~ListDataProvider() = default;
+
+    [[nodiscard]] virtual size_t GetCount() const = 0;
+
+    // Null-terminated text of item index (< GetCount()), valid until the next call
+    [[nodiscard]] virtual const char* GetItem(size_t index) const = 0;
+};
+
+/**
+ * @brief List dialog items held in a vector of strings
+ */
+class VectorListDataProvider : public ListDataProvider {
+public:
+    explicit VectorListDataProvider(std::vector<std::string> items) : m_items(std::move(items)) {}
+
+    [[nodiscard]] size_t GetCount() const override {
+        return m_items.size();
+    }
+
+    [[nodiscard]] const char* GetItem(size_t index) const override {
+        return m_items[index].c_str();
+    }
+
+private:
+    std::vector<std::string> m_items;
+};
+
+} // namespace MetaImGUI
@@ -0,0 +1,90 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace MetaImGUI {
+
+class ListDataProvider;
+
+/**
+ * @brief Incremental type-ahead filter over a ListDataProvider
+ *
+ * Matches items containing the query as a case-insensitive (ASCII) substring. Nothing is
+ * done up front: each Step() call folds a bounded number of items into a contiguous
+ * lower-case index and tests a bounded number of items against the query, so a dialog
+ * over millions of items opens at once and stays responsive while typing. Rows are in
+ * item order; matches appear as the scan progresses.
+ *
+ * A query that contains the previous one (typically one more character) only re-tests
+ * the previous matches instead of rescanning the list.
+ *
+ * The provider must outlive the filter.
+ */
+class ListFilter {
+public:
+    explicit ListFilter(const ListDataProvider& provider);
+
+    void SetQuery(std::string_view query);
+    [[nodiscard]] const std::string& GetQuery() const {
+        return m_query;
+    }
+
+    /**
+     * @brief Index and match up to budget items
+     * @return True once every item is indexed and the query fully evaluated
+     */
+    bool Step(size_t budget);
+
+    [[nodiscard]] bool IsComplete() const;
+
+    // Rows to display: every item without a query, otherwise the matches found so far
+    [[nodiscard]] size_t GetRowCount() const;
+    [[nodiscard]] size_t GetItemIndex(size_t row) const;
+
+    // Items folded into the index so far
+    [[nodiscard]] size_t GetIndexedCount() const {
+        return m_offsets.size() - 1;
+    }
+
+    // Items the current query has been evaluated against
+    [[nodiscard]] size_t GetScannedCount() const {
+        return m_scanned;
+    }
+
+private:
+    [[nodiscard]] bool Matches(size_t index) const;
+
+    const ListDataProvider& m_provider;
+
+    std::string m_folded;          // Lower-cased text of items [0, indexed), back to back
+    std::vector<size_t> m_offsets; // Start of each item in m_folded, plus the end
+
+    std::string m_query;              // Lower-cased
+    std::vector<size_t> m_matches;    // Matching items in [0, m_scanned), ascending
+    std::vector<size_t> m_candidates; // Matches of a broader query still to re-test
+    size_t m_nextCandidate = 0;
+    size_t m_scanned = 0;
+};
+
+} // namespace MetaImGUI
@@ -18,8 +18,11 @@
 
 #pragma once
 
+#include <functional>
 #include <map>
+#include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace MetaImGUI {
@@ -55,7 +58,7 @@ public:
     /**
      * @brief Get current language code
      */
-    [[nodiscard]] std::string GetCurrentLanguage() const;
+    [[nodiscard]] const std::string& GetCurrentLanguage() const;
 
     /**
      * @brief Get list of available languages
@@ -66,8 +69,11 @@ public:
      * @brief Get translated string
      * @param key Translation key
      * @return Translated string (or key if not found)
+     *
+     * Returns a reference into the translation table, which stays valid for the lifetime of
+     * the instance, so per-frame UI lookups do not copy.
      */
-    [[nodiscard]] std::string Tr(const std::string& key) const;
+    [[nodiscard]] const std::string& Tr(std::string_view key) const;
 
     /**
      * @brief Add translation for a language
@@ -88,8 +94,11 @@ private:
     Localization();
     ~Localization() = default;
 
+    using Table = std::map<std::string, std::string, std::less<>>;
+
     std::string m_currentLanguage;
-    std::map<std::string, std::map<std::string, std::string>> m_translations; // [language][key] = value
+    std::map<std::string, Table, std::less<>> m_translations; // [language][key] = value
+    mutable std::set<std::string, std::less<>> m_missingKeys; // Keys returned as-is, kept for Tr()'s reference
 };
 
 } // namespace MetaImGUI
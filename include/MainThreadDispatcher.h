@@ -0,0 +1,290 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Move-only `void()` callable stored inline, never on the heap
+ *
+ * Callables larger than StorageSize fail to compile rather than silently allocating.
+ * Capture a pointer or a std::unique_ptr for larger payloads.
+ */
+template <size_t StorageSize>
+class InlineTask {
+public:
+    InlineTask() noexcept = default;
+
+    template <typename F>
+        requires(!std::same_as<std::remove_cvref_t<F>, InlineTask> && std::invocable<std::remove_cvref_t<F>&>)
+    InlineTask(F&& function) { // NOLINT(google-explicit-constructor) - implicit for Post([..] {..})
+        using Fn = std::remove_cvref_t<F>;
+        static_assert(sizeof(Fn) <= StorageSize, "Callable too large for InlineTask storage");
+        static_assert(alignof(Fn) <= alignof(std::max_align_t), "Callable over-aligned for InlineTask storage");
+        static_assert(std::is_nothrow_move_constructible_v<Fn>, "InlineTask callables must be nothrow movable");
+
+        ::new (static_cast<void*>(m_storage.data())) Fn(std::forward<F>(function));
+        m_ops = &OPS<Fn>;
+    }
+
+    InlineTask(InlineTask&& other) noexcept {
+        MoveFrom(other);
+    }
+
+    InlineTask& operator=(InlineTask&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    InlineTask(const InlineTask&) = delete;
+    InlineTask& operator=(const InlineTask&) = delete;
+
+    ~InlineTask() {
+        Reset();
+    }
+
+    explicit operator bool() const noexcept {
+        return m_ops != nullptr;
+    }
+
+    void operator()() {
+        m_ops->invoke(m_storage.data());
+    }
+
+    void Reset() noexcept {
+        if (m_ops != nullptr) {
+            m_ops->destroy(m_storage.data());
+            m_ops = nullptr;
+        }
+    }
+
+private:
+    struct Ops {
+        void (*invoke)(void* self);
+        void (*move)(void* destination, void* source) noexcept;
+        void (*destroy)(void* self) noexcept;
+    };
+
+    template <typename Fn>
+    static constexpr Ops OPS = {
+        [](void* self) { (*static_cast<Fn*>(self))(); },
+        [](void* destination, void* source) noexcept {
+            ::new (destination) Fn(std::move(*static_cast<Fn*>(source)));
+            static_cast<Fn*>(source)->~Fn();
+        },
+        [](void* self) noexcept { static_cast<Fn*>(self)->~Fn(); },
+    };
+
+    void MoveFrom(InlineTask& other) noexcept {
+        if (other.m_ops != nullptr) {
+            other.m_ops->move(m_storage.data(), other.m_storage.data());
+            m_ops = std::exchange(other.m_ops, nullptr);
+        }
+    }
+
+    alignas(std::max_align_t) std::array<std::byte, StorageSize> m_storage{};
+    const Ops* m_ops = nullptr;
+};
+
+/**
+ * @brief Runs work posted from any thread on the main (render) thread
+ *
+ * Producers push into a bounded lock-free ring (multi-producer, single-consumer);
+ * the main thread drains it once per frame within a time budget. Posting never
+ * allocates or blocks; it fails if the ring is full, and the drop is counted.
+ *
+ * @code
+ * dispatcher.Post([this, position] { OnPosition(position); }); // any thread
+ * dispatcher.Drain(std::chrono::milliseconds(2));               // main thread, per frame
+ * @endcode
+ */
+class MainThreadDispatcher {
+public:
+    static constexpr size_t TASK_STORAGE_SIZE = 64;
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    using Task = InlineTask<TASK_STORAGE_SIZE>;
+
+    /**
+     * @param capacity Maximum queued tasks, rounded up to a power of two
+     */
+    explicit MainThreadDispatcher(size_t capacity = DEFAULT_CAPACITY);
+    ~MainThreadDispatcher();
+
+    MainThreadDispatcher(const MainThreadDispatcher&) = delete;
+    MainThreadDispatcher& operator=(const MainThreadDispatcher&) = delete;
+    MainThreadDispatcher(MainThreadDispatcher&&) = delete;
+    MainThreadDispatcher& operator=(MainThreadDispatcher&&) = delete;
+
+    /**
+     * @brief Queue a task for the main thread (thread-safe, lock-free)
+     * @return false if the queue is full and the task was dropped
+     */
+    bool Post(Task task);
+
+    /**
+     * @brief Run queued tasks on the calling (main) thread
+     *
+     * At least one task runs if any is queued; further tasks run until the queue is
+     * empty or the budget is spent. Exceptions from tasks are logged and swallowed.
+     *
+     * @return Number of tasks run
+     */
+    size_t Drain(std::chrono::microseconds budget);
+
+    /**
+     * @brief Awaitable that continues the awaiting coroutine on the main thread
+     *
+     * The coroutine resumes during the next Drain(), and co_await yields true. If the queue
+     * is full it does not wait for room: the coroutine continues at once on the calling thread
+     * and co_await yields false, so the caller decides what to do off the main thread. Neither
+     * outcome counts as a drop.
+     *
+     * @code
+     * if (!co_await dispatcher.Schedule()) {
+     *     co_return; // Still on the worker
+     * }
+     * @endcode
+     */
+    [[nodiscard]] auto Schedule() {
+        struct Awaiter {
+            MainThreadDispatcher* dispatcher;
+            bool scheduled = true; // Written before posting: once posted the main thread may resume
+
+            [[nodiscard]] bool await_ready() const noexcept {
+                return false;
+            }
+            bool await_suspend(std::coroutine_handle<> handle) {
+                Task resume([handle] { handle.resume(); });
+                if (dispatcher->Push(resume)) {
+                    return true;
+                }
+                scheduled = false;
+                return false;
+            }
+            [[nodiscard]] bool await_resume() const noexcept {
+                return scheduled;
+            }
+        };
+        return Awaiter{this};
+    }
+
+    /**
+     * @brief Destroy all queued tasks without running them (main thread)
+     *
+     * Call after every producer thread has been joined, before the objects tasks
+     * refer to are destroyed.
+     */
+    void Clear();
+
+    /**
+     * @brief Number of tasks rejected because the queue was full
+     */
+    [[nodiscard]] size_t GetDroppedCount() const {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] size_t GetCapacity() const {
+        return m_mask + 1;
+    }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        Task task;
+    };
+
+    // Post() without counting a drop; task is left untouched on failure
+    bool Push(Task& task);
+    bool TryPop(Task& task);
+
+    std::unique_ptr<Slot[]> m_slots; // NOLINT(cppcoreguidelines-avoid-c-arrays) - fixed ring
+    size_t m_mask;
+
+    // Producers and the consumer touch different cache lines
+    alignas(64) std::atomic<size_t> m_enqueuePos{0};
+    alignas(64) size_t m_dequeuePos = 0; // Main thread only
+    std::atomic<size_t> m_dropped{0};
+};
+
+/**
+ * @brief Latest-value mailbox from worker threads to the main thread that never drops
+ *
+ * For results that must arrive even when the dispatcher's ring is full, such as a finished
+ * update check or download. Publish() stores the value (replacing one not yet taken); the
+ * main thread calls Consume() once per frame. Values are swapped between two buffers rather
+ * than moved out, so a slot reused for the same kind of result stops allocating once its
+ * strings and containers have grown to size.
+ */
+template <typename T>
+class MainThreadSlot {
+public:
+    // Any thread
+    void Publish(const T& value) {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending = value;
+        m_ready.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Run handler on the published value, if there is one (main thread)
+     * @param handler Called with a T& it may modify or swap from
+     * @return True if a value was delivered
+     */
+    template <typename Handler>
+    bool Consume(Handler&& handler) {
+        if (!m_ready.load(std::memory_order_acquire)) {
+            return false;
+        }
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            std::swap(m_pending, m_delivered);
+            m_ready.store(false, std::memory_order_relaxed);
+        }
+        std::forward<Handler>(handler)(m_delivered);
+        return true;
+    }
+
+    [[nodiscard]] bool HasValue() const {
+        return m_ready.load(std::memory_order_acquire);
+    }
+
+private:
+    std::mutex m_mutex;
+    T m_pending{};
+    T m_delivered{}; // Main thread only
+    std::atomic<bool> m_ready{false};
+};
+
+} // namespace MetaImGUI
@@ -0,0 +1,167 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace MetaImGUI {
+
+// Inline style flags of a span; they combine, e.g. bold text inside a link
+struct MarkdownStyle {
+    static constexpr uint8_t PLAIN = 0;
+    static constexpr uint8_t STRONG = 1 << 0;
+    static constexpr uint8_t EMPHASIS = 1 << 1;
+    static constexpr uint8_t CODE = 1 << 2;
+    static constexpr uint8_t LINK = 1 << 3;
+};
+
+enum class MarkdownBlockType : uint8_t {
+    Paragraph,
+    Heading,   // level 1-6
+    ListItem,  // level = nesting depth from 0; number = 0 for a bullet
+    Quote,
+    CodeBlock, // Text keeps its line breaks
+    Rule,
+};
+
+// A run of text in one style; offset and length index the document's text buffer
+struct MarkdownSpan {
+    uint32_t offset = 0;
+    uint32_t length = 0;
+    uint8_t style = MarkdownStyle::PLAIN;
+    int32_t link = -1; // Index into GetLinks() when style has MarkdownStyle::LINK
+};
+
+struct MarkdownBlock {
+    MarkdownBlockType type = MarkdownBlockType::Paragraph;
+    uint8_t level = 0;
+    uint32_t number = 0;
+    uint32_t firstSpan = 0;
+    uint32_t spanCount = 0;
+};
+
+// Font measurements the layout is computed with, supplied by the renderer
+struct MarkdownMetrics {
+    // Width of text in the given style at fontScale times the base font size; context is passed through.
+    // A plain function pointer, so the renderer can fill this in every frame without constructing a callable.
+    float (*measure)(const void* context, std::string_view text, uint8_t style, float fontScale) = nullptr;
+    const void* context = nullptr;
+    float lineHeight = 16.0f; // At fontScale 1
+    float indentWidth = 20.0f;
+    float blockSpacing = 6.0f;
+};
+
+// One piece of a laid-out line; x is relative to the left edge of the text area
+struct MarkdownRun {
+    uint32_t offset = 0;
+    uint32_t length = 0;
+    uint8_t style = MarkdownStyle::PLAIN;
+    int32_t link = -1;
+    float x = 0.0f;
+    float width = 0.0f;
+};
+
+struct MarkdownLine {
+    float y = 0.0f;
+    float height = 0.0f;
+    float fontScale = 1.0f;
+    uint32_t block = 0;
+    uint32_t firstRun = 0;
+    uint32_t runCount = 0;
+    bool firstOfBlock = false; // Where list markers go
+};
+
+struct MarkdownLayout {
+    float width = 0.0f;
+    uint64_t fontKey = 0;
+    float height = 0.0f;
+    std::vector<MarkdownLine> lines;
+    std::vector<MarkdownRun> runs;
+};
+
+/**
+ * @brief Markdown parsed once into a flat block/span tree, with a cached line layout
+ *
+ * Covers what release notes use: ATX headings, paragraphs, bullet and numbered lists,
+ * quotes, fenced code, rules, and inline strong, emphasis, code and links (including
+ * bare URLs). All span text lives in one buffer that spans index into.
+ *
+ * Layout() word-wraps the document to a width and caches the result. It is rebuilt only
+ * when the width or the caller's font key changes, so rendering an unchanged document is
+ * a walk over precomputed runs rather than a re-wrap of the whole text each frame.
+ */
+class MarkdownDocument {
+public:
+    MarkdownDocument() = default;
+    explicit MarkdownDocument(std::string_view markdown);
+
+    // Replace the document; the cached layout is dropped
+    void Parse(std::string_view markdown);
+
+    /**
+     * @brief The document wrapped to width, recomputed only if width or fontKey changed
+     * @param fontKey Identifies the font and size the metrics measure; a change forces a relayout
+     */
+    const MarkdownLayout& Layout(float width, uint64_t fontKey, const MarkdownMetrics& metrics);
+
+    // Drop the cached layout so the next Layout() call recomputes it
+    void InvalidateLayout();
+
+    [[nodiscard]] const std::vector<MarkdownBlock>& GetBlocks() const {
+        return m_blocks;
+    }
+    [[nodiscard]] const std::vector<MarkdownSpan>& GetSpans() const {
+        return m_spans;
+    }
+    [[nodiscard]] const std::vector<std::string>& GetLinks() const {
+        return m_links;
+    }
+    [[nodiscard]] std::string_view GetText(uint32_t offset, uint32_t length) const {
+        return std::string_view(m_text).substr(offset, length);
+    }
+
+    // Number of times the layout has been computed, for tests and diagnostics
+    [[nodiscard]] uint64_t GetLayoutCount() const {
+        return m_layoutCount;
+    }
+
+    // Font scale for headings of a level, relative to body text
+    static float HeadingScale(uint8_t level);
+
+private:
+    void AddBlock(MarkdownBlockType type, uint8_t level, uint32_t number, std::string_view inlineText);
+    // Link labels are parsed again with the link's style and index
+    void ParseInline(std::string_view text, uint8_t baseStyle = MarkdownStyle::PLAIN, int32_t link = -1);
+    void AppendSpan(std::string_view text, uint8_t style, int32_t link);
+    void ComputeLayout(float width, const MarkdownMetrics& metrics);
+
+    std::string m_text;
+    std::vector<MarkdownBlock> m_blocks;
+    std::vector<MarkdownSpan> m_spans;
+    std::vector<std::string> m_links;
+
+    MarkdownLayout m_layout;
+    bool m_layoutValid = false;
+    uint64_t m_layoutCount = 0;
+};
+
+} // namespace MetaImGUI
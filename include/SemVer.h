@@ -0,0 +1,229 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Semantic version (SemVer 2.0.0) parsed without allocating
+ *
+ * Parsing and comparison are constexpr, so versions known at compile time (such as
+ * Version::VERSION) can be validated with static_assert. The pre-release and build
+ * strings are views into the parsed text, which must outlive the SemVer.
+ *
+ * Precedence follows the specification: the core version compares numerically, a
+ * pre-release ranks below the same release, pre-release identifiers compare
+ * numerically or in ASCII order (numeric below alphanumeric, fewer identifiers lower),
+ * and build metadata is ignored. The ordering is weak: 1.0.0+a and 1.0.0+b are equivalent
+ * in precedence, and compare ==, without being the same version.
+ *
+ * @code
+ * static_assert(SemVer::Parse("1.2.3-rc.1") < SemVer::Parse("1.2.3"));
+ * @endcode
+ */
+class SemVer {
+public:
+    // Core components are packed 21 bits each into PackedKey()
+    static constexpr uint32_t MAX_COMPONENT = (1u << 21) - 1;
+
+    uint32_t major = 0;
+    uint32_t minor = 0;
+    uint32_t patch = 0;
+    std::string_view preRelease; // Without the leading '-'; empty for a release
+    std::string_view build;      // Without the leading '+'
+
+    /**
+     * @brief Parse a version
+     *
+     * Also accepts the forms used in release tags: a leading 'v' or 'V', and omitted
+     * minor or patch components ("1.2" is 1.2.0).
+     *
+     * @return nullopt if the text is not a valid version, including components above MAX_COMPONENT
+     */
+    static constexpr std::optional<SemVer> Parse(std::string_view text) noexcept {
+        if (!text.empty() && (text.front() == 'v' || text.front() == 'V')) {
+            text.remove_prefix(1);
+        }
+
+        SemVer version;
+        if (const size_t plus = text.find('+'); plus != std::string_view::npos) {
+            version.build = text.substr(plus + 1);
+            text = text.substr(0, plus);
+            if (!ValidIdentifiers(version.build, false)) {
+                return std::nullopt;
+            }
+        }
+        if (const size_t dash = text.find('-'); dash != std::string_view::npos) {
+            version.preRelease = text.substr(dash + 1);
+            text = text.substr(0, dash);
+            if (!ValidIdentifiers(version.preRelease, true)) {
+                return std::nullopt;
+            }
+        }
+
+        uint32_t* const components[] = {&version.major, &version.minor, &version.patch};
+        size_t count = 0;
+        while (count < 3) {
+            const size_t dot = text.find('.');
+            const std::optional<uint32_t> value = ParseNumber(text.substr(0, dot));
+            if (!value || *value > MAX_COMPONENT) {
+                return std::nullopt;
+            }
+            *components[count++] = *value;
+            if (dot == std::string_view::npos) {
+                return version;
+            }
+            text.remove_prefix(dot + 1);
+        }
+        return std::nullopt; // More than three components
+    }
+
+    /**
+     * @brief Key ordering versions by core precedence
+     *
+     * major, minor and patch occupy 21 bits each above a bit set for releases, so
+     * comparing keys orders versions correctly except between two pre-releases of the
+     * same core version, which need their identifiers compared.
+     */
+    [[nodiscard]] constexpr uint64_t PackedKey() const noexcept {
+        return (uint64_t{major} << 43) | (uint64_t{minor} << 22) | (uint64_t{patch} << 1) |
+               (preRelease.empty() ? 1u : 0u);
+    }
+
+    [[nodiscard]] constexpr bool IsPreRelease() const noexcept {
+        return !preRelease.empty();
+    }
+
+    friend constexpr std::weak_ordering operator<=>(const SemVer& a, const SemVer& b) noexcept {
+        const uint64_t keyA = a.PackedKey();
+        const uint64_t keyB = b.PackedKey();
+        if (keyA != keyB || !a.IsPreRelease()) {
+            return keyA <=> keyB;
+        }
+        return ComparePreRelease(a.preRelease, b.preRelease);
+    }
+
+    friend constexpr bool operator==(const SemVer& a, const SemVer& b) noexcept {
+        return (a <=> b) == 0;
+    }
+
+private:
+    static constexpr bool IsDigit(char c) noexcept {
+        return c >= '0' && c <= '9';
+    }
+
+    static constexpr bool IsIdentifierChar(char c) noexcept {
+        return IsDigit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '-';
+    }
+
+    // std::from_chars is not constexpr until C++23, so digits are accumulated by hand
+    static constexpr std::optional<uint32_t> ParseNumber(std::string_view digits) noexcept {
+        if (digits.empty() || (digits.size() > 1 && digits.front() == '0')) {
+            return std::nullopt;
+        }
+        uint64_t value = 0;
+        for (const char c : digits) {
+            if (!IsDigit(c)) {
+                return std::nullopt;
+            }
+            value = value * 10 + static_cast<uint64_t>(c - '0');
+            if (value > UINT32_MAX) {
+                return std::nullopt;
+            }
+        }
+        return static_cast<uint32_t>(value);
+    }
+
+    static constexpr bool IsNumeric(std::string_view identifier) noexcept {
+        for (const char c : identifier) {
+            if (!IsDigit(c)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Dot-separated, non-empty [0-9A-Za-z-] identifiers; pre-release numerics may not have leading zeros
+    static constexpr bool ValidIdentifiers(std::string_view text, bool rejectLeadingZeros) noexcept {
+        for (;;) {
+            const size_t dot = text.find('.');
+            const std::string_view identifier = text.substr(0, dot);
+            if (identifier.empty()) {
+                return false;
+            }
+            for (const char c : identifier) {
+                if (!IsIdentifierChar(c)) {
+                    return false;
+                }
+            }
+            if (rejectLeadingZeros && identifier.size() > 1 && identifier.front() == '0' && IsNumeric(identifier)) {
+                return false;
+            }
+            if (dot == std::string_view::npos) {
+                return true;
+            }
+            text.remove_prefix(dot + 1);
+        }
+    }
+
+    static constexpr std::weak_ordering CompareIdentifier(std::string_view a, std::string_view b) noexcept {
+        const bool numericA = IsNumeric(a);
+        const bool numericB = IsNumeric(b);
+        if (numericA && numericB) {
+            // No leading zeros, so a longer number is larger; equal lengths compare as text
+            if (a.size() != b.size()) {
+                return a.size() <=> b.size();
+            }
+        } else if (numericA != numericB) {
+            return numericA ? std::weak_ordering::less : std::weak_ordering::greater;
+        }
+        const int result = a.compare(b);
+        return (result < 0) ? std::weak_ordering::less
+                            : ((result > 0) ? std::weak_ordering::greater : std::weak_ordering::equivalent);
+    }
+
+    static constexpr std::weak_ordering ComparePreRelease(std::string_view a, std::string_view b) noexcept {
+        for (;;) {
+            const size_t dotA = a.find('.');
+            const size_t dotB = b.find('.');
+            if (const auto order = CompareIdentifier(a.substr(0, dotA), b.substr(0, dotB)); order != 0) {
+                return order;
+            }
+            const bool endA = (dotA == std::string_view::npos);
+            const bool endB = (dotB == std::string_view::npos);
+            if (endA || endB) {
+                // The version with more identifiers ranks higher
+                if (endA && endB) {
+                    return std::weak_ordering::equivalent;
+                }
+                return endA ? std::weak_ordering::less : std::weak_ordering::greater;
+            }
+            a.remove_prefix(dotA + 1);
+            b.remove_prefix(dotB + 1);
+        }
+    }
+};
+
+} // namespace MetaImGUI
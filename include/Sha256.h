@@ -0,0 +1,95 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Incremental SHA-256 (FIPS 180-4)
+ *
+ * Data can be fed in chunks of any size as it arrives, so a download is verified
+ * while it streams to disk instead of being read back afterwards.
+ *
+ * @code
+ * Sha256 hash;
+ * hash.Update(chunk1);
+ * hash.Update(chunk2);
+ * const std::string hex = Sha256::ToHex(hash.Finish());
+ * @endcode
+ */
+class Sha256 {
+public:
+    static constexpr size_t DIGEST_SIZE = 32;
+    static constexpr size_t BLOCK_SIZE = 64;
+
+    using Digest = std::array<uint8_t, DIGEST_SIZE>;
+
+    Sha256() noexcept;
+
+    /**
+     * @brief Hash the next chunk of input
+     */
+    void Update(std::string_view data) noexcept;
+
+    /**
+     * @brief Complete the hash and return the digest
+     *
+     * The hasher is reset afterwards and can be reused for new input.
+     */
+    [[nodiscard]] Digest Finish() noexcept;
+
+    /**
+     * @brief Discard all input hashed so far
+     */
+    void Reset() noexcept;
+
+    /**
+     * @brief Number of bytes hashed since the last reset
+     */
+    [[nodiscard]] uint64_t GetByteCount() const noexcept {
+        return m_byteCount;
+    }
+
+    /**
+     * @brief Lower-case hexadecimal form of a digest
+     */
+    static std::string ToHex(const Digest& digest);
+
+    /**
+     * @brief Hash a complete buffer
+     * @return Lower-case hexadecimal digest
+     */
+    static std::string HashHex(std::string_view data);
+
+private:
+    void ProcessBlock(const uint8_t* block) noexcept;
+
+    std::array<uint32_t, 8> m_state{};
+    std::array<uint8_t, BLOCK_SIZE> m_buffer{};
+    size_t m_bufferSize = 0;
+    uint64_t m_byteCount = 0;
+};
+
+} // namespace MetaImGUI
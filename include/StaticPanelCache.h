@@ -0,0 +1,113 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace MetaImGUI {
+
+// Everything the recorded vertices depend on; a panel is replayed only while its key is unchanged
+struct StaticPanelKey {
+    std::array<float, 4> rect{};     // Screen-space origin and available size
+    std::array<float, 4> clipRect{}; // Text outside the clip rect is not emitted at all
+    uint64_t styleHash = 0;          // Colours and alpha baked into the vertices
+    uint64_t fontHash = 0;           // Font, size and atlas texture the glyph UVs refer to
+    uint64_t languageHash = 0;
+
+    bool operator==(const StaticPanelKey&) const = default;
+};
+
+// One recorded vertex, laid out like ImDrawVert (position, UV, packed colour)
+struct StaticPanelVertex {
+    float x = 0.0f;
+    float y = 0.0f;
+    float u = 0.0f;
+    float v = 0.0f;
+    uint32_t color = 0;
+};
+
+/**
+ * @brief Retained draw geometry for UI panels whose contents do not change
+ *
+ * Panels made only of static text (the About window, the welcome text) are rebuilt by
+ * ImGui every frame: formatted, measured and tessellated glyph by glyph. The renderer
+ * records the vertices and indices such a panel appends to its draw list once, stores
+ * them here under the panel's id and key, and on later frames copies them back into the
+ * draw list instead of submitting the items again.
+ *
+ * The cache itself knows nothing about ImGui; UIRenderer builds the keys and moves the
+ * geometry in and out of draw lists.
+ */
+class StaticPanelCache {
+public:
+    struct Geometry {
+        std::vector<StaticPanelVertex> vertices;
+        std::vector<uint32_t> indices; // Relative to the first vertex
+        float width = 0.0f;            // Layout size the panel occupies
+        float height = 0.0f;
+    };
+
+    /**
+     * @brief Recorded geometry for a panel, or nullptr if it must be drawn (and recorded) again
+     *
+     * Counts a hit or a miss.
+     */
+    const Geometry* Find(std::string_view id, const StaticPanelKey& key);
+
+    /**
+     * @brief Empty geometry to fill with a new recording of the panel under key
+     */
+    Geometry& Record(std::string_view id, const StaticPanelKey& key);
+
+    // Forget a panel, e.g. when its recording could not be captured
+    void Discard(std::string_view id);
+
+    void Clear();
+
+    [[nodiscard]] size_t GetPanelCount() const {
+        return m_panels.size();
+    }
+    [[nodiscard]] uint64_t GetHits() const {
+        return m_hits;
+    }
+    [[nodiscard]] uint64_t GetMisses() const {
+        return m_misses;
+    }
+
+    // FNV-1a over raw bytes, for folding key components into the hashes above
+    static uint64_t Hash(const void* data, size_t size, uint64_t seed = 14695981039346656037ULL);
+
+private:
+    struct Entry {
+        StaticPanelKey key;
+        Geometry geometry;
+    };
+
+    std::map<std::string, Entry, std::less<>> m_panels;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+};
+
+} // namespace MetaImGUI
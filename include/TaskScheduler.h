@@ -0,0 +1,243 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "AsyncTask.h"
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stop_token>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Scheduling priority; higher priority work is always picked first
+ */
+enum class TaskPriority : uint8_t {
+    High = 0,
+    Normal = 1,
+    Low = 2,
+};
+
+namespace detail {
+struct TaskState;
+class SchedulerCore;
+} // namespace detail
+
+/**
+ * @brief Handle to a scheduled task
+ *
+ * Handles are cheap to copy. Dropping a handle does not cancel the task.
+ */
+class TaskHandle {
+public:
+    TaskHandle() = default;
+
+    /**
+     * @brief Request cancellation
+     *
+     * A task that has not started yet will not run; a running task sees its stop_token
+     * signalled; a periodic task is not rescheduled.
+     */
+    void Cancel() const;
+
+    /**
+     * @brief Block until the task has finished (periodic: cancelled and not running)
+     * @note Must not be called from inside the task itself
+     */
+    void Wait() const;
+
+    /**
+     * @brief Check if the task has finished or was cancelled before running
+     */
+    [[nodiscard]] bool IsDone() const;
+
+    /**
+     * @brief Change the delay between runs of a periodic task, from the next run on
+     */
+    void SetPeriod(std::chrono::steady_clock::duration period) const;
+
+    [[nodiscard]] bool Valid() const {
+        return m_state != nullptr;
+    }
+
+private:
+    friend class TaskScheduler;
+    explicit TaskHandle(std::shared_ptr<detail::TaskState> state) : m_state(std::move(state)) {}
+
+    std::shared_ptr<detail::TaskState> m_state;
+};
+
+/**
+ * @brief Shared pool of background worker threads
+ *
+ * Replaces ad-hoc per-component threads with a bounded set of workers:
+ * - Each worker owns a queue per priority; idle workers steal from the others
+ * - Delayed and periodic tasks are kept in a timer queue serviced by the workers
+ * - Every task receives a std::stop_token tied to its TaskHandle
+ *
+ * Tasks may block (e.g. on network I/O) but then occupy a worker while they do.
+ * Coroutines avoid that: Spawn() runs an AsyncTask whose handle completes when the
+ * coroutine does, and Schedule()/SleepFor() continue a coroutine on the workers.
+ *
+ * @code
+ * auto handle = TaskScheduler::Instance().SchedulePeriodic(std::chrono::seconds(5),
+ *     [](std::stop_token stopToken) { Poll(stopToken); });
+ * handle.Cancel();
+ * handle.Wait();
+ * @endcode
+ */
+class TaskScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Function = std::function<void(std::stop_token)>;
+
+    /**
+     * @param threadCount Number of workers; 0 uses DefaultThreadCount()
+     */
+    explicit TaskScheduler(size_t threadCount = 0);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+    TaskScheduler(TaskScheduler&&) = delete;
+    TaskScheduler& operator=(TaskScheduler&&) = delete;
+
+    /**
+     * @brief Application-wide scheduler, created on first use
+     */
+    static TaskScheduler& Instance();
+
+    /**
+     * @brief Set the worker count Instance() is created with
+     * @note Only effective before the first Instance() call
+     */
+    static void Configure(size_t threadCount);
+
+    /**
+     * @brief Hardware threads minus one (for the main thread), clamped to [2, 8]
+     */
+    static size_t DefaultThreadCount();
+
+    /**
+     * @brief Run a task as soon as a worker is free
+     */
+    TaskHandle Submit(Function function, TaskPriority priority = TaskPriority::Normal);
+
+    /**
+     * @brief Run a task once after a delay
+     */
+    TaskHandle ScheduleAfter(Clock::duration delay, Function function, TaskPriority priority = TaskPriority::Normal);
+
+    /**
+     * @brief Run a task repeatedly until cancelled
+     *
+     * The period is measured from the end of one run to the start of the next, so a
+     * slow run never overlaps with the following one.
+     *
+     * @param period Delay between runs
+     * @param function Task body
+     * @param priority Scheduling priority
+     * @param initialDelay Delay before the first run
+     */
+    TaskHandle SchedulePeriodic(Clock::duration period, Function function, TaskPriority priority = TaskPriority::Normal,
+                                Clock::duration initialDelay = Clock::duration::zero());
+
+    /**
+     * @brief Run a coroutine, starting on a worker
+     *
+     * The returned handle completes when the coroutine finishes, wherever it was last
+     * resumed. Cancelling the handle signals the stop_token passed to the body.
+     */
+    TaskHandle Spawn(std::function<AsyncTask<void>(std::stop_token)> body,
+                     TaskPriority priority = TaskPriority::Normal);
+
+    /**
+     * @brief Awaitable that continues the awaiting coroutine on a worker
+     *
+     * Completes immediately when already on one of this scheduler's workers. After
+     * Shutdown() the coroutine continues on the calling thread instead.
+     */
+    [[nodiscard]] auto Schedule(TaskPriority priority = TaskPriority::Normal) {
+        struct Awaiter {
+            TaskScheduler* scheduler;
+            TaskPriority priority;
+
+            [[nodiscard]] bool await_ready() const {
+                return scheduler->IsWorkerThread();
+            }
+            [[nodiscard]] bool await_suspend(std::coroutine_handle<> handle) const {
+                return scheduler->Resume(handle, Clock::duration::zero(), {}, priority);
+            }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{this, priority};
+    }
+
+    /**
+     * @brief Awaitable that suspends the awaiting coroutine for a delay, then continues on a worker
+     *
+     * Ends early as soon as stopToken is signalled; no worker is occupied while waiting.
+     */
+    [[nodiscard]] auto SleepFor(Clock::duration delay, std::stop_token stopToken = {},
+                                TaskPriority priority = TaskPriority::Normal) {
+        struct Awaiter {
+            TaskScheduler* scheduler;
+            Clock::duration delay;
+            std::stop_token stopToken;
+            TaskPriority priority;
+
+            [[nodiscard]] bool await_ready() const {
+                return delay <= Clock::duration::zero() || stopToken.stop_requested();
+            }
+            [[nodiscard]] bool await_suspend(std::coroutine_handle<> handle) const {
+                return scheduler->Resume(handle, delay, stopToken, priority);
+            }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{this, delay, std::move(stopToken), priority};
+    }
+
+    /**
+     * @brief Check if the calling thread is one of this scheduler's workers
+     */
+    [[nodiscard]] bool IsWorkerThread() const;
+
+    /**
+     * @brief Cancel all pending work, signal running tasks and join the workers
+     *
+     * Safe to call multiple times. Tasks submitted afterwards are cancelled immediately.
+     */
+    void Shutdown();
+
+    [[nodiscard]] size_t GetThreadCount() const;
+
+private:
+    // Queue a coroutine resumption; false if the scheduler has shut down and the caller should continue inline
+    bool Resume(std::coroutine_handle<> handle, Clock::duration delay, std::stop_token stopToken,
+                TaskPriority priority);
+
+    std::shared_ptr<detail::SchedulerCore> m_core; // Shared so handles can reach it weakly
+};
+
+} // namespace MetaImGUI
@@ -0,0 +1,170 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Ground track history stored as structure-of-arrays with a level-of-detail pyramid
+ *
+ * Samples live in parallel longitude/latitude/timestamp arrays so they can be handed
+ * to ImPlot without repacking. Next to the raw samples, a min/max decimation pyramid
+ * is maintained incrementally as samples arrive: level N groups 4^N samples into one
+ * bucket and keeps the samples with the lowest and highest latitude, so the peaks of
+ * the ground track survive decimation. Readers pick the finest level that fits the
+ * number of pixels they have to fill, so drawing cost tracks screen resolution rather
+ * than history length.
+ *
+ * The track is also split into segments wherever longitude wraps across the
+ * antimeridian. Segment starts are recorded as offsets while appending and no bucket
+ * spans a wrap, so renderers can draw one line per segment without scanning.
+ *
+ * Not thread-safe; the owner is expected to guard access.
+ */
+class TrackHistory {
+public:
+    /**
+     * @brief Construct an empty history
+     * @param capacity Number of most recent samples to retain
+     */
+    explicit TrackHistory(size_t capacity);
+
+    /**
+     * @brief Append a sample and update every pyramid level
+     *
+     * Amortized O(levels). When the history grows past its capacity plus some slack,
+     * the oldest samples are dropped in one batch and the pyramid is rebuilt.
+     */
+    void Append(double longitude, double latitude, long timestamp);
+
+    /**
+     * @brief Remove all samples
+     */
+    void Clear();
+
+    [[nodiscard]] size_t Size() const {
+        return m_longitudes.size();
+    }
+
+    [[nodiscard]] bool Empty() const {
+        return m_longitudes.empty();
+    }
+
+    [[nodiscard]] size_t GetCapacity() const {
+        return m_capacity;
+    }
+
+    [[nodiscard]] const std::vector<double>& GetLongitudes() const {
+        return m_longitudes;
+    }
+
+    [[nodiscard]] const std::vector<double>& GetLatitudes() const {
+        return m_latitudes;
+    }
+
+    [[nodiscard]] const std::vector<long>& GetTimestamps() const {
+        return m_timestamps;
+    }
+
+    /**
+     * @brief Offsets into the raw arrays where each antimeridian-free segment starts
+     */
+    [[nodiscard]] const std::vector<size_t>& GetSegmentStarts() const {
+        return m_segmentStarts;
+    }
+
+    /**
+     * @brief Number of levels, including the raw level 0
+     */
+    [[nodiscard]] size_t GetLevelCount() const {
+        return m_levels.size() + 1;
+    }
+
+    /**
+     * @brief Number of points CopyLevel() would produce for a level
+     */
+    [[nodiscard]] size_t GetLevelPointCount(size_t level) const;
+
+    /**
+     * @brief Pick the finest level whose point count fits in maxPoints
+     * @param maxPoints Point budget, typically derived from the plot's pixel width
+     * @return Level index; the coarsest level if none fits
+     */
+    [[nodiscard]] size_t SelectLevel(size_t maxPoints) const;
+
+    /**
+     * @brief Copy the samples of one level, oldest first
+     * @param level Level index from SelectLevel() (0 copies the raw samples)
+     * @param latitudes Output vector for latitude values
+     * @param longitudes Output vector for longitude values
+     */
+    void CopyLevel(size_t level, std::vector<double>& latitudes, std::vector<double>& longitudes) const;
+
+    /**
+     * @brief Copy the samples of one level along with its segment offsets
+     * @param segmentStarts Output offsets into latitudes/longitudes where each segment starts
+     */
+    void CopyLevel(size_t level, std::vector<double>& latitudes, std::vector<double>& longitudes,
+                   std::vector<size_t>& segmentStarts) const;
+
+    // As above, into polymorphic-allocator vectors (e.g. frame scratch memory)
+    void CopyLevel(size_t level, std::pmr::vector<double>& latitudes, std::pmr::vector<double>& longitudes,
+                   std::pmr::vector<size_t>& segmentStarts) const;
+
+    /**
+     * @brief Longitude jump (degrees) between consecutive samples treated as an antimeridian wrap
+     */
+    static constexpr double WRAP_THRESHOLD = 180.0;
+
+    /// Samples per bucket grow by this factor from one level to the next
+    static constexpr size_t LEVEL_FACTOR = 4;
+
+private:
+    struct Level {
+        size_t bucketSize = 0;
+        std::vector<uint32_t> indices; // Sample indices kept from closed buckets
+        std::vector<size_t> segmentStarts; // Offsets into indices where each segment starts
+        size_t bucketStart = 0;        // First sample of the open bucket
+        size_t minIndex = 0;           // Lowest latitude in the open bucket
+        size_t maxIndex = 0;           // Highest latitude in the open bucket
+    };
+
+    void IndexSample(size_t index);
+    static void CloseBucket(Level& level, size_t nextStart);
+    void RebuildLevels();
+    template <typename Visitor>
+    void ForEachLevelIndex(size_t level, Visitor&& visit) const;
+    template <typename DoubleVector, typename SizeVector>
+    void CopyLevelInto(size_t level, DoubleVector& latitudes, DoubleVector& longitudes,
+                       SizeVector* segmentStarts) const;
+
+    size_t m_capacity;
+    std::vector<double> m_longitudes;
+    std::vector<double> m_latitudes;
+    std::vector<long> m_timestamps;
+    std::vector<size_t> m_segmentStarts;
+    std::vector<Level> m_levels;
+};
+
+} // namespace MetaImGUI
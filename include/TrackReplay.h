@@ -0,0 +1,88 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "ISSTracker.h"
+
+#include <filesystem>
+#include <istream>
+#include <vector>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Pre-indexed recording of a tracker session for playback
+ *
+ * A session file is parsed exactly once on load. Two line formats are accepted and
+ * may be mixed:
+ * - Captured API responses, one JSON object per line (as written by ISSTracker recording)
+ * - History rows: `timestamp,latitude,longitude[,altitude,velocity]`
+ *
+ * Empty lines and lines starting with '#' are ignored. Samples are sorted by timestamp
+ * so playback can locate any point in time with a binary search.
+ */
+class TrackReplay {
+public:
+    /**
+     * @brief Load and index a session file
+     * @return true if at least one valid sample was read
+     */
+    bool Load(const std::filesystem::path& path);
+
+    /**
+     * @brief Load and index a session from a stream
+     * @return true if at least one valid sample was read
+     */
+    bool Load(std::istream& input);
+
+    [[nodiscard]] bool Empty() const {
+        return m_samples.empty();
+    }
+
+    [[nodiscard]] size_t GetSampleCount() const {
+        return m_samples.size();
+    }
+
+    [[nodiscard]] const ISSPosition& GetSample(size_t index) const {
+        return m_samples[index];
+    }
+
+    /**
+     * @brief Timestamp of the first sample (0 if empty)
+     */
+    [[nodiscard]] long GetStartTime() const;
+
+    /**
+     * @brief Timestamp of the last sample (0 if empty)
+     */
+    [[nodiscard]] long GetEndTime() const;
+
+    /**
+     * @brief Number of samples recorded at or before a point in time, O(log n)
+     */
+    [[nodiscard]] size_t CountUpTo(long timestamp) const;
+
+private:
+    static bool ParseHistoryRow(const std::string& line, ISSPosition& position);
+
+    std::vector<ISSPosition> m_samples;
+    std::vector<long> m_timestamps; // Sorted, parallel to m_samples
+};
+
+} // namespace MetaImGUI
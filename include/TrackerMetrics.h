@@ -0,0 +1,118 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace MetaImGUI {
+
+/**
+ * @brief Fixed-bucket histogram safe to record into from any thread
+ *
+ * Bucket i counts values whose bit width is i, i.e. [2^(i-1), 2^i), so the
+ * histogram spans 0 to 2^31 with constant memory and no locking. Recording is a
+ * handful of relaxed atomic adds; readers get an approximate but consistent-enough
+ * snapshot for display.
+ */
+class LatencyHistogram {
+public:
+    static constexpr size_t BUCKET_COUNT = 32;
+
+    struct Snapshot {
+        std::array<uint64_t, BUCKET_COUNT> buckets{};
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        uint64_t max = 0;
+
+        [[nodiscard]] double Mean() const;
+
+        /**
+         * @brief Upper bound of the bucket containing the given percentile
+         * @param percentile In [0, 100]
+         * @return 0 if empty; never more than the recorded maximum
+         */
+        [[nodiscard]] uint64_t Percentile(double percentile) const;
+    };
+
+    void Record(uint64_t value) noexcept {
+        const size_t bucket = (std::min)(static_cast<size_t>(std::bit_width(value)), BUCKET_COUNT - 1);
+        m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+
+        uint64_t previous = m_max.load(std::memory_order_relaxed);
+        while (value > previous && !m_max.compare_exchange_weak(previous, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    [[nodiscard]] Snapshot GetSnapshot() const;
+    void Reset() noexcept;
+
+    /**
+     * @brief Largest value counted in a bucket
+     */
+    static constexpr uint64_t BucketUpperBound(size_t bucket) {
+        return (bucket == 0) ? 0 : (uint64_t{1} << bucket) - 1;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> m_buckets{};
+    std::atomic<uint64_t> m_sum{0};
+    std::atomic<uint64_t> m_max{0};
+};
+
+/**
+ * @brief Throughput and latency counters for the ISS tracker pipeline
+ *
+ * Latencies are in microseconds; sample age is in milliseconds and measures how old
+ * a live fix already was (against its API timestamp) when it was published.
+ */
+class TrackerMetrics {
+public:
+    struct Snapshot {
+        LatencyHistogram::Snapshot fetchLatencyUs;
+        LatencyHistogram::Snapshot parseTimeUs;
+        LatencyHistogram::Snapshot callbackDurationUs;
+        LatencyHistogram::Snapshot sampleAgeMs;
+        uint64_t bytesReceived = 0;
+        uint64_t fetchSuccesses = 0;
+        uint64_t fetchFailures = 0;
+        uint64_t parseFailures = 0;
+        uint64_t callbacksDropped = 0;
+    };
+
+    LatencyHistogram fetchLatencyUs;
+    LatencyHistogram parseTimeUs;
+    LatencyHistogram callbackDurationUs;
+    LatencyHistogram sampleAgeMs;
+    std::atomic<uint64_t> bytesReceived{0};
+    std::atomic<uint64_t> fetchSuccesses{0};
+    std::atomic<uint64_t> fetchFailures{0};
+    std::atomic<uint64_t> parseFailures{0};
+    std::atomic<uint64_t> callbacksDropped{0};
+
+    [[nodiscard]] Snapshot GetSnapshot() const;
+    void Reset() noexcept;
+};
+
+} // namespace MetaImGUI
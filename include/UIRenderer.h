@@ -18,7 +18,13 @@
 
 #pragma once
 
-#include <functional>
+#include "ActionTable.h"
+#include "FrameFingerprint.h"
+#include "GLStreamRenderer.h"
+#include "MarkdownDocument.h"
+#include "StaticPanelCache.h"
+
+#include <array>
 #include <memory>
 #include <string>
 
@@ -55,6 +61,15 @@ public:
      */
     bool Initialize(GLFWwindow* window);
 
+    /**
+     * @brief Stream geometry through persistently mapped buffers instead of the stock OpenGL3 backend
+     *
+     * Takes effect at the next Initialize(); contexts without GL_ARB_buffer_storage keep the stock backend.
+     */
+    void SetPersistentBuffers(bool enabled) {
+        m_persistentBuffers = enabled;
+    }
+
     /**
      * @brief Shutdown ImGui context
      */
@@ -66,32 +81,41 @@ public:
     void BeginFrame();
 
     /**
-     * @brief End the current ImGui frame and render
+     * @brief End the current ImGui frame and fingerprint its draw data
+     * @param framebufferInvalidated The window no longer shows the last presented frame
+     * @return true if the frame differs from the one on screen and must be submitted and presented
+     */
+    bool EndFrame(bool framebufferInvalidated);
+
+    /**
+     * @brief Submit the ended frame's draw data to the GPU
      */
-    void EndFrame();
+    void SubmitFrame();
+
+    [[nodiscard]] const PresentGate& GetPresentGate() const {
+        return m_presentGate;
+    }
+
+    // Draw commands and draw calls of the last submitted frame
+    [[nodiscard]] const DrawCallStats& GetDrawCallStats() const {
+        return m_drawStats;
+    }
 
     /**
      * @brief Render the main application window
-     * @param onShowAbout Callback when "Show About" is clicked
-     * @param onShowDemo Callback when "Show Demo" is clicked
-     * @param onShowInputDialog Callback when "Show Input Dialog" is clicked
+     * @param actions Invoked by the About, Demo and Input Dialog buttons
      */
-    void RenderMainWindow(std::function<void()> onShowAbout, std::function<void()> onShowDemo,
-                          std::function<void()> onShowInputDialog = nullptr);
+    void RenderMainWindow(const ActionTable& actions);
 
     /**
      * @brief Render the menu bar
-     * @param onExit Callback when exit is requested
-     * @param onToggleDemo Callback when demo window is toggled
-     * @param onCheckUpdates Callback when update check is requested
-     * @param onShowAbout Callback when about is requested
+     * @param actions Invoked by the menu items
      * @param showDemoWindow Current state of demo window visibility
-     * @param onToggleISSTracker Callback when ISS tracker is toggled
      * @param showISSTracker Current state of ISS tracker window visibility
+     * @param showPerformance Current state of performance overlay visibility
      */
-    void RenderMenuBar(std::function<void()> onExit, std::function<void()> onToggleDemo,
-                       std::function<void()> onCheckUpdates, std::function<void()> onShowAbout, bool showDemoWindow,
-                       std::function<void()> onToggleISSTracker = nullptr, bool showISSTracker = false);
+    void RenderMenuBar(const ActionTable& actions, bool showDemoWindow, bool showISSTracker = false,
+                       bool showPerformance = false);
 
     /**
      * @brief Render the status bar
@@ -102,6 +126,12 @@ public:
      */
     void RenderStatusBar(const std::string& statusMessage, float fps, const char* version, bool updateInProgress);
 
+    /**
+     * @brief Render the performance overlay: frame time, presented frames and draw call counts
+     * @param showPerformanceOverlay Reference to visibility flag
+     */
+    void RenderPerformanceOverlay(bool& showPerformanceOverlay);
+
     /**
      * @brief Render the about dialog
      * @param showAboutWindow Reference to visibility flag
@@ -112,8 +142,9 @@ public:
      * @brief Render the update notification dialog
      * @param showUpdateNotification Reference to visibility flag
      * @param updateInfo Pointer to update information
+     * @param actions Provides DownloadUpdate, which downloads the release asset in the background
      */
-    void RenderUpdateNotification(bool& showUpdateNotification, UpdateInfo* updateInfo);
+    void RenderUpdateNotification(bool& showUpdateNotification, UpdateInfo* updateInfo, const ActionTable& actions);
 
     /**
      * @brief Show ImGui demo window
@@ -135,7 +166,30 @@ public:
     static void HelpMarker(const char* desc);
 
 private:
+    void RenderReplayControls(ISSTracker* issTracker);
+    static void RenderTrackerMetrics(const ISSTracker* issTracker);
+    void RenderReleaseNotes(const std::string& releaseNotes);
+
+    /**
+     * @brief Draw a panel of static items, replaying its recorded geometry when nothing it depends on changed
+     * @param draw Submits the panel's items; must not contain interactive widgets. A plain function
+     *             (or captureless lambda), so calling this every frame constructs no callable
+     */
+    void RenderStaticPanel(const char* id, void (*draw)());
+
     bool m_initialized = false;
+    std::array<char, 512> m_sessionPath{}; // Replay/recording file path for the ISS tracker window
+
+    // Release notes are parsed once per release and re-wrapped only on resize or font change
+    std::string m_releaseNotesSource;
+    MarkdownDocument m_releaseNotes;
+
+    StaticPanelCache m_staticPanels;
+    PresentGate m_presentGate;
+    DrawCallStats m_drawStats;
+
+    bool m_persistentBuffers = false;
+    std::unique_ptr<GLStreamRenderer> m_streamRenderer; // Null when the stock backend renders
 };
 
 } // namespace MetaImGUI
@@ -18,16 +18,55 @@
 
 #pragma once
 
+#include "AsyncTask.h"
+#include "HttpClient.h"
+#include "TaskScheduler.h"
+
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <stop_token>
 #include <string>
-#include <thread>
+#include <string_view>
+#include <vector>
 
 namespace MetaImGUI {
 
+// Which releases are offered as updates; each channel also includes the ones before it
+enum class UpdateChannel {
+    Stable,  // Published releases only
+    Beta,    // Pre-releases such as "1.3.0-beta.1" or "1.3.0-rc.2"
+    Nightly, // Pre-releases tagged "<version>-nightly..."
+};
+
+// "stable", "beta" or "nightly" (case-insensitive); nullopt for anything else
+std::optional<UpdateChannel> ParseUpdateChannel(std::string_view name);
+const char* UpdateChannelName(UpdateChannel channel);
+
+// Release package formats, named "MetaImGUI-<version>-<platform>-<arch><suffix>" by the release workflow
+enum class UpdatePackage {
+    AppImage,    // .AppImage
+    Tarball,     // .tar.gz
+    Installer,   // -Setup.exe
+    PortableZip, // -portable.zip
+    DiskImage,   // .dmg
+};
+
+// Which release asset to download
+struct UpdateAssetFilter {
+    std::string platform;                // "linux", "windows" or "macos"
+    std::string arch;                    // "x64" or "arm64"
+    std::vector<UpdatePackage> packages; // Most preferred first
+
+    // The platform, architecture and package formats of the running build
+    static UpdateAssetFilter ForThisBuild();
+};
+
 // C++20: Using designated initializers for clear, safe initialization
 struct UpdateInfo {
     bool updateAvailable = false;
@@ -35,12 +74,34 @@ struct UpdateInfo {
     std::string currentVersion;
     std::string releaseUrl;
     std::string releaseNotes;
-    std::string downloadUrl;
+    bool preRelease = false;    // Published as a pre-release (beta and nightly channels)
+    std::string downloadUrl;    // Release asset for this platform; empty if none matches
+    std::string downloadName;   // File name of that asset
+    uint64_t downloadSize = 0;  // Asset size in bytes; 0 if unknown
+    std::string downloadSha256; // Hex digest published with the release, if any
+    std::string checksumUrl;    // Companion "<asset>.sha256" file, if published
+    std::string deltaUrl;       // bsdiff patch from the running version to that asset; empty if none
+    std::string deltaName;      // "<asset>.from-<current version>.bsdiff"
+    uint64_t deltaSize = 0;
+    std::string deltaSha256;      // Digest of the patch file itself, if published
+    std::string deltaChecksumUrl; // Companion "<patch>.sha256" file, if published
+};
+
+struct UpdateDownloadResult {
+    bool succeeded = false;
+    bool cancelled = false;
+    std::filesystem::path file; // Verified download, when succeeded
+    std::string error;
 };
 
+// Bytes received so far and the expected total (0 if unknown); called on the HTTP I/O thread
+using UpdateDownloadProgress = std::function<void(uint64_t received, uint64_t total)>;
+
 class UpdateChecker {
 public:
-    UpdateChecker(std::string repoOwner, std::string repoName);
+    // The scheduler and HTTP client run asynchronous checks and must outlive the checker
+    UpdateChecker(std::string repoOwner, std::string repoName, TaskScheduler& scheduler = TaskScheduler::Instance(),
+                  HttpClient& http = HttpClient::Instance());
     ~UpdateChecker();
 
     // Delete copy and move
@@ -49,35 +110,102 @@ public:
     UpdateChecker(UpdateChecker&&) = delete;
     UpdateChecker& operator=(UpdateChecker&&) = delete;
 
-    // Check for updates asynchronously
-    void CheckForUpdatesAsync(std::function<void(const UpdateInfo&)> callback);
+    // Check for updates asynchronously, optionally after a delay that Cancel() also ends
+    void CheckForUpdatesAsync(std::function<void(const UpdateInfo&)> callback,
+                              std::chrono::milliseconds delay = std::chrono::milliseconds(0));
 
     // Check for updates synchronously (blocking)
     UpdateInfo CheckForUpdates();
 
+    // Check for updates as a coroutine; continues on a scheduler worker after the request
+    AsyncTask<UpdateInfo> CheckForUpdatesCoro(std::stop_token stopToken = {});
+
     // Cancel ongoing check
     void Cancel();
 
+    // Download the release asset in UpdateInfo to directory in the background, verifying its SHA-256.
+    // An interrupted download is kept as "<name>.part" and resumed with an HTTP Range request.
+    // When the release publishes a delta from the installed asset, the much smaller patch is
+    // downloaded and applied instead, falling back to the full asset if that fails.
+    // Returns false if a download is already running.
+    bool DownloadUpdateAsync(const UpdateInfo& info, std::filesystem::path directory,
+                             UpdateDownloadProgress onProgress,
+                             std::function<void(const UpdateDownloadResult&)> onComplete);
+
+    // Download as a coroutine; continues on a scheduler worker after each request
+    AsyncTask<UpdateDownloadResult> DownloadUpdateCoro(UpdateInfo info, std::filesystem::path directory,
+                                                       UpdateDownloadProgress onProgress,
+                                                       std::stop_token stopToken = {});
+
+    // Cancel an ongoing download; the partial file is kept for resuming
+    void CancelDownload();
+
+    [[nodiscard]] bool IsDownloading() const;
+
+    // The installed release asset that delta updates patch (defaults to $APPIMAGE on Linux); empty disables deltas
+    void SetInstalledAsset(std::filesystem::path path);
+    [[nodiscard]] std::filesystem::path GetInstalledAsset() const;
+
     // Check if a check is in progress
     [[nodiscard]] bool IsChecking() const;
 
-    // Compare versions (returns: -1 if v1 < v2, 0 if equal, 1 if v1 > v2)
-    static int CompareVersions(const std::string& v1, const std::string& v2);
+    // Releases newer than the running version are looked for on this channel (default Stable)
+    void SetChannel(UpdateChannel channel);
+    [[nodiscard]] UpdateChannel GetChannel() const;
+
+    // The asset offered for download (default UpdateAssetFilter::ForThisBuild())
+    void SetAssetFilter(UpdateAssetFilter filter);
+
+    // Compare versions by SemVer precedence (returns: -1 if v1 < v2, 0 if equal, 1 if v1 > v2)
+    static int CompareVersions(std::string_view v1, std::string_view v2);
+
+    // Parse a GitHub release document, selecting the download asset for this platform
+    static UpdateInfo ParseReleaseInfo(const std::string& jsonResponse);
+    static UpdateInfo ParseReleaseInfo(const std::string& jsonResponse, const UpdateAssetFilter& filter);
+
+    // Scan a page of the /releases list for the newest release on channel. The list is parsed as a
+    // stream, one release at a time, and parsing stops at the first match. nullopt if the page has none.
+    static std::optional<UpdateInfo> FindRelease(std::string_view releaseList, UpdateChannel channel,
+                                                 const UpdateAssetFilter& filter);
+
+    // Releases requested per page of the /releases list, and the pages searched before giving up
+    static constexpr int RELEASES_PER_PAGE = 30;
+    static constexpr int MAX_RELEASE_PAGES = 4;
+
+    // Download attempts per DownloadUpdateCoro call before giving up on transport errors
+    static constexpr int MAX_DOWNLOAD_ATTEMPTS = 3;
 
 private:
     std::string m_repoOwner;
     std::string m_repoName;
     std::atomic<bool> m_checking;
 
-    // C++20: Using std::jthread for automatic thread management
-    std::jthread m_checkThread;
-    std::stop_source m_stopSource;
-    std::mutex m_threadMutex; // Protects thread operations
+    // Background check runs as a coroutine spawned on the shared scheduler
+    TaskScheduler& m_scheduler;
+    HttpClient& m_http;
+    TaskHandle m_checkTask;
+    TaskHandle m_downloadTask;
+    std::atomic<bool> m_downloading;
+    std::mutex m_threadMutex; // Protects m_checkTask and m_downloadTask
+    std::filesystem::path m_installedAsset;
+    UpdateChannel m_channel = UpdateChannel::Stable;
+    UpdateAssetFilter m_assetFilter;
+    mutable std::mutex m_settingsMutex; // Protects the three above; tasks read them while the destructor waits
 
     // Internal implementation
-    UpdateInfo CheckForUpdatesImpl(const std::stop_token& stopToken);
-    std::string FetchLatestReleaseInfo();
-    UpdateInfo ParseReleaseInfo(const std::string& jsonResponse);
+    AsyncTask<void> RunCheck(std::stop_token stopToken, std::function<void(const UpdateInfo&)> callback,
+                             std::chrono::milliseconds delay);
+    AsyncTask<void> RunDownload(std::stop_token stopToken, UpdateInfo info, std::filesystem::path directory,
+                                UpdateDownloadProgress onProgress,
+                                std::function<void(const UpdateDownloadResult&)> onComplete);
+    AsyncTask<UpdateInfo> FetchLatestRelease(UpdateChannel channel, UpdateAssetFilter filter, std::stop_token stopToken);
+    AsyncTask<std::string> FetchExpectedSha256(std::string sha256, std::string checksumUrl, std::stop_token stopToken);
+    AsyncTask<UpdateDownloadResult> DownloadFile(std::string url, uint64_t size, std::string expectedSha256,
+                                                 std::filesystem::path target, UpdateDownloadProgress onProgress,
+                                                 std::stop_token stopToken);
+    AsyncTask<UpdateDownloadResult> DownloadDelta(UpdateInfo info, std::filesystem::path installed,
+                                                  std::filesystem::path directory, std::string expectedSha256,
+                                                  UpdateDownloadProgress onProgress, std::stop_token stopToken);
 };
 
 } // namespace MetaImGUI
@@ -76,11 +76,30 @@ public:
      */
     void BeginFrame();
 
+    /**
+     * @brief Set the viewport and clear the framebuffer before a frame is submitted
+     */
+    void PrepareFramebuffer();
+
     /**
      * @brief Present the rendered frame
      */
     void EndFrame();
 
+    /**
+     * @brief Whether the window contents were lost since the last call (resize, expose, context reset)
+     *
+     * Clears the flag; the next presented frame restores the contents.
+     */
+    bool ConsumeFramebufferInvalidated();
+
+    /**
+     * @brief Wait for input or one display refresh interval, for frames that were not presented
+     *
+     * Presenting is throttled by vsync; a skipped frame would otherwise spin the main loop.
+     */
+    void WaitForNextFrame();
+
     /**
      * @brief Get the current framebuffer size
      * @param width Output: framebuffer width
@@ -155,12 +174,16 @@ private:
     static void FramebufferSizeCallbackInternal(GLFWwindow* window, int width, int height);
     static void KeyCallbackInternal(GLFWwindow* window, int key, int scancode, int action, int mods);
     static void WindowCloseCallbackInternal(GLFWwindow* window);
+    static void WindowRefreshCallbackInternal(GLFWwindow* window);
 
     GLFWwindow* m_window = nullptr;
     std::string m_title;
     int m_width;
     int m_height;
     bool m_initialized = false;
+    bool m_framebufferInvalidated = true;
+    double m_frameInterval = DEFAULT_FRAME_INTERVAL; // Seconds per refresh of the primary monitor
+    static constexpr double DEFAULT_FRAME_INTERVAL = 1.0 / 60.0;
 
     // Context recovery
     int m_contextRecoveryAttempts = 0;
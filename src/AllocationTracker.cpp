@@ -0,0 +1,187 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "AllocationTracker.h"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace MetaImGUI {
+
+namespace {
+// Everything here is constant-initialized, so the hooks can run before (and after) main
+struct ScopeSlot {
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> bytes{0};
+};
+
+constinit std::array<ScopeSlot, AllocationTracker::MAX_SCOPES> g_slots{}; // Slot 0 is UNSCOPED
+constinit thread_local size_t t_activeSlot = 0;
+
+// Written by EndFrame() on the main thread only
+constinit std::array<AllocationTracker::ScopeCounts, AllocationTracker::MAX_SCOPES> g_lastFrameScopes{};
+constinit size_t g_lastFrameScopeCount = 0;
+constinit AllocationCounts g_lastFrame{};
+
+// Slot of name, claiming a free one the first time a name is seen
+size_t FindOrAddSlot(const char* name) {
+    for (size_t slot = 1; slot < g_slots.size(); ++slot) {
+        const char* existing = g_slots[slot].name.load(std::memory_order_acquire);
+        if (existing == nullptr &&
+            g_slots[slot].name.compare_exchange_strong(existing, name, std::memory_order_acq_rel)) {
+            return slot;
+        }
+        // Identical literals are not guaranteed to share an address across translation units
+        if (existing == name || std::strcmp(existing, name) == 0) {
+            return slot;
+        }
+    }
+    return 0;
+}
+} // namespace
+
+bool AllocationTracker::IsEnabled() {
+#ifdef METAIMGUI_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AllocationTracker::RecordAllocation(size_t bytes) noexcept {
+    ScopeSlot& slot = g_slots[t_activeSlot];
+    slot.allocations.fetch_add(1, std::memory_order_relaxed);
+    slot.bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void* AllocationTracker::TrackedMalloc(size_t bytes, void* /*userData*/) {
+    RecordAllocation(bytes);
+    return std::malloc(bytes);
+}
+
+void AllocationTracker::TrackedFree(void* pointer, void* /*userData*/) {
+    std::free(pointer);
+}
+
+void AllocationTracker::EndFrame() {
+    g_lastFrame = {};
+    g_lastFrameScopeCount = 0;
+    for (size_t slot = 0; slot < g_slots.size(); ++slot) {
+        const char* name = slot == 0 ? UNSCOPED : g_slots[slot].name.load(std::memory_order_acquire);
+        if (name == nullptr) {
+            break;
+        }
+        ScopeCounts& counts = g_lastFrameScopes[g_lastFrameScopeCount++];
+        counts.name = name;
+        counts.counts.allocations = g_slots[slot].allocations.exchange(0, std::memory_order_relaxed);
+        counts.counts.bytes = g_slots[slot].bytes.exchange(0, std::memory_order_relaxed);
+        g_lastFrame.allocations += counts.counts.allocations;
+        g_lastFrame.bytes += counts.counts.bytes;
+    }
+}
+
+AllocationCounts AllocationTracker::GetLastFrame() {
+    return g_lastFrame;
+}
+
+std::span<const AllocationTracker::ScopeCounts> AllocationTracker::GetLastFrameScopes() {
+    return {g_lastFrameScopes.data(), g_lastFrameScopeCount};
+}
+
+AllocationScope::AllocationScope(const char* name) noexcept : m_previous(t_activeSlot) {
+    t_activeSlot = FindOrAddSlot(name);
+}
+
+AllocationScope::~AllocationScope() {
+    t_activeSlot = m_previous;
+}
+
+} // namespace MetaImGUI
+
+#ifdef METAIMGUI_TRACK_ALLOCATIONS
+
+// Replacements for the global allocation functions. The array, nothrow and sized forms
+// of the standard library forward to these, so they see every new-expression.
+namespace {
+void* CountedAllocate(std::size_t size) {
+    MetaImGUI::AllocationTracker::RecordAllocation(size);
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* CountedAllocateAligned(std::size_t size, std::align_val_t alignment) {
+    MetaImGUI::AllocationTracker::RecordAllocation(size);
+    const auto align = static_cast<std::size_t>(alignment);
+    const std::size_t bytes = size == 0 ? 1 : size;
+#ifdef _WIN32
+    void* pointer = _aligned_malloc(bytes, align);
+#else
+    // aligned_alloc requires a size that is a multiple of the alignment
+    void* pointer = std::aligned_alloc(align, (bytes + align - 1) / align * align);
+#endif
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void FreeAligned(void* pointer) {
+#ifdef _WIN32
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+} // namespace
+
+void* operator new(std::size_t size) {
+    return CountedAllocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return CountedAllocateAligned(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t /*alignment*/) noexcept {
+    FreeAligned(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept {
+    FreeAligned(pointer);
+}
+
+#endif // METAIMGUI_TRACK_ALLOCATIONS
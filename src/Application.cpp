@@ -18,21 +18,31 @@
 
 #include "Application.h"
 
+#include "AllocationTracker.h"
+#include "CommandPalette.h"
 #include "ConfigManager.h"
 #include "DialogManager.h"
+#include "HttpCache.h"
+#include "HttpClient.h"
 #include "ISSTracker.h"
 #include "Localization.h"
 #include "Logger.h"
+#include "MainThreadDispatcher.h"
+#include "TaskScheduler.h"
+#include "ThemeManager.h"
 #include "UIRenderer.h"
 #include "UpdateChecker.h"
 #include "WindowManager.h"
 #include "version.h"
 
 #include <GLFW/glfw3.h>
-#include <curl/curl.h>
 #include <imgui.h>
 
+#include <algorithm>
 #include <cstdlib> // for std::getenv
+#include <random>
+#include <utility>
+#include <vector>
 
 #ifdef __APPLE__
 #include <mach-o/dyld.h> // for _NSGetExecutablePath
@@ -40,6 +50,41 @@
 
 namespace MetaImGUI {
 
+namespace {
+// Everything the menus and the main window offer, for the command palette
+std::vector<CommandPalette::Command> PaletteCommands(const ActionTable& actions) {
+    const auto& loc = Localization::Instance();
+    const auto invoke = [&actions](ActionId id) { return [&actions, id]() { actions.Invoke(id); }; };
+    const auto applyTheme = [](ThemeManager::Theme theme) { return [theme]() { ThemeManager::Apply(theme); }; };
+    const auto setLanguage = [](const char* code) { return [code]() { Localization::Instance().SetLanguage(code); }; };
+
+    const std::string& file = loc.Tr("menu.file");
+    const std::string& view = loc.Tr("menu.view");
+    const std::string& help = loc.Tr("menu.help");
+    const std::string& dialogs = loc.Tr("palette.dialogs");
+    const std::string& themes = loc.Tr("menu.theme");
+    const std::string& languages = loc.Tr("menu.language");
+
+    return {
+        {file, loc.Tr("menu.exit"), invoke(ActionId::Exit)},
+        {view, loc.Tr("menu.demo_window"), invoke(ActionId::ToggleDemoWindow)},
+        {view, "ISS Tracker", invoke(ActionId::ToggleISSTracker)},
+        {view, "Performance", invoke(ActionId::TogglePerformanceOverlay)},
+        {help, loc.Tr("menu.check_updates"), invoke(ActionId::CheckForUpdates)},
+        {help, loc.Tr("menu.about"), invoke(ActionId::ShowAbout)},
+        {dialogs, loc.Tr("button.show_input"), invoke(ActionId::ShowInputDialog)},
+        {themes, "Dark", applyTheme(ThemeManager::Theme::Dark)},
+        {themes, "Light", applyTheme(ThemeManager::Theme::Light)},
+        {themes, "Classic", applyTheme(ThemeManager::Theme::Classic)},
+        {themes, "Modern", applyTheme(ThemeManager::Theme::Modern)},
+        {languages, "English", setLanguage("en")},
+        {languages, "Español", setLanguage("es")},
+        {languages, "Français", setLanguage("fr")},
+        {languages, "Deutsch", setLanguage("de")},
+    };
+}
+} // namespace
+
 Application::Application() : m_statusMessage("Ready") {}
 
 Application::~Application() {
@@ -75,9 +120,10 @@ bool Application::Initialize() {
     Logger::Instance().Initialize(logPath, LogLevel::Info);
     LOG_INFO("Initializing MetaImGUI v{}", Version::VERSION);
 
-    // Initialize libcurl globally (thread-safe) before any CURL handles are created.
-    // Auto-init via curl_easy_init() is NOT thread-safe when called concurrently.
-    curl_global_init(CURL_GLOBAL_DEFAULT);
+    // Background completions are handed to the main thread through the dispatcher
+    m_dispatcher = std::make_unique<MainThreadDispatcher>();
+    m_updateResult = std::make_unique<MainThreadSlot<UpdateInfo>>();
+    m_downloadResult = std::make_unique<MainThreadSlot<UpdateDownloadResult>>();
 
     // Load configuration
     m_configManager = std::make_unique<ConfigManager>();
@@ -87,6 +133,17 @@ bool Application::Initialize() {
         LOG_INFO("Using default configuration");
     }
 
+    // Size the shared worker pool before the first component schedules work (0 = auto)
+    const int workerThreads = m_configManager->GetInt("worker_threads").value_or(0);
+    TaskScheduler::Configure(static_cast<size_t>((std::max)(workerThreads, 0)));
+    LOG_INFO("Task scheduler: {} worker threads", TaskScheduler::Instance().GetThreadCount());
+
+    // Conditional requests let repeated update checks and polls cost a 304 instead of a full download
+    if (m_configManager->GetBool("http_cache").value_or(true)) {
+        const auto cacheDirectory = ConfigManager::GetConfigDirectory() / "http_cache";
+        HttpClient::Instance().SetCache(std::make_shared<HttpCache>(cacheDirectory));
+    }
+
     // Load translations and set language from config
     // CRITICAL: translations.json MUST be present and valid
     // Try multiple locations for translations file (for different package formats)
@@ -168,6 +225,8 @@ bool Application::Initialize() {
     }
     LOG_INFO("Window manager initialized");
 
+    BindActions();
+
     // Set up window callbacks
     m_windowManager->SetFramebufferSizeCallback(
         [this](int width, int height) { this->OnFramebufferSizeChanged(width, height); });
@@ -178,6 +237,7 @@ bool Application::Initialize() {
 
     // Create and initialize UI renderer
     m_uiRenderer = std::make_unique<UIRenderer>();
+    m_uiRenderer->SetPersistentBuffers(m_configManager->GetBool("gl_persistent_buffers").value_or(false));
     if (!m_uiRenderer->Initialize(m_windowManager->GetNativeWindow())) {
         LOG_ERROR("Failed to initialize UI renderer");
         return false;
@@ -188,16 +248,27 @@ bool Application::Initialize() {
     m_dialogManager = std::make_unique<DialogManager>();
     LOG_INFO("Dialog manager initialized");
 
+    // Command palette; its index is built in the background and again on each language change
+    m_commandPalette = std::make_unique<CommandPalette>([this]() { return PaletteCommands(m_actions); });
+
     // Initialize update checker
     m_updateChecker = std::make_unique<UpdateChecker>("andynicholson", "MetaImGUI");
-    LOG_INFO("Update checker initialized");
+    // Pre-release channels are opt-in through the update_channel config key
+    const std::string channelName = m_configManager->GetString("update_channel").value_or("stable");
+    if (const std::optional<UpdateChannel> channel = ParseUpdateChannel(channelName)) {
+        m_updateChecker->SetChannel(*channel);
+    } else {
+        LOG_WARNING("Unknown update_channel '{}', using stable", channelName);
+    }
+    LOG_INFO("Update checker initialized ({} channel)", UpdateChannelName(m_updateChecker->GetChannel()));
 
     // Initialize ISS tracker
     m_issTracker = std::make_unique<ISSTracker>();
+    m_issTracker->SetCallbackDispatcher(m_dispatcher.get());
     LOG_INFO("ISS tracker initialized");
 
-    // Check for updates asynchronously
-    CheckForUpdates();
+    // The startup check waits for the first frames; libcurl and TLS start only when it runs
+    m_startupUpdateCheckPending = IsStartupUpdateCheckDue();
 
     m_initialized = true;
     LOG_INFO("Application initialized successfully");
@@ -241,13 +312,21 @@ void Application::Shutdown() {
     }
     m_issTracker.reset();
     m_updateChecker.reset();
+
+    // Components have waited for their own tasks; abort stray transfers, then join the workers
+    HttpClient::Instance().Shutdown();
+    TaskScheduler::Instance().Shutdown();
+    m_commandPalette.reset();
     m_dialogManager.reset();
     m_uiRenderer.reset();
     m_windowManager.reset();
     m_configManager.reset();
 
+    // All posting threads are joined; drop undelivered work before its targets go away
+    m_dispatcher.reset();
+
     // Clean up libcurl global state (after all CURL users are destroyed)
-    curl_global_cleanup();
+    HttpClient::GlobalCleanup();
 
     m_initialized = false;
     LOG_INFO("Application shut down successfully");
@@ -271,23 +350,13 @@ void Application::Render() {
         return;
     }
 
-    // Consume any pending update result (thread-safe handoff from worker thread)
-    {
-        const std::lock_guard<std::mutex> lock(m_updateResultMutex);
-        if (m_pendingUpdateResult) {
-            m_updateCheckInProgress = false;
-            m_latestUpdateInfo = std::move(m_pendingUpdateResult);
-            m_showUpdateNotification = true;
-
-            if (m_latestUpdateInfo->updateAvailable) {
-                m_statusMessage = "Update available: v" + m_latestUpdateInfo->latestVersion;
-                LOG_INFO("Update available: v{} (current: v{})", m_latestUpdateInfo->latestVersion,
-                         m_latestUpdateInfo->currentVersion);
-            } else {
-                m_statusMessage = "Ready";
-                LOG_INFO("No updates available (current version: v{})", m_latestUpdateInfo->currentVersion);
-            }
-        }
+    // Run completions posted by worker threads (tracker callbacks, download progress), then
+    // finished update checks and downloads, which wait in their own slots
+    if (m_dispatcher) {
+        const AllocationScope scope("Main thread dispatch");
+        m_dispatcher->Drain(DISPATCH_BUDGET);
+        m_updateResult->Consume([this](UpdateInfo& info) { ApplyUpdateResult(info); });
+        m_downloadResult->Consume([this](const UpdateDownloadResult& result) { ApplyDownloadResult(result); });
     }
 
     // Get frame time for FPS calculation
@@ -315,15 +384,10 @@ void Application::Render() {
 
     if (ImGui::Begin("MetaImGUI Main", nullptr, window_flags)) {
         // Render menu bar
-        m_uiRenderer->RenderMenuBar([this]() { this->OnExitRequested(); }, [this]() { this->OnToggleDemoWindow(); },
-                                    [this]() { this->OnCheckUpdatesRequested(); },
-                                    [this]() { this->OnShowAboutRequested(); }, m_showDemoWindow,
-                                    [this]() { this->OnToggleISSTracker(); }, m_showISSTracker);
+        m_uiRenderer->RenderMenuBar(m_actions, m_showDemoWindow, m_showISSTracker, m_showPerformanceOverlay);
 
         // Render main window content
-        m_uiRenderer->RenderMainWindow([this]() { this->OnShowAboutRequested(); },
-                                       [this]() { m_showDemoWindow = true; },
-                                       [this]() { this->OnShowInputDialogRequested(); });
+        m_uiRenderer->RenderMainWindow(m_actions);
 
         // Render status bar
         m_uiRenderer->RenderStatusBar(m_statusMessage, m_lastFrameTime, Version::VERSION, m_updateCheckInProgress);
@@ -342,13 +406,17 @@ void Application::Render() {
     }
 
     if (m_showUpdateNotification) {
-        m_uiRenderer->RenderUpdateNotification(m_showUpdateNotification, m_latestUpdateInfo.get());
+        m_uiRenderer->RenderUpdateNotification(m_showUpdateNotification, m_latestUpdateInfo.get(), m_actions);
     }
 
     if (m_showISSTracker) {
         m_uiRenderer->RenderISSTrackerWindow(m_showISSTracker, m_issTracker.get());
     }
 
+    if (m_showPerformanceOverlay) {
+        m_uiRenderer->RenderPerformanceOverlay(m_showPerformanceOverlay);
+    }
+
     // Render exit confirmation dialog
     // Consume m_showExitDialog immediately so ShowConfirmation() is called
     // exactly once. The dialog is then managed by DialogManager internally
@@ -372,14 +440,30 @@ void Application::Render() {
 
     // Render dialogs
     if (m_dialogManager) {
+        const AllocationScope scope("Dialogs");
         m_dialogManager->Render();
     }
 
-    // End ImGui frame and render
-    m_uiRenderer->EndFrame();
+    // Command palette, above the other windows
+    if (m_commandPalette) {
+        const AllocationScope scope("Command palette");
+        m_commandPalette->Update();
+        m_commandPalette->Render();
+    }
 
-    // Present the frame
-    m_windowManager->EndFrame();
+    // End ImGui frame; a frame identical to the one on screen is neither submitted nor swapped
+    if (m_uiRenderer->EndFrame(m_windowManager->ConsumeFramebufferInvalidated())) {
+        m_windowManager->PrepareFramebuffer();
+        m_uiRenderer->SubmitFrame();
+        m_windowManager->EndFrame();
+        ++m_framesPresented;
+    } else {
+        m_windowManager->WaitForNextFrame();
+    }
+    ++m_framesRendered;
+
+    MaybeStartDeferredUpdateCheck();
+    AllocationTracker::EndFrame();
 }
 
 // Event Handlers
@@ -429,6 +513,28 @@ void Application::OnToggleISSTracker() {
     m_showISSTracker = !m_showISSTracker;
 }
 
+void Application::OnTogglePerformanceOverlay() {
+    m_showPerformanceOverlay = !m_showPerformanceOverlay;
+}
+
+void Application::BindActions() {
+    // The handlers capture only this, which outlives the UI that invokes them
+    m_actions.Bind(ActionId::Exit, [this]() { OnExitRequested(); });
+    m_actions.Bind(ActionId::CheckForUpdates, [this]() { OnCheckUpdatesRequested(); });
+    m_actions.Bind(ActionId::DownloadUpdate, [this]() { OnDownloadUpdateRequested(); });
+    m_actions.Bind(ActionId::ShowAbout, [this]() { OnShowAboutRequested(); });
+    m_actions.Bind(ActionId::ShowDemoWindow, [this]() { m_showDemoWindow = true; });
+    m_actions.Bind(ActionId::ToggleDemoWindow, [this]() { OnToggleDemoWindow(); });
+    m_actions.Bind(ActionId::ShowInputDialog, [this]() { OnShowInputDialogRequested(); });
+    m_actions.Bind(ActionId::ToggleISSTracker, [this]() { OnToggleISSTracker(); });
+    m_actions.Bind(ActionId::TogglePerformanceOverlay, [this]() { OnTogglePerformanceOverlay(); });
+    m_actions.Bind(ActionId::ShowCommandPalette, [this]() {
+        if (m_commandPalette) {
+            m_commandPalette->Open();
+        }
+    });
+}
+
 // Input Callbacks
 
 void Application::OnFramebufferSizeChanged(int width, int height) {
@@ -444,13 +550,26 @@ void Application::OnKeyPressed(int key, int scancode, int action, int mods) {
     if (action == GLFW_PRESS) {
         switch (key) {
             case GLFW_KEY_ESCAPE:
-                OnExitRequested();
+                // Escape dismisses the palette before it asks to exit
+                if (m_commandPalette && m_commandPalette->IsOpen()) {
+                    m_commandPalette->Close();
+                } else {
+                    m_actions.Invoke(ActionId::Exit);
+                }
                 break;
             case GLFW_KEY_A:
                 if ((mods & GLFW_MOD_CONTROL) != 0) {
-                    OnShowAboutRequested();
+                    m_actions.Invoke(ActionId::ShowAbout);
                 }
                 break;
+            case GLFW_KEY_P:
+                if ((mods & GLFW_MOD_CONTROL) != 0) {
+                    m_actions.Invoke(ActionId::ShowCommandPalette);
+                }
+                break;
+            case GLFW_KEY_F3:
+                m_actions.Invoke(ActionId::TogglePerformanceOverlay);
+                break;
             case GLFW_KEY_F9:
                 // DEBUG: Simulate context loss for testing
                 if ((mods & GLFW_MOD_SHIFT) != 0) {
@@ -471,7 +590,7 @@ void Application::OnKeyPressed(int key, int scancode, int action, int mods) {
 
 // Update Checking
 
-void Application::CheckForUpdates() {
+void Application::CheckForUpdates(std::chrono::milliseconds delay) {
     if (!m_updateChecker || m_updateCheckInProgress) {
         return;
     }
@@ -480,16 +599,140 @@ void Application::CheckForUpdates() {
     m_statusMessage = "Checking for updates...";
 
     // Check asynchronously
-    m_updateChecker->CheckForUpdatesAsync([this](const UpdateInfo& info) { this->OnUpdateCheckComplete(info); });
+    m_updateChecker->CheckForUpdatesAsync([this](const UpdateInfo& info) { this->OnUpdateCheckComplete(info); },
+                                          delay);
+}
+
+bool Application::IsStartupUpdateCheckDue() const {
+    const auto lastCheck = m_configManager->GetInt64("last_update_check");
+    if (!lastCheck) {
+        return true;
+    }
+
+    const int intervalHours =
+        m_configManager->GetInt("update_check_interval_hours").value_or(DEFAULT_UPDATE_CHECK_INTERVAL_HOURS);
+    const auto elapsed = std::chrono::system_clock::now() -
+                         std::chrono::system_clock::time_point(std::chrono::seconds(*lastCheck));
+    if (elapsed >= std::chrono::hours(0) && elapsed < std::chrono::hours(intervalHours)) {
+        LOG_INFO("Skipping startup update check: last checked {} minutes ago",
+                 std::chrono::duration_cast<std::chrono::minutes>(elapsed).count());
+        return false;
+    }
+    return true;
+}
+
+void Application::MaybeStartDeferredUpdateCheck() {
+    if (!m_startupUpdateCheckPending) {
+        return;
+    }
+
+    // Wait for a frame without interaction so the request does not compete with the user.
+    // A UI that stops changing may present fewer frames than the minimum, so the fallback
+    // counts every rendered frame instead.
+    if (m_framesRendered < STARTUP_CHECK_MAX_FRAMES) {
+        const ImGuiIO& io = ImGui::GetIO();
+        const bool idle = !ImGui::IsAnyItemActive() && !ImGui::IsAnyMouseDown() && io.InputQueueCharacters.empty();
+        if (m_framesPresented < STARTUP_CHECK_MIN_FRAMES || !idle) {
+            return;
+        }
+    }
+
+    m_startupUpdateCheckPending = false;
+
+    std::random_device seed;
+    std::uniform_int_distribution<std::chrono::milliseconds::rep> jitter(STARTUP_CHECK_JITTER_MIN.count(),
+                                                                         STARTUP_CHECK_JITTER_MAX.count());
+    const std::chrono::milliseconds delay(jitter(seed));
+    LOG_INFO("Startup update check in {} ms", delay.count());
+    CheckForUpdates(delay);
 }
 
 void Application::OnUpdateCheckComplete(const UpdateInfo& updateInfo) {
-    // Thread-safe: store result for main thread to consume in Render()
-    // This callback runs on the worker thread, so we must not write to
-    // main-thread state directly. Instead, we store the result under a
-    // mutex and let the main thread pick it up.
-    const std::lock_guard<std::mutex> lock(m_updateResultMutex);
-    m_pendingUpdateResult = std::make_unique<UpdateInfo>(updateInfo);
+    // Runs on the worker thread: hand the result to the main thread rather than
+    // touching main-thread state here. The slot cannot overflow like the dispatcher's
+    // ring, so m_updateCheckInProgress is always cleared and later checks can run.
+    m_updateResult->Publish(updateInfo);
+}
+
+void Application::ApplyUpdateResult(UpdateInfo& updateInfo) {
+    m_updateCheckInProgress = false;
+    if (!m_latestUpdateInfo) {
+        m_latestUpdateInfo = std::make_unique<UpdateInfo>();
+    }
+    // Swapped, not copied: the slot keeps the previous result's buffers for the next check
+    std::swap(*m_latestUpdateInfo, updateInfo);
+    m_showUpdateNotification = true;
+
+    // A release was read, so the next launch can skip its check (saved with the rest of the config)
+    if (!m_latestUpdateInfo->latestVersion.empty() && m_configManager) {
+        const auto now = std::chrono::system_clock::now().time_since_epoch();
+        m_configManager->SetInt64("last_update_check", std::chrono::duration_cast<std::chrono::seconds>(now).count());
+    }
+
+    if (m_latestUpdateInfo->updateAvailable) {
+        m_statusMessage = "Update available: v" + m_latestUpdateInfo->latestVersion;
+        LOG_INFO("Update available: v{} (current: v{})", m_latestUpdateInfo->latestVersion,
+                 m_latestUpdateInfo->currentVersion);
+    } else {
+        m_statusMessage = "Ready";
+        LOG_INFO("No updates available (current version: v{})", m_latestUpdateInfo->currentVersion);
+    }
+}
+
+void Application::OnDownloadUpdateRequested() {
+    if (!m_updateChecker || !m_latestUpdateInfo || m_updateDownloadDialog != 0) {
+        return;
+    }
+    m_showUpdateNotification = false;
+
+    const int dialogId = m_dialogManager->ShowProgressDialog(
+        "Downloading Update", m_latestUpdateInfo->downloadName, [this]() {
+            // The dialog closes itself; the partial file is kept so the next attempt resumes
+            m_updateChecker->CancelDownload();
+            m_updateDownloadDialog = 0;
+            m_statusMessage = "Update download cancelled";
+        });
+    m_updateDownloadDialog = dialogId;
+    m_statusMessage = "Downloading update...";
+
+    // Progress arrives on the HTTP I/O thread; a dropped update is simply superseded by the next
+    auto onProgress = [this, dialogId](uint64_t received, uint64_t total) {
+        m_dispatcher->Post([this, dialogId, received, total] {
+            const float progress = (total > 0) ? static_cast<float>(received) / static_cast<float>(total) : 0.0f;
+            m_dialogManager->UpdateProgress(dialogId, progress);
+        });
+    };
+    // The result must arrive even if progress updates have filled the dispatcher: it closes the
+    // dialog and clears m_updateDownloadDialog, without which no later download could start
+    auto onComplete = [this](const UpdateDownloadResult& result) { m_downloadResult->Publish(result); };
+
+    const bool started =
+        m_updateChecker->DownloadUpdateAsync(*m_latestUpdateInfo, ConfigManager::GetConfigDirectory() / "updates",
+                                             std::move(onProgress), std::move(onComplete));
+    if (!started) {
+        // A cancelled download is still winding down
+        m_dialogManager->CloseProgress(dialogId);
+        m_updateDownloadDialog = 0;
+        m_statusMessage = "Update download already in progress";
+    }
+}
+
+void Application::ApplyDownloadResult(const UpdateDownloadResult& result) {
+    if (m_updateDownloadDialog != 0) {
+        m_dialogManager->CloseProgress(m_updateDownloadDialog);
+        m_updateDownloadDialog = 0;
+    }
+
+    if (result.succeeded) {
+        m_statusMessage = "Update downloaded";
+        m_dialogManager->ShowMessageBox("Update Downloaded",
+                                        "The update was downloaded and verified:\n" + result.file.string(),
+                                        MessageBoxButtons::OK, MessageBoxIcon::Info);
+    } else {
+        m_statusMessage = "Update download failed";
+        m_dialogManager->ShowMessageBox("Update Download Failed", result.error, MessageBoxButtons::OK,
+                                        MessageBoxIcon::Error);
+    }
 }
 
 bool Application::OnContextLoss() {
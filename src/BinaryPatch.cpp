@@ -0,0 +1,265 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "BinaryPatch.h"
+
+#include "Sha256.h"
+
+#include <bzlib.h>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace MetaImGUI {
+
+namespace {
+constexpr std::string_view MAGIC = "BSDIFF40";
+constexpr size_t HEADER_SIZE = 32;
+constexpr size_t CONTROL_SIZE = 24;
+constexpr int64_t MAX_POSITION = std::numeric_limits<int64_t>::max() / 4; // Largest old or new file size
+
+// bsdiff stores integers as 64-bit little-endian sign-magnitude
+int64_t ReadOfftin(const unsigned char* bytes) {
+    uint64_t magnitude = 0;
+    for (size_t i = 8; i-- > 0;) {
+        magnitude = (magnitude << 8) | bytes[i];
+    }
+    const bool negative = (magnitude >> 63) != 0;
+    magnitude &= ~(uint64_t{1} << 63);
+    return negative ? -static_cast<int64_t>(magnitude) : static_cast<int64_t>(magnitude);
+}
+
+// Decompresses one bzip2 section of the patch file on demand
+class Bz2Section {
+public:
+    Bz2Section(const std::filesystem::path& path, uint64_t offset, uint64_t length)
+        : m_file(path, std::ios::binary), m_remaining(length), m_input(BinaryPatch::BUFFER_SIZE) {
+        m_file.seekg(static_cast<std::streamoff>(offset));
+        m_initialized = m_file.good() && BZ2_bzDecompressInit(&m_stream, 0, 0) == BZ_OK;
+    }
+    ~Bz2Section() {
+        if (m_initialized) {
+            BZ2_bzDecompressEnd(&m_stream);
+        }
+    }
+
+    Bz2Section(const Bz2Section&) = delete;
+    Bz2Section& operator=(const Bz2Section&) = delete;
+    Bz2Section(Bz2Section&&) = delete;
+    Bz2Section& operator=(Bz2Section&&) = delete;
+
+    [[nodiscard]] bool IsOpen() const {
+        return m_initialized;
+    }
+
+    // Fill exactly size bytes (at most BUFFER_SIZE); false if the section is corrupt or ends early
+    bool Read(char* out, size_t size) {
+        m_stream.next_out = out;
+        m_stream.avail_out = static_cast<unsigned int>(size);
+
+        while (m_stream.avail_out > 0) {
+            if (m_ended) {
+                return false;
+            }
+            if (m_stream.avail_in == 0 && m_remaining > 0) {
+                const size_t want = static_cast<size_t>(std::min<uint64_t>(m_remaining, m_input.size()));
+                m_file.read(m_input.data(), static_cast<std::streamsize>(want));
+                const auto got = static_cast<size_t>(m_file.gcount());
+                if (got == 0) {
+                    return false;
+                }
+                m_remaining -= got;
+                m_stream.next_in = m_input.data();
+                m_stream.avail_in = static_cast<unsigned int>(got);
+            }
+
+            const int status = BZ2_bzDecompress(&m_stream);
+            if (status == BZ_STREAM_END) {
+                m_ended = true;
+            } else if (status != BZ_OK) {
+                return false;
+            } else if (m_stream.avail_in == 0 && m_remaining == 0 && m_stream.avail_out > 0) {
+                return false; // Needs input the section does not have
+            }
+        }
+        return true;
+    }
+
+private:
+    std::ifstream m_file;
+    uint64_t m_remaining; // Compressed bytes not yet read from the file
+    std::vector<char> m_input;
+    bz_stream m_stream{};
+    bool m_initialized = false;
+    bool m_ended = false;
+};
+
+// Old file bytes at [position, position + size); bytes outside the file read as zero, as in bspatch
+bool ReadOld(std::ifstream& file, uint64_t fileSize, int64_t position, char* out, size_t size) {
+    std::fill_n(out, size, '\0');
+    const int64_t begin = std::max<int64_t>(position, 0);
+    const int64_t end = std::min<int64_t>(position + static_cast<int64_t>(size), static_cast<int64_t>(fileSize));
+    if (begin >= end) {
+        return true;
+    }
+    file.seekg(begin);
+    file.read(out + (begin - position), end - begin);
+    return file.gcount() == end - begin;
+}
+
+BinaryPatch::Result Fail(const std::filesystem::path& newFile, std::string error) {
+    std::error_code ignored;
+    std::filesystem::remove(newFile, ignored);
+    BinaryPatch::Result result;
+    result.error = std::move(error);
+    return result;
+}
+} // namespace
+
+BinaryPatch::Result BinaryPatch::Apply(const std::filesystem::path& oldFile, const std::filesystem::path& patchFile,
+                                       const std::filesystem::path& newFile, std::stop_token stopToken) {
+    std::error_code error;
+    const uint64_t patchSize = std::filesystem::file_size(patchFile, error);
+    if (error || patchSize < HEADER_SIZE) {
+        return Fail(newFile, "Cannot read patch " + patchFile.string());
+    }
+    const uint64_t oldSize = std::filesystem::file_size(oldFile, error);
+    if (error) {
+        return Fail(newFile, "Cannot read " + oldFile.string());
+    }
+
+    std::array<unsigned char, HEADER_SIZE> header{};
+    {
+        std::ifstream patch(patchFile, std::ios::binary);
+        patch.read(reinterpret_cast<char*>(header.data()), header.size());
+        if (patch.gcount() != static_cast<std::streamsize>(header.size()) ||
+            std::string_view(reinterpret_cast<const char*>(header.data()), MAGIC.size()) != MAGIC) {
+            return Fail(newFile, "Not a BSDIFF40 patch");
+        }
+    }
+
+    const int64_t controlLength = ReadOfftin(&header[8]);
+    const int64_t diffLength = ReadOfftin(&header[16]);
+    const int64_t newSize = ReadOfftin(&header[24]);
+    // The size limits keep every old file position below (see the seek check) far from overflowing
+    if (controlLength < 0 || diffLength < 0 || newSize < 0 || newSize > MAX_POSITION ||
+        oldSize > static_cast<uint64_t>(MAX_POSITION) ||
+        static_cast<uint64_t>(controlLength) > patchSize - HEADER_SIZE ||
+        static_cast<uint64_t>(diffLength) > patchSize - HEADER_SIZE - static_cast<uint64_t>(controlLength)) {
+        return Fail(newFile, "Corrupt patch header");
+    }
+
+    const uint64_t diffOffset = HEADER_SIZE + static_cast<uint64_t>(controlLength);
+    const uint64_t extraOffset = diffOffset + static_cast<uint64_t>(diffLength);
+    Bz2Section control(patchFile, HEADER_SIZE, static_cast<uint64_t>(controlLength));
+    Bz2Section diff(patchFile, diffOffset, static_cast<uint64_t>(diffLength));
+    Bz2Section extra(patchFile, extraOffset, patchSize - extraOffset);
+    std::ifstream old(oldFile, std::ios::binary);
+    if (!control.IsOpen() || !diff.IsOpen() || !extra.IsOpen() || !old.is_open()) {
+        return Fail(newFile, "Cannot open patch sections");
+    }
+
+    std::ofstream output(newFile, std::ios::binary | std::ios::trunc);
+    if (!output.is_open()) {
+        return Fail(newFile, "Cannot write " + newFile.string());
+    }
+
+    Sha256 hash;
+    std::vector<char> buffer(BUFFER_SIZE);
+    std::vector<char> oldBuffer(BUFFER_SIZE);
+    auto emit = [&](size_t count) {
+        output.write(buffer.data(), static_cast<std::streamsize>(count));
+        hash.Update(std::string_view(buffer.data(), count));
+    };
+
+    int64_t oldPosition = 0;
+    int64_t newPosition = 0;
+    while (newPosition < newSize) {
+        if (stopToken.stop_requested()) {
+            output.close();
+            return Fail(newFile, "Cancelled");
+        }
+
+        std::array<unsigned char, CONTROL_SIZE> record{};
+        if (!control.Read(reinterpret_cast<char*>(record.data()), record.size())) {
+            output.close();
+            return Fail(newFile, "Corrupt patch control data");
+        }
+        const int64_t diffCount = ReadOfftin(&record[0]);
+        const int64_t extraCount = ReadOfftin(&record[8]);
+        const int64_t seek = ReadOfftin(&record[16]);
+        if (diffCount < 0 || extraCount < 0 || diffCount > newSize - newPosition ||
+            extraCount > newSize - newPosition - diffCount) {
+            output.close();
+            return Fail(newFile, "Patch writes past the end of the output");
+        }
+
+        // Diff section: output bytes are old bytes plus the stored difference
+        for (int64_t remaining = diffCount; remaining > 0;) {
+            const auto count = static_cast<size_t>(std::min<int64_t>(remaining, BUFFER_SIZE));
+            if (!diff.Read(buffer.data(), count) || !ReadOld(old, oldSize, oldPosition, oldBuffer.data(), count)) {
+                output.close();
+                return Fail(newFile, "Corrupt patch diff data");
+            }
+            for (size_t i = 0; i < count; ++i) {
+                buffer[i] = static_cast<char>(static_cast<unsigned char>(buffer[i]) +
+                                              static_cast<unsigned char>(oldBuffer[i]));
+            }
+            emit(count);
+            oldPosition += static_cast<int64_t>(count);
+            remaining -= static_cast<int64_t>(count);
+        }
+
+        // Extra section: new bytes copied verbatim
+        for (int64_t remaining = extraCount; remaining > 0;) {
+            const auto count = static_cast<size_t>(std::min<int64_t>(remaining, BUFFER_SIZE));
+            if (!extra.Read(buffer.data(), count)) {
+                output.close();
+                return Fail(newFile, "Corrupt patch extra data");
+            }
+            emit(count);
+            remaining -= static_cast<int64_t>(count);
+        }
+
+        newPosition += diffCount + extraCount;
+        // oldPosition stays within [-newSize, oldSize + newSize] after a seek and grows by at most newSize
+        // before the next one, so neither bound below nor any read position can overflow
+        if (seek < -newSize - oldPosition || seek > static_cast<int64_t>(oldSize) + newSize - oldPosition) {
+            output.close();
+            return Fail(newFile, "Corrupt patch control data");
+        }
+        oldPosition += seek;
+    }
+
+    output.close();
+    if (output.fail()) {
+        return Fail(newFile, "Failed to write " + newFile.string());
+    }
+
+    Result result;
+    result.succeeded = true;
+    result.size = static_cast<uint64_t>(newSize);
+    result.sha256 = Sha256::ToHex(hash.Finish());
+    return result;
+}
+
+} // namespace MetaImGUI
@@ -0,0 +1,207 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "CommandIndex.h"
+
+#include <algorithm>
+
+namespace MetaImGUI {
+
+namespace {
+// ASCII only: other bytes, including UTF-8 sequences, must match exactly
+char FoldCase(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+bool IsUpper(char c) {
+    return c >= 'A' && c <= 'Z';
+}
+
+// Bytes of UTF-8 sequences count as word characters so a word never starts mid-sequence
+bool IsWordCharacter(char c) {
+    const auto byte = static_cast<unsigned char>(c);
+    return (byte >= 'a' && byte <= 'z') || (byte >= 'A' && byte <= 'Z') || (byte >= '0' && byte <= '9') ||
+           byte >= 0x80;
+}
+
+// Letters and digits get a bit each; the remaining bytes share the other 28
+uint64_t CharacterBit(char c) {
+    const auto byte = static_cast<unsigned char>(c);
+    if (byte >= 'a' && byte <= 'z') {
+        return uint64_t{1} << (byte - 'a');
+    }
+    if (byte >= '0' && byte <= '9') {
+        return uint64_t{1} << (26 + byte - '0');
+    }
+    return uint64_t{1} << (36 + (byte % 28));
+}
+
+// True if every character of needle appears in haystack, in order
+bool IsSubsequence(std::string_view needle, std::string_view haystack) {
+    size_t matched = 0;
+    for (size_t i = 0; i < haystack.size() && matched < needle.size(); ++i) {
+        matched += static_cast<size_t>(haystack[i] == needle[matched]);
+    }
+    return matched == needle.size();
+}
+} // namespace
+
+CommandIndex::CommandIndex(const std::vector<std::string>& labels) {
+    m_offsets.reserve(labels.size() + 1);
+    m_masks.reserve(labels.size());
+    m_offsets.push_back(0);
+
+    for (const std::string& label : labels) {
+        for (size_t i = 0; i < label.size(); ++i) {
+            const char c = label[i];
+            const bool wordStart = IsWordCharacter(c) &&
+                                   (i == 0 || !IsWordCharacter(label[i - 1]) || (IsUpper(c) && !IsUpper(label[i - 1])));
+            m_folded.push_back(FoldCase(c));
+            m_wordStarts.push_back(static_cast<uint8_t>(wordStart));
+        }
+        const std::string_view folded(m_folded.data() + m_offsets.back(), label.size());
+        m_masks.push_back(CharacterMask(folded));
+        m_offsets.push_back(static_cast<uint32_t>(m_folded.size()));
+    }
+}
+
+std::string CommandIndex::FoldQuery(std::string_view query) {
+    std::string folded;
+    folded.reserve(query.size());
+    for (const char c : query) {
+        if (c != ' ') {
+            folded.push_back(FoldCase(c));
+        }
+    }
+    return folded;
+}
+
+uint64_t CommandIndex::CharacterMask(std::string_view folded) {
+    uint64_t mask = 0;
+    for (const char c : folded) {
+        mask |= CharacterBit(c);
+    }
+    return mask;
+}
+
+void CommandIndex::Prefilter(uint64_t queryMask, std::vector<uint32_t>& out) const {
+    // Branch-free compaction over the contiguous masks: every slot is written, only survivors advance
+    const size_t first = out.size();
+    out.resize(first + m_masks.size());
+    uint32_t* dest = out.data() + first;
+    size_t kept = 0;
+    for (size_t i = 0; i < m_masks.size(); ++i) {
+        dest[kept] = static_cast<uint32_t>(i);
+        kept += static_cast<size_t>((m_masks[i] & queryMask) == queryMask);
+    }
+    out.resize(first + kept);
+}
+
+int32_t CommandIndex::Score(size_t command, std::string_view foldedQuery) const {
+    const std::string_view text(m_folded.data() + m_offsets[command], m_offsets[command + 1] - m_offsets[command]);
+    const uint8_t* wordStarts = m_wordStarts.data() + m_offsets[command];
+
+    // Forward: the earliest point by which the whole query has matched
+    size_t end = 0;
+    size_t matched = 0;
+    for (; end < text.size() && matched < foldedQuery.size(); ++end) {
+        matched += static_cast<size_t>(text[end] == foldedQuery[matched]);
+    }
+    if (matched < foldedQuery.size()) {
+        return 0;
+    }
+
+    // Backward from there, taking the latest occurrence of each character, which tightens the match
+    int32_t score = 0;
+    size_t next = end; // Position of the following matched character; end while there is none
+    size_t pos = end;
+    for (size_t remaining = foldedQuery.size(); remaining > 0;) {
+        --pos;
+        if (text[pos] != foldedQuery[remaining - 1]) {
+            continue;
+        }
+        --remaining;
+        score += SCORE_MATCH;
+        if (wordStarts[pos] != 0) {
+            score += BONUS_WORD_START;
+        }
+        if (next != end) {
+            const auto gap = static_cast<int32_t>(std::min<size_t>(next - pos - 1, PENALTY_GAP_MAX));
+            score += (gap == 0) ? BONUS_CONSECUTIVE : -std::min(gap * PENALTY_GAP, PENALTY_GAP_MAX);
+        }
+        next = pos;
+    }
+    if (next == 0) {
+        score += BONUS_LABEL_START;
+    }
+    return std::max(score, int32_t{1});
+}
+
+void CommandSearch::SetIndex(std::shared_ptr<const CommandIndex> index) {
+    m_index = std::move(index);
+    Update(false);
+}
+
+void CommandSearch::SetQuery(std::string_view query) {
+    std::string folded = CommandIndex::FoldQuery(query);
+    if (folded == m_query) {
+        return;
+    }
+
+    // Every label matching the new query also matches the old one
+    const bool narrowing = !m_query.empty() && IsSubsequence(m_query, folded);
+    m_query = std::move(folded);
+    Update(narrowing);
+}
+
+void CommandSearch::Update(bool narrowing) {
+    m_candidates.clear();
+    if (narrowing) {
+        for (const Result& result : m_results) {
+            m_candidates.push_back(result.command);
+        }
+    }
+    m_results.clear();
+    m_scored = 0;
+    if (!m_index) {
+        return;
+    }
+
+    if (m_query.empty()) {
+        for (size_t command = 0; command < m_index->GetCount(); ++command) {
+            m_results.push_back({static_cast<uint32_t>(command), 0});
+        }
+        return;
+    }
+
+    if (!narrowing) {
+        m_index->Prefilter(CommandIndex::CharacterMask(m_query), m_candidates);
+    }
+    for (const uint32_t command : m_candidates) {
+        if (const int32_t score = m_index->Score(command, m_query); score > 0) {
+            m_results.push_back({command, score});
+        }
+    }
+    m_scored = m_candidates.size();
+
+    std::sort(m_results.begin(), m_results.end(), [](const Result& a, const Result& b) {
+        return a.score != b.score ? a.score > b.score : a.command < b.command;
+    });
+}
+
+} // namespace MetaImGUI
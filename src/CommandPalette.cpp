@@ -0,0 +1,217 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "CommandPalette.h"
+
+#include "Localization.h"
+#include "Logger.h"
+
+#include <imgui.h>
+
+#include <cfloat>
+#include <mutex>
+#include <utility>
+
+namespace MetaImGUI {
+
+struct CommandPalette::PendingBuild {
+    std::mutex mutex;
+    std::shared_ptr<const CommandIndex> index; // Newest finished build
+    uint64_t build = 0;
+};
+
+CommandPalette::CommandPalette(CommandSource source, TaskScheduler& scheduler)
+    : m_source(std::move(source)), m_scheduler(scheduler), m_pending(std::make_shared<PendingBuild>()) {}
+
+CommandPalette::~CommandPalette() {
+    // A running build finishes into m_pending, which it shares
+    m_buildTask.Cancel();
+}
+
+void CommandPalette::Open() {
+    m_open = true;
+    m_focusInput = true;
+    m_query[0] = '\0';
+    m_search.SetQuery("");
+    m_selected = 0;
+}
+
+void CommandPalette::Close() {
+    m_open = false;
+}
+
+void CommandPalette::Update() {
+    if (Localization::Instance().GetCurrentLanguage() != m_language) {
+        RequestBuild();
+    }
+    if (m_installedBuild == m_requestedBuild) {
+        return;
+    }
+
+    std::shared_ptr<const CommandIndex> index;
+    {
+        const std::lock_guard<std::mutex> lock(m_pending->mutex);
+        if (m_pending->build != m_requestedBuild) {
+            return;
+        }
+        index = std::move(m_pending->index);
+    }
+
+    // The commands and the index are swapped together; the query carries over
+    m_commands = std::move(m_buildingCommands);
+    m_buildingCommands.clear();
+    m_installedBuild = m_requestedBuild;
+    m_search.SetIndex(std::move(index));
+    m_selected = 0;
+    LOG_DEBUG("Command palette indexed {} commands for '{}'", m_commands.size(), m_language);
+}
+
+void CommandPalette::RequestBuild() {
+    // Labels are resolved here: Localization is not safe to use from the worker
+    m_language = Localization::Instance().GetCurrentLanguage();
+    m_buildingCommands = m_source();
+
+    std::vector<std::string> labels;
+    labels.reserve(m_buildingCommands.size());
+    for (const Command& command : m_buildingCommands) {
+        labels.push_back(command.category + ' ' + command.label);
+    }
+
+    // A superseded build that has not started is skipped; one that has is discarded on arrival
+    m_buildTask.Cancel();
+    const uint64_t build = ++m_requestedBuild;
+    m_buildTask = m_scheduler.Submit(
+        [pending = m_pending, labels = std::move(labels), build](std::stop_token stopToken) {
+            if (stopToken.stop_requested()) {
+                return;
+            }
+            auto index = std::make_shared<const CommandIndex>(labels);
+            const std::lock_guard<std::mutex> lock(pending->mutex);
+            if (build > pending->build) {
+                pending->index = std::move(index);
+                pending->build = build;
+            }
+        },
+        TaskPriority::Low);
+}
+
+void CommandPalette::MoveSelection(int delta) {
+    const size_t count = m_search.GetResults().size();
+    if (count == 0) {
+        return;
+    }
+    if (delta < 0) {
+        m_selected = (m_selected == 0) ? count - 1 : m_selected - 1;
+    } else {
+        m_selected = (m_selected + 1) % count;
+    }
+    m_scrollToSelected = true;
+}
+
+void CommandPalette::Render() {
+    if (!m_open) {
+        return;
+    }
+
+    auto& loc = Localization::Instance();
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(
+        ImVec2(viewport->WorkPos.x + (viewport->WorkSize.x * 0.5f), viewport->WorkPos.y + PALETTE_TOP_OFFSET),
+        ImGuiCond_Always, ImVec2(0.5f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(PALETTE_WIDTH, 0.0f)); // Height fits the content
+    if (m_focusInput) {
+        ImGui::SetNextWindowFocus();
+    }
+
+    const Command* picked = nullptr;
+    constexpr ImGuiWindowFlags flags = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize |
+                                       ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoCollapse |
+                                       ImGuiWindowFlags_NoSavedSettings;
+
+    if (ImGui::Begin("##CommandPalette", nullptr, flags)) {
+        if (m_focusInput) {
+            ImGui::SetKeyboardFocusHere();
+            m_focusInput = false;
+        }
+
+        // Up/Down move the selection while the input keeps the keyboard
+        const auto onInputEvent = [](ImGuiInputTextCallbackData* data) {
+            static_cast<CommandPalette*>(data->UserData)->MoveSelection(data->EventKey == ImGuiKey_UpArrow ? -1 : 1);
+            return 0;
+        };
+        ImGui::SetNextItemWidth(-FLT_MIN);
+        if (ImGui::InputTextWithHint("##query", loc.Tr("palette.hint").c_str(), m_query.data(), m_query.size(),
+                                     ImGuiInputTextFlags_CallbackHistory, onInputEvent, this)) {
+            m_search.SetQuery(m_query.data());
+            m_selected = 0;
+            m_scrollToSelected = true;
+        }
+
+        const std::vector<CommandSearch::Result>& results = m_search.GetResults();
+        if (m_installedBuild == 0) {
+            ImGui::TextDisabled("%s", loc.Tr("palette.indexing").c_str());
+        }
+
+        const float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+        if (ImGui::BeginChild("##results", ImVec2(0.0f, rowHeight * VISIBLE_ROWS))) {
+            // Only the visible rows are submitted; the selection is kept in range for keyboard scrolling
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(results.size()), rowHeight);
+            if (m_scrollToSelected && m_selected < results.size()) {
+                clipper.IncludeItemByIndex(static_cast<int>(m_selected));
+            }
+            while (clipper.Step()) {
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                    const auto rowIndex = static_cast<size_t>(row);
+                    const Command& command = m_commands[results[rowIndex].command];
+                    ImGui::PushID(row);
+                    ImGui::TextDisabled("%s", command.category.c_str());
+                    ImGui::SameLine(CATEGORY_COLUMN_WIDTH);
+                    if (ImGui::Selectable(command.label.c_str(), rowIndex == m_selected)) {
+                        picked = &command;
+                    }
+                    if (m_scrollToSelected && rowIndex == m_selected) {
+                        if (!ImGui::IsItemVisible()) {
+                            ImGui::SetScrollHereY();
+                        }
+                        m_scrollToSelected = false;
+                    }
+                    ImGui::PopID();
+                }
+            }
+        }
+        ImGui::EndChild();
+
+        if ((ImGui::IsKeyPressed(ImGuiKey_Enter) || ImGui::IsKeyPressed(ImGuiKey_KeypadEnter)) &&
+            m_selected < results.size()) {
+            picked = &m_commands[results[m_selected].command];
+        }
+        if (ImGui::IsKeyPressed(ImGuiKey_Escape) || !ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows)) {
+            m_open = false;
+        }
+    }
+    ImGui::End();
+
+    // Run outside the palette window; the command may open windows or dialogs of its own
+    if (picked != nullptr) {
+        m_open = false;
+        picked->run();
+    }
+}
+
+} // namespace MetaImGUI
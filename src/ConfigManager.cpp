@@ -280,6 +280,24 @@ std::optional<int> ConfigManager::GetInt(const std::string& key) const {
     return std::nullopt;
 }
 
+void ConfigManager::SetInt64(const std::string& key, int64_t value) {
+    if (!m_impl->config.contains("settings")) {
+        m_impl->config["settings"] = json::object();
+    }
+    m_impl->config["settings"][key] = value;
+}
+
+std::optional<int64_t> ConfigManager::GetInt64(const std::string& key) const {
+    try {
+        if (m_impl->config.contains("settings") && m_impl->config["settings"].contains(key)) {
+            return m_impl->config["settings"][key].get<int64_t>();
+        }
+    } catch (const json::exception& e) {
+        LOG_WARNING("Failed to get int64 '{}' from config: {}", key, e.what());
+    }
+    return std::nullopt;
+}
+
 void ConfigManager::SetBool(const std::string& key, bool value) {
     if (!m_impl->config.contains("settings")) {
         m_impl->config["settings"] = json::object();
@@ -18,17 +18,27 @@
 
 #include "DialogManager.h"
 
+#include "FrameArena.h"
+#include "ListFilter.h"
 #include "Localization.h"
 
 #include <imgui.h>
 
 #include <algorithm>
 #include <array>
+#include <charconv>
 #include <iterator>
 #include <map>
+#include <memory_resource>
 
 namespace MetaImGUI {
 
+namespace {
+// Items a list dialog's filter indexes or tests per frame: a million-item list is indexed
+// in 40 frames, at a few milliseconds per frame even with a slow provider
+constexpr size_t LIST_FILTER_ITEMS_PER_FRAME = 25000;
+} // namespace
+
 // Internal dialog state structures
 struct MessageBoxState {
     std::string title;
@@ -52,13 +62,19 @@ struct ProgressDialogState {
     std::string title;
     std::string message;
     float progress = 0.0f;
+    std::function<void()> onCancel;
     bool open = true;
 };
 
 struct ListDialogState {
+    explicit ListDialogState(std::shared_ptr<const ListDataProvider> items)
+        : provider(std::move(items)), filter(*provider) {}
+
     std::string title;
-    std::vector<std::string> items;
-    int selectedIndex = -1;
+    std::shared_ptr<const ListDataProvider> provider;
+    ListFilter filter; // Refers to *provider
+    std::array<char, 256> filterText{};
+    int selectedIndex = -1; // Item index, so the selection survives filtering
     std::function<void(int)> callback;
     bool open = true;
 };
@@ -119,15 +135,17 @@ void DialogManager::ShowInputDialog(const std::string& title, const std::string&
     buffer[std::size(buffer) - 1] = '\0';
 }
 
-int DialogManager::ShowProgressDialog(const std::string& title, const std::string& message) {
+int DialogManager::ShowProgressDialog(const std::string& title, const std::string& message,
+                                      std::function<void()> onCancel) {
     const int id = m_impl->nextProgressId++;
     ProgressDialogState state;
     state.id = id;
     state.title = title;
     state.message = message;
     state.progress = 0.0f;
+    state.onCancel = std::move(onCancel);
     state.open = true;
-    m_impl->progressDialogs[id] = state;
+    m_impl->progressDialogs[id] = std::move(state);
     return id;
 }
 
@@ -147,11 +165,15 @@ void DialogManager::CloseProgress(int dialogId) {
 
 void DialogManager::ShowListDialog(const std::string& title, const std::vector<std::string>& items,
                                    std::function<void(int)> callback) {
-    m_impl->listDialog = std::make_unique<ListDialogState>();
+    ShowListDialog(title, std::make_shared<VectorListDataProvider>(items), std::move(callback));
+}
+
+void DialogManager::ShowListDialog(const std::string& title, std::shared_ptr<const ListDataProvider> items,
+                                   std::function<void(int)> callback) {
+    m_impl->listDialog = std::make_unique<ListDialogState>(std::move(items));
     m_impl->listDialog->title = title;
-    m_impl->listDialog->items = items;
     m_impl->listDialog->selectedIndex = -1;
-    m_impl->listDialog->callback = callback;
+    m_impl->listDialog->callback = std::move(callback);
     m_impl->listDialog->open = true;
 }
 
@@ -354,6 +376,9 @@ void DialogManager::RenderInputDialog() {
 }
 
 void DialogManager::RenderProgressDialogs() {
+    // Run after the loop: a callback may show or close progress dialogs
+    std::vector<std::function<void()>> cancelled;
+
     for (auto it = m_impl->progressDialogs.begin(); it != m_impl->progressDialogs.end();) {
         auto& pd = it->second;
 
@@ -362,7 +387,11 @@ void DialogManager::RenderProgressDialogs() {
             continue;
         }
 
-        const std::string popupId = pd.title + "##" + std::to_string(pd.id);
+        // Frame scratch: ImGui copies or hashes the id and keeps no pointer to it
+        std::pmr::string popupId(pd.title.data(), pd.title.size(), &FrameArena::Instance());
+        std::array<char, 16> idDigits{};
+        const auto idEnd = std::to_chars(idDigits.data(), idDigits.data() + idDigits.size(), pd.id).ptr;
+        popupId.append("##").append(idDigits.data(), idEnd);
         ImGui::OpenPopup(popupId.c_str());
         const ImVec2 center = ImGui::GetMainViewport()->GetCenter();
         ImGui::SetNextWindowPos(center, ImGuiCond_Appearing, ImVec2(0.5f, 0.5f));
@@ -380,11 +409,24 @@ void DialogManager::RenderProgressDialogs() {
             // Show percentage
             ImGui::Text("%.1f%%", pd.progress * 100.0f);
 
+            if (pd.onCancel) {
+                ImGui::Spacing();
+                if (ImGui::Button(Localization::Instance().Tr("button.cancel").c_str(), ImVec2(100, 0))) {
+                    pd.open = false;
+                    ImGui::CloseCurrentPopup();
+                    cancelled.push_back(std::move(pd.onCancel));
+                }
+            }
+
             ImGui::EndPopup();
         }
 
         ++it;
     }
+
+    for (const auto& onCancel : cancelled) {
+        onCancel();
+    }
 }
 
 void DialogManager::RenderListDialog() {
@@ -402,29 +444,54 @@ void DialogManager::RenderListDialog() {
 
     if (ImGui::BeginPopupModal(ld->title.c_str(), &ld->open,
                                ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoMove)) {
+        auto& loc = Localization::Instance();
+
+        // Type-ahead filter, focused when the dialog opens
+        if (ImGui::IsWindowAppearing()) {
+            ImGui::SetKeyboardFocusHere();
+        }
+        ImGui::SetNextItemWidth(300.0f);
+        if (ImGui::InputTextWithHint("##filter", loc.Tr("list.filter_hint").c_str(), ld->filterText.data(),
+                                     ld->filterText.size())) {
+            ld->filter.SetQuery(ld->filterText.data());
+        }
+        const bool filterComplete = ld->filter.Step(LIST_FILTER_ITEMS_PER_FRAME);
+
         ImGui::BeginChild("ListBox", ImVec2(300, 200), ImGuiChildFlags_Border);
 
-        const auto itemCount = static_cast<int>(ld->items.size());
-        for (int i = 0; i < itemCount; ++i) {
-            const bool isSelected = (i == ld->selectedIndex);
-            if (ImGui::Selectable(ld->items[static_cast<size_t>(i)].c_str(), isSelected,
-                                  ImGuiSelectableFlags_AllowDoubleClick)) {
-                ld->selectedIndex = i;
-                if (ImGui::IsMouseDoubleClicked(0)) {
-                    confirmed = true;
-                    selectedIndex = ld->selectedIndex;
-                    ld->open = false;
+        // Only the visible rows are submitted (and read from the provider)
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(ld->filter.GetRowCount()));
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                const size_t item = ld->filter.GetItemIndex(static_cast<size_t>(row));
+                const auto itemIndex = static_cast<int>(item);
+                ImGui::PushID(itemIndex);
+                if (ImGui::Selectable(ld->provider->GetItem(item), itemIndex == ld->selectedIndex,
+                                      ImGuiSelectableFlags_AllowDoubleClick)) {
+                    ld->selectedIndex = itemIndex;
+                    if (ImGui::IsMouseDoubleClicked(0)) {
+                        confirmed = true;
+                        selectedIndex = ld->selectedIndex;
+                        ld->open = false;
+                    }
                 }
+                ImGui::PopID();
             }
         }
 
         ImGui::EndChild();
 
+        if (!ld->filter.GetQuery().empty()) {
+            // The count leads in every language, so the translation is appended rather than used as a format
+            ImGui::TextDisabled("%zu %s", ld->filter.GetRowCount(),
+                                loc.Tr(filterComplete ? "list.matches" : "list.matches_searching").c_str());
+        }
+
         ImGui::Spacing();
         ImGui::Separator();
         ImGui::Spacing();
 
-        auto& loc = Localization::Instance();
         if (ImGui::Button(loc.Tr("button.ok").c_str(), ImVec2(100, 0)) && ld->selectedIndex >= 0) {
             confirmed = true;
             selectedIndex = ld->selectedIndex;
@@ -0,0 +1,55 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DrawBatcher.h"
+
+namespace MetaImGUI {
+
+void DrawBatcher::Reset() {
+    m_batches.clear();
+    m_counts.clear();
+    m_firstIndices.clear();
+    m_baseVertices.clear();
+    m_commandCount = 0;
+}
+
+void DrawBatcher::Add(uint64_t texture, size_t firstIndex, uint32_t indexCount, int32_t baseVertex) {
+    if (indexCount == 0) {
+        return;
+    }
+    ++m_commandCount;
+
+    if (m_batches.empty() || m_batches.back().texture != texture) {
+        m_batches.push_back({texture, m_counts.size(), 0});
+    } else {
+        // Same texture: join the previous range when this command continues it
+        const size_t last = m_counts.size() - 1;
+        if (m_baseVertices[last] == baseVertex &&
+            m_firstIndices[last] + static_cast<size_t>(m_counts[last]) == firstIndex) {
+            m_counts[last] += static_cast<int32_t>(indexCount);
+            return;
+        }
+    }
+
+    m_counts.push_back(static_cast<int32_t>(indexCount));
+    m_firstIndices.push_back(firstIndex);
+    m_baseVertices.push_back(baseVertex);
+    ++m_batches.back().rangeCount;
+}
+
+} // namespace MetaImGUI
@@ -0,0 +1,113 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "FrameArena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace MetaImGUI {
+
+namespace {
+// Chunks are allocated with this alignment, so any fundamental alignment fits at offset 0
+constexpr size_t CHUNK_ALIGNMENT = alignof(std::max_align_t);
+
+uintptr_t AlignUp(uintptr_t address, size_t alignment) {
+    return (address + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+}
+} // namespace
+
+FrameArena::FrameArena(size_t initialCapacity, std::pmr::memory_resource* upstream) : m_upstream(upstream) {
+    AddChunk((std::max)(initialCapacity, CHUNK_ALIGNMENT));
+    m_heapAllocations = 0; // The initial chunk does not belong to any frame
+}
+
+FrameArena::~FrameArena() {
+    ReleaseChunks();
+}
+
+FrameArena& FrameArena::Instance() {
+    static FrameArena instance;
+    return instance;
+}
+
+void FrameArena::Reset() {
+    m_lastFrameBytes = m_bytesUsed;
+    m_lastFrameHeapAllocations = m_heapAllocations;
+    m_peakBytes = (std::max)(m_peakBytes, m_bytesUsed);
+
+    // A frame that spilled gets one chunk big enough for all of it next time
+    if (m_chunks.size() > 1) {
+        const size_t capacity = GetCapacity();
+        ReleaseChunks();
+        AddChunk(capacity);
+    }
+    m_offset = 0;
+    m_bytesUsed = 0;
+    m_heapAllocations = 0;
+}
+
+size_t FrameArena::GetCapacity() const {
+    size_t capacity = 0;
+    for (const Chunk& chunk : m_chunks) {
+        capacity += chunk.size;
+    }
+    return capacity;
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+    // Align the address rather than the offset, so over-aligned requests are honoured too
+    auto alignedOffset = [this, alignment]() {
+        const auto base = reinterpret_cast<uintptr_t>(m_chunks.back().data);
+        return AlignUp(base + m_offset, alignment) - base;
+    };
+
+    size_t start = alignedOffset();
+    if (start + bytes > m_chunks.back().size) {
+        // Grow geometrically so a spilling frame takes few chunks
+        AddChunk((std::max)(m_chunks.back().size * 2, bytes + alignment));
+        start = alignedOffset();
+    }
+    m_bytesUsed += (start - m_offset) + bytes;
+    m_offset = start + bytes;
+    return m_chunks.back().data + start;
+}
+
+void FrameArena::do_deallocate(void* /*pointer*/, size_t /*bytes*/, size_t /*alignment*/) {
+    // Reclaimed in bulk by Reset()
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+void FrameArena::AddChunk(size_t size) {
+    auto* data = static_cast<std::byte*>(m_upstream->allocate(size, CHUNK_ALIGNMENT));
+    m_chunks.push_back({data, size});
+    m_offset = 0;
+    ++m_heapAllocations;
+}
+
+void FrameArena::ReleaseChunks() {
+    for (const Chunk& chunk : m_chunks) {
+        m_upstream->deallocate(chunk.data, chunk.size, CHUNK_ALIGNMENT);
+    }
+    m_chunks.clear();
+}
+
+} // namespace MetaImGUI
@@ -0,0 +1,77 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "FrameFingerprint.h"
+
+#include <cstring>
+
+namespace MetaImGUI {
+
+namespace {
+constexpr uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+uint64_t Mix(uint64_t lane, uint64_t word) {
+    lane = (lane ^ word) * MULTIPLIER;
+    return lane ^ (lane >> 29);
+}
+} // namespace
+
+void FrameHasher::Add(const void* data, size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    constexpr size_t WORD = sizeof(uint64_t);
+    constexpr size_t BLOCK = WORD * 4;
+
+    size_t offset = 0;
+    for (; offset + BLOCK <= size; offset += BLOCK) {
+        std::array<uint64_t, 4> words{};
+        std::memcpy(words.data(), bytes + offset, BLOCK);
+        for (size_t lane = 0; lane < m_lanes.size(); ++lane) {
+            m_lanes[lane] = Mix(m_lanes[lane], words[lane]);
+        }
+    }
+    for (size_t lane = 0; offset < size; offset += WORD, ++lane) {
+        uint64_t word = 0;
+        std::memcpy(&word, bytes + offset, (size - offset < WORD) ? size - offset : WORD);
+        m_lanes[lane] = Mix(m_lanes[lane], word);
+    }
+
+    // The length keeps "ab" + "c" distinct from "a" + "bc"
+    m_lanes[0] = Mix(m_lanes[0], size);
+    m_length += size;
+}
+
+uint64_t FrameHasher::Finish() const {
+    uint64_t hash = m_length * MULTIPLIER;
+    for (const uint64_t lane : m_lanes) {
+        hash = Mix(hash, lane);
+    }
+    return Mix(hash, hash >> 32);
+}
+
+bool PresentGate::ShouldPresent(uint64_t fingerprint, bool forcePresent) {
+    if (m_valid && !forcePresent && fingerprint == m_lastFingerprint) {
+        ++m_skipped;
+        return false;
+    }
+    m_lastFingerprint = fingerprint;
+    m_valid = true;
+    ++m_presented;
+    return true;
+}
+
+} // namespace MetaImGUI
@@ -0,0 +1,734 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "GLStreamRenderer.h"
+
+#include "Logger.h"
+
+// The entry points below are loaded through GLFW; no system GL header is needed
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#include <imgui.h>
+#include <imgui_impl_opengl3.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#define METAIMGUI_GL_APIENTRY __stdcall
+#else
+#define METAIMGUI_GL_APIENTRY
+#endif
+
+namespace MetaImGUI {
+
+namespace {
+// OpenGL types and enums used by the renderer, from the OpenGL 4.4 registry
+namespace gl {
+using Enum = unsigned int;
+using Uint = unsigned int;
+using Int = int;
+using Sizei = int;
+using Boolean = unsigned char;
+using Bitfield = unsigned int;
+using Float = float;
+using Char = char;
+using Sizeiptr = std::ptrdiff_t;
+using Intptr = std::ptrdiff_t;
+using Uint64 = uint64_t;
+struct SyncObject; // Opaque GLsync
+using Sync = SyncObject*;
+
+constexpr Boolean FALSE_ = 0;
+constexpr Enum TRIANGLES = 0x0004;
+constexpr Enum SRC_ALPHA = 0x0302;
+constexpr Enum ONE_MINUS_SRC_ALPHA = 0x0303;
+constexpr Enum ONE = 1;
+constexpr Enum CULL_FACE = 0x0B44;
+constexpr Enum DEPTH_TEST = 0x0B71;
+constexpr Enum STENCIL_TEST = 0x0B90;
+constexpr Enum BLEND = 0x0BE2;
+constexpr Enum SCISSOR_TEST = 0x0C11;
+constexpr Enum TEXTURE_2D = 0x0DE1;
+constexpr Enum UNSIGNED_BYTE = 0x1401;
+constexpr Enum UNSIGNED_SHORT = 0x1403;
+constexpr Enum UNSIGNED_INT = 0x1405;
+constexpr Enum FLOAT = 0x1406;
+constexpr Enum FUNC_ADD = 0x8006;
+constexpr Enum TEXTURE_BINDING_2D = 0x8069;
+constexpr Enum TEXTURE0 = 0x84C0;
+constexpr Enum ACTIVE_TEXTURE = 0x84E0;
+constexpr Enum VERTEX_ARRAY_BINDING = 0x85B5;
+constexpr Enum ARRAY_BUFFER = 0x8892;
+constexpr Enum ELEMENT_ARRAY_BUFFER = 0x8893;
+constexpr Enum ARRAY_BUFFER_BINDING = 0x8894;
+constexpr Enum FRAGMENT_SHADER = 0x8B30;
+constexpr Enum VERTEX_SHADER = 0x8B31;
+constexpr Enum COMPILE_STATUS = 0x8B81;
+constexpr Enum LINK_STATUS = 0x8B82;
+constexpr Enum INFO_LOG_LENGTH = 0x8B84;
+constexpr Enum CURRENT_PROGRAM = 0x8B8D;
+constexpr Enum PRIMITIVE_RESTART = 0x8F9D;
+constexpr Enum SYNC_GPU_COMMANDS_COMPLETE = 0x9117;
+constexpr Enum ALREADY_SIGNALED = 0x911A;
+constexpr Enum CONDITION_SATISFIED = 0x911C;
+constexpr Enum WAIT_FAILED = 0x911D;
+constexpr Bitfield SYNC_FLUSH_COMMANDS_BIT = 0x0001;
+constexpr Bitfield MAP_WRITE_BIT = 0x0002;
+constexpr Bitfield MAP_PERSISTENT_BIT = 0x0040;
+constexpr Bitfield MAP_COHERENT_BIT = 0x0080;
+} // namespace gl
+
+// Loaded entry points; named as in OpenGL without the gl prefix
+struct GLFunctions {
+    void(METAIMGUI_GL_APIENTRY* ActiveTexture)(gl::Enum);
+    void(METAIMGUI_GL_APIENTRY* AttachShader)(gl::Uint, gl::Uint);
+    void(METAIMGUI_GL_APIENTRY* BindBuffer)(gl::Enum, gl::Uint);
+    void(METAIMGUI_GL_APIENTRY* BindTexture)(gl::Enum, gl::Uint);
+    void(METAIMGUI_GL_APIENTRY* BindVertexArray)(gl::Uint);
+    void(METAIMGUI_GL_APIENTRY* BlendEquation)(gl::Enum);
+    void(METAIMGUI_GL_APIENTRY* BlendFuncSeparate)(gl::Enum, gl::Enum, gl::Enum, gl::Enum);
+    void(METAIMGUI_GL_APIENTRY* BufferStorage)(gl::Enum, gl::Sizeiptr, const void*, gl::Bitfield);
+    gl::Enum(METAIMGUI_GL_APIENTRY* ClientWaitSync)(gl::Sync, gl::Bitfield, gl::Uint64);
+    void(METAIMGUI_GL_APIENTRY* CompileShader)(gl::Uint);
+    gl::Uint(METAIMGUI_GL_APIENTRY* CreateProgram)();
+    gl::Uint(METAIMGUI_GL_APIENTRY* CreateShader)(gl::Enum);
+    void(METAIMGUI_GL_APIENTRY* DeleteBuffers)(gl::Sizei, const gl::Uint*);
+    void(METAIMGUI_GL_APIENTRY* DeleteProgram)(gl::Uint);
+    void(METAIMGUI_GL_APIENTRY* DeleteShader)(gl::Uint);
+    void(METAIMGUI_GL_APIENTRY* DeleteSync)(gl::Sync);
+    void(METAIMGUI_GL_APIENTRY* DeleteVertexArrays)(gl::Sizei, const gl::Uint*);
+    void(METAIMGUI_GL_APIENTRY* Disable)(gl::Enum);
+    void(METAIMGUI_GL_APIENTRY* DrawElementsBaseVertex)(gl::Enum, gl::Sizei, gl::Enum, const void*, gl::Int);
+    void(METAIMGUI_GL_APIENTRY* Enable)(gl::Enum);
+    void(METAIMGUI_GL_APIENTRY* EnableVertexAttribArray)(gl::Uint);
+    gl::Sync(METAIMGUI_GL_APIENTRY* FenceSync)(gl::Enum, gl::Bitfield);
+    void(METAIMGUI_GL_APIENTRY* GenBuffers)(gl::Sizei, gl::Uint*);
+    void(METAIMGUI_GL_APIENTRY* GenVertexArrays)(gl::Sizei, gl::Uint*);
+    void(METAIMGUI_GL_APIENTRY* GetIntegerv)(gl::Enum, gl::Int*);
+    void(METAIMGUI_GL_APIENTRY* GetProgramInfoLog)(gl::Uint, gl::Sizei, gl::Sizei*, gl::Char*);
+    void(METAIMGUI_GL_APIENTRY* GetProgramiv)(gl::Uint, gl::Enum, gl::Int*);
+    void(METAIMGUI_GL_APIENTRY* GetShaderInfoLog)(gl::Uint, gl::Sizei, gl::Sizei*, gl::Char*);
+    void(METAIMGUI_GL_APIENTRY* GetShaderiv)(gl::Uint, gl::Enum, gl::Int*);
+    gl::Int(METAIMGUI_GL_APIENTRY* GetUniformLocation)(gl::Uint, const gl::Char*);
+    gl::Boolean(METAIMGUI_GL_APIENTRY* IsEnabled)(gl::Enum);
+    void(METAIMGUI_GL_APIENTRY* LinkProgram)(gl::Uint);
+    void(METAIMGUI_GL_APIENTRY* MultiDrawElementsBaseVertex)(gl::Enum, const gl::Sizei*, gl::Enum, const void* const*,
+                                                              gl::Sizei, const gl::Int*);
+    void*(METAIMGUI_GL_APIENTRY* MapBufferRange)(gl::Enum, gl::Intptr, gl::Sizeiptr, gl::Bitfield);
+    void(METAIMGUI_GL_APIENTRY* Scissor)(gl::Int, gl::Int, gl::Sizei, gl::Sizei);
+    void(METAIMGUI_GL_APIENTRY* ShaderSource)(gl::Uint, gl::Sizei, const gl::Char* const*, const gl::Int*);
+    void(METAIMGUI_GL_APIENTRY* Uniform1i)(gl::Int, gl::Int);
+    void(METAIMGUI_GL_APIENTRY* UniformMatrix4fv)(gl::Int, gl::Sizei, gl::Boolean, const gl::Float*);
+    void(METAIMGUI_GL_APIENTRY* UseProgram)(gl::Uint);
+    void(METAIMGUI_GL_APIENTRY* VertexAttribPointer)(gl::Uint, gl::Int, gl::Enum, gl::Boolean, gl::Sizei,
+                                                      const void*);
+    void(METAIMGUI_GL_APIENTRY* Viewport)(gl::Int, gl::Int, gl::Sizei, gl::Sizei);
+};
+
+template <typename Function>
+bool LoadFunction(Function& function, const char* name) {
+    function = reinterpret_cast<Function>(glfwGetProcAddress(name));
+    if (function == nullptr) {
+        LOG_WARNING("GL stream renderer: {} is not available", name);
+    }
+    return function != nullptr;
+}
+
+bool LoadFunctions(GLFunctions& f) {
+    bool loaded = true;
+    loaded &= LoadFunction(f.ActiveTexture, "glActiveTexture");
+    loaded &= LoadFunction(f.AttachShader, "glAttachShader");
+    loaded &= LoadFunction(f.BindBuffer, "glBindBuffer");
+    loaded &= LoadFunction(f.BindTexture, "glBindTexture");
+    loaded &= LoadFunction(f.BindVertexArray, "glBindVertexArray");
+    loaded &= LoadFunction(f.BlendEquation, "glBlendEquation");
+    loaded &= LoadFunction(f.BlendFuncSeparate, "glBlendFuncSeparate");
+    loaded &= LoadFunction(f.BufferStorage, "glBufferStorage");
+    loaded &= LoadFunction(f.ClientWaitSync, "glClientWaitSync");
+    loaded &= LoadFunction(f.CompileShader, "glCompileShader");
+    loaded &= LoadFunction(f.CreateProgram, "glCreateProgram");
+    loaded &= LoadFunction(f.CreateShader, "glCreateShader");
+    loaded &= LoadFunction(f.DeleteBuffers, "glDeleteBuffers");
+    loaded &= LoadFunction(f.DeleteProgram, "glDeleteProgram");
+    loaded &= LoadFunction(f.DeleteShader, "glDeleteShader");
+    loaded &= LoadFunction(f.DeleteSync, "glDeleteSync");
+    loaded &= LoadFunction(f.DeleteVertexArrays, "glDeleteVertexArrays");
+    loaded &= LoadFunction(f.Disable, "glDisable");
+    loaded &= LoadFunction(f.DrawElementsBaseVertex, "glDrawElementsBaseVertex");
+    loaded &= LoadFunction(f.Enable, "glEnable");
+    loaded &= LoadFunction(f.EnableVertexAttribArray, "glEnableVertexAttribArray");
+    loaded &= LoadFunction(f.FenceSync, "glFenceSync");
+    loaded &= LoadFunction(f.GenBuffers, "glGenBuffers");
+    loaded &= LoadFunction(f.GenVertexArrays, "glGenVertexArrays");
+    loaded &= LoadFunction(f.GetIntegerv, "glGetIntegerv");
+    loaded &= LoadFunction(f.GetProgramInfoLog, "glGetProgramInfoLog");
+    loaded &= LoadFunction(f.GetProgramiv, "glGetProgramiv");
+    loaded &= LoadFunction(f.GetShaderInfoLog, "glGetShaderInfoLog");
+    loaded &= LoadFunction(f.GetShaderiv, "glGetShaderiv");
+    loaded &= LoadFunction(f.GetUniformLocation, "glGetUniformLocation");
+    loaded &= LoadFunction(f.IsEnabled, "glIsEnabled");
+    loaded &= LoadFunction(f.LinkProgram, "glLinkProgram");
+    loaded &= LoadFunction(f.MapBufferRange, "glMapBufferRange");
+    loaded &= LoadFunction(f.MultiDrawElementsBaseVertex, "glMultiDrawElementsBaseVertex");
+    loaded &= LoadFunction(f.Scissor, "glScissor");
+    loaded &= LoadFunction(f.ShaderSource, "glShaderSource");
+    loaded &= LoadFunction(f.Uniform1i, "glUniform1i");
+    loaded &= LoadFunction(f.UniformMatrix4fv, "glUniformMatrix4fv");
+    loaded &= LoadFunction(f.UseProgram, "glUseProgram");
+    loaded &= LoadFunction(f.VertexAttribPointer, "glVertexAttribPointer");
+    loaded &= LoadFunction(f.Viewport, "glViewport");
+    return loaded;
+}
+
+constexpr const char* VERTEX_SHADER_SOURCE = R"(#version 330 core
+layout (location = 0) in vec2 Position;
+layout (location = 1) in vec2 UV;
+layout (location = 2) in vec4 Color;
+layout (location = 3) in vec4 ClipRect;
+uniform mat4 ProjMtx;
+out vec2 Frag_UV;
+out vec4 Frag_Color;
+out vec2 Frag_Pos;
+flat out vec4 Frag_Clip;
+void main() {
+    Frag_UV = UV;
+    Frag_Color = Color;
+    Frag_Pos = Position;
+    Frag_Clip = ClipRect;
+    gl_Position = ProjMtx * vec4(Position.xy, 0.0, 1.0);
+}
+)";
+
+constexpr const char* FRAGMENT_SHADER_SOURCE = R"(#version 330 core
+in vec2 Frag_UV;
+in vec4 Frag_Color;
+in vec2 Frag_Pos;
+flat in vec4 Frag_Clip;
+uniform sampler2D Texture;
+layout (location = 0) out vec4 Out_Color;
+void main() {
+    // Clip rects travel with the vertices, so commands with different rects can share a draw call
+    if (any(lessThan(Frag_Pos, Frag_Clip.xy)) || any(greaterThanEqual(Frag_Pos, Frag_Clip.zw))) {
+        discard;
+    }
+    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);
+}
+)";
+
+// How long to wait for the GPU to release a region before giving up on the frame
+constexpr gl::Uint64 FENCE_TIMEOUT_NS = 1'000'000'000;
+
+size_t GrowCapacity(size_t current, size_t required) {
+    current = (std::max)(current, size_t{1}); // Zero after a failed reallocation
+    while (current < required) {
+        current *= 2;
+    }
+    return current;
+}
+} // namespace
+
+struct GLStreamRenderer::Impl {
+    GLFunctions gl{};
+    gl::Uint program = 0;
+    gl::Int textureLocation = -1;
+    gl::Int projectionLocation = -1;
+    gl::Uint vertexArray = 0;
+
+    // Vertex, clip rect and index buffers, each REGION_COUNT regions long and mapped for their whole lifetime
+    gl::Uint vertexBuffer = 0;
+    gl::Uint clipBuffer = 0; // One ImGui clip rect per vertex
+    gl::Uint indexBuffer = 0;
+    unsigned char* vertexData = nullptr;
+    unsigned char* clipData = nullptr;
+    unsigned char* indexData = nullptr;
+    size_t vertexCapacity = 0; // Per region, in vertices
+    size_t indexCapacity = 0;  // Per region, in indices
+    std::array<gl::Sync, REGION_COUNT> fences{};
+    size_t region = 0;
+
+    // Per-frame scratch, kept to avoid reallocating every frame
+    std::vector<ImVec4> clipStaging;
+    std::vector<const void*> indexOffsets;
+    DrawBatcher batcher;
+    DrawCallStats stats;
+
+    // GL state touched by rendering, restored afterwards like the stock backend does
+    struct SavedState {
+        gl::Int program = 0;
+        gl::Int texture = 0;
+        gl::Int activeTexture = 0;
+        gl::Int vertexArray = 0;
+        gl::Int arrayBuffer = 0;
+        gl::Boolean blend = 0;
+        gl::Boolean cullFace = 0;
+        gl::Boolean depthTest = 0;
+        gl::Boolean stencilTest = 0;
+        gl::Boolean scissorTest = 0;
+        gl::Boolean primitiveRestart = 0;
+    };
+
+    bool CompileProgram();
+    bool CreateBuffers(size_t vertices, size_t indices);
+    void DestroyBuffers();
+    bool WaitForRegion(size_t index);
+    void WriteVertexClipRects(const ImDrawData* drawData, size_t regionVertex);
+    void DrawBatches();
+    void SetupRenderState(const ImDrawData* drawData, int framebufferWidth, int framebufferHeight);
+    SavedState SaveState();
+    void RestoreState(const SavedState& state);
+    void Toggle(gl::Enum capability, gl::Boolean enabled);
+};
+
+bool GLStreamRenderer::Impl::CompileProgram() {
+    auto compile = [this](gl::Enum type, const char* source) -> gl::Uint {
+        const gl::Uint shader = gl.CreateShader(type);
+        gl.ShaderSource(shader, 1, &source, nullptr);
+        gl.CompileShader(shader);
+        gl::Int status = 0;
+        gl.GetShaderiv(shader, gl::COMPILE_STATUS, &status);
+        if (status == 0) {
+            gl::Int length = 0;
+            gl.GetShaderiv(shader, gl::INFO_LOG_LENGTH, &length);
+            std::string log(static_cast<size_t>(length > 0 ? length : 1), '\0');
+            gl.GetShaderInfoLog(shader, static_cast<gl::Sizei>(log.size()), nullptr, log.data());
+            LOG_ERROR("GL stream renderer: shader compilation failed: {}", log.c_str());
+            gl.DeleteShader(shader);
+            return 0;
+        }
+        return shader;
+    };
+
+    const gl::Uint vertexShader = compile(gl::VERTEX_SHADER, VERTEX_SHADER_SOURCE);
+    const gl::Uint fragmentShader = compile(gl::FRAGMENT_SHADER, FRAGMENT_SHADER_SOURCE);
+    if (vertexShader == 0 || fragmentShader == 0) {
+        if (vertexShader != 0) {
+            gl.DeleteShader(vertexShader);
+        }
+        if (fragmentShader != 0) {
+            gl.DeleteShader(fragmentShader);
+        }
+        return false;
+    }
+
+    program = gl.CreateProgram();
+    gl.AttachShader(program, vertexShader);
+    gl.AttachShader(program, fragmentShader);
+    gl.LinkProgram(program);
+    // Shaders are kept alive by the program
+    gl.DeleteShader(vertexShader);
+    gl.DeleteShader(fragmentShader);
+
+    gl::Int status = 0;
+    gl.GetProgramiv(program, gl::LINK_STATUS, &status);
+    if (status == 0) {
+        gl::Int length = 0;
+        gl.GetProgramiv(program, gl::INFO_LOG_LENGTH, &length);
+        std::string log(static_cast<size_t>(length > 0 ? length : 1), '\0');
+        gl.GetProgramInfoLog(program, static_cast<gl::Sizei>(log.size()), nullptr, log.data());
+        LOG_ERROR("GL stream renderer: program link failed: {}", log.c_str());
+        gl.DeleteProgram(program);
+        program = 0;
+        return false;
+    }
+
+    textureLocation = gl.GetUniformLocation(program, "Texture");
+    projectionLocation = gl.GetUniformLocation(program, "ProjMtx");
+    return true;
+}
+
+bool GLStreamRenderer::Impl::CreateBuffers(size_t vertices, size_t indices) {
+    constexpr gl::Bitfield FLAGS = gl::MAP_WRITE_BIT | gl::MAP_PERSISTENT_BIT | gl::MAP_COHERENT_BIT;
+    const auto vertexBytes = static_cast<gl::Sizeiptr>(vertices * REGION_COUNT * sizeof(ImDrawVert));
+    const auto clipBytes = static_cast<gl::Sizeiptr>(vertices * REGION_COUNT * sizeof(ImVec4));
+    const auto indexBytes = static_cast<gl::Sizeiptr>(indices * REGION_COUNT * sizeof(ImDrawIdx));
+
+    gl::Int previousVertexArray = 0;
+    gl::Int previousArrayBuffer = 0;
+    gl.GetIntegerv(gl::VERTEX_ARRAY_BINDING, &previousVertexArray);
+    gl.GetIntegerv(gl::ARRAY_BUFFER_BINDING, &previousArrayBuffer);
+
+    // The element buffer binding and the attribute layout are vertex array state
+    gl.GenVertexArrays(1, &vertexArray);
+    gl.BindVertexArray(vertexArray);
+
+    gl.GenBuffers(1, &vertexBuffer);
+    gl.BindBuffer(gl::ARRAY_BUFFER, vertexBuffer);
+    gl.BufferStorage(gl::ARRAY_BUFFER, vertexBytes, nullptr, FLAGS);
+    vertexData = static_cast<unsigned char*>(gl.MapBufferRange(gl::ARRAY_BUFFER, 0, vertexBytes, FLAGS));
+
+    gl.EnableVertexAttribArray(0);
+    gl.EnableVertexAttribArray(1);
+    gl.EnableVertexAttribArray(2);
+    gl.VertexAttribPointer(0, 2, gl::FLOAT, gl::FALSE_, sizeof(ImDrawVert),
+                           reinterpret_cast<const void*>(offsetof(ImDrawVert, pos)));
+    gl.VertexAttribPointer(1, 2, gl::FLOAT, gl::FALSE_, sizeof(ImDrawVert),
+                           reinterpret_cast<const void*>(offsetof(ImDrawVert, uv)));
+    gl.VertexAttribPointer(2, 4, gl::UNSIGNED_BYTE, 1, sizeof(ImDrawVert),
+                           reinterpret_cast<const void*>(offsetof(ImDrawVert, col)));
+
+    gl.GenBuffers(1, &clipBuffer);
+    gl.BindBuffer(gl::ARRAY_BUFFER, clipBuffer);
+    gl.BufferStorage(gl::ARRAY_BUFFER, clipBytes, nullptr, FLAGS);
+    clipData = static_cast<unsigned char*>(gl.MapBufferRange(gl::ARRAY_BUFFER, 0, clipBytes, FLAGS));
+    gl.EnableVertexAttribArray(3);
+    gl.VertexAttribPointer(3, 4, gl::FLOAT, gl::FALSE_, sizeof(ImVec4), nullptr);
+
+    gl.GenBuffers(1, &indexBuffer);
+    gl.BindBuffer(gl::ELEMENT_ARRAY_BUFFER, indexBuffer);
+    gl.BufferStorage(gl::ELEMENT_ARRAY_BUFFER, indexBytes, nullptr, FLAGS);
+    indexData = static_cast<unsigned char*>(gl.MapBufferRange(gl::ELEMENT_ARRAY_BUFFER, 0, indexBytes, FLAGS));
+
+    gl.BindVertexArray(static_cast<gl::Uint>(previousVertexArray));
+    gl.BindBuffer(gl::ARRAY_BUFFER, static_cast<gl::Uint>(previousArrayBuffer));
+
+    if (vertexData == nullptr || clipData == nullptr || indexData == nullptr) {
+        LOG_ERROR("GL stream renderer: could not map {} + {} + {} bytes of buffer storage", vertexBytes, clipBytes,
+                  indexBytes);
+        DestroyBuffers();
+        return false;
+    }
+    vertexCapacity = vertices;
+    indexCapacity = indices;
+    region = 0;
+    return true;
+}
+
+void GLStreamRenderer::Impl::DestroyBuffers() {
+    for (gl::Sync& fence : fences) {
+        if (fence != nullptr) {
+            gl.DeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+    // Deleting a buffer unmaps it
+    if (vertexBuffer != 0) {
+        gl.DeleteBuffers(1, &vertexBuffer);
+        vertexBuffer = 0;
+    }
+    if (clipBuffer != 0) {
+        gl.DeleteBuffers(1, &clipBuffer);
+        clipBuffer = 0;
+    }
+    if (indexBuffer != 0) {
+        gl.DeleteBuffers(1, &indexBuffer);
+        indexBuffer = 0;
+    }
+    if (vertexArray != 0) {
+        gl.DeleteVertexArrays(1, &vertexArray);
+        vertexArray = 0;
+    }
+    vertexData = nullptr;
+    clipData = nullptr;
+    indexData = nullptr;
+    vertexCapacity = 0;
+    indexCapacity = 0;
+}
+
+bool GLStreamRenderer::Impl::WaitForRegion(size_t index) {
+    gl::Sync& fence = fences[index];
+    if (fence == nullptr) {
+        return true;
+    }
+    const gl::Enum result = gl.ClientWaitSync(fence, gl::SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT_NS);
+    if (result != gl::ALREADY_SIGNALED && result != gl::CONDITION_SATISFIED) {
+        LOG_WARNING("GL stream renderer: region {} still in use by the GPU ({})", index,
+                    result == gl::WAIT_FAILED ? "wait failed" : "timed out");
+        return false;
+    }
+    gl.DeleteSync(fence);
+    fence = nullptr;
+    return true;
+}
+
+void GLStreamRenderer::Impl::WriteVertexClipRects(const ImDrawData* drawData, size_t regionVertex) {
+    // Every vertex takes the clip rect of the command that indexes it; ImGui never shares vertices between commands
+    const auto vertexCount = static_cast<size_t>(drawData->TotalVtxCount);
+    if (clipStaging.size() < vertexCount) {
+        clipStaging.resize(vertexCount);
+    }
+    size_t listVertex = 0;
+    for (const ImDrawList* list : drawData->CmdLists) {
+        for (const ImDrawCmd& command : list->CmdBuffer) {
+            if (command.UserCallback != nullptr) {
+                continue;
+            }
+            const ImDrawIdx* indices = list->IdxBuffer.Data + command.IdxOffset;
+            ImVec4* clip = clipStaging.data() + listVertex + command.VtxOffset;
+            for (unsigned int i = 0; i < command.ElemCount; ++i) {
+                clip[indices[i]] = command.ClipRect;
+            }
+        }
+        listVertex += static_cast<size_t>(list->VtxBuffer.Size);
+    }
+    // Scattered writes go to the staging copy; the mapped (write-combined) memory only sees one sequential copy
+    std::memcpy(clipData + regionVertex * sizeof(ImVec4), clipStaging.data(), vertexCount * sizeof(ImVec4));
+}
+
+void GLStreamRenderer::Impl::DrawBatches() {
+    constexpr gl::Enum INDEX_TYPE = sizeof(ImDrawIdx) == 2 ? gl::UNSIGNED_SHORT : gl::UNSIGNED_INT;
+    const std::vector<int32_t>& counts = batcher.GetCounts();
+    const std::vector<int32_t>& baseVertices = batcher.GetBaseVertices();
+    indexOffsets.clear();
+    for (const size_t firstIndex : batcher.GetFirstIndices()) {
+        indexOffsets.push_back(reinterpret_cast<const void*>(firstIndex * sizeof(ImDrawIdx)));
+    }
+
+    for (const DrawBatcher::Batch& batch : batcher.GetBatches()) {
+        const size_t range = batch.firstRange;
+        gl.BindTexture(gl::TEXTURE_2D, static_cast<gl::Uint>(batch.texture));
+        if (batch.rangeCount == 1) {
+            gl.DrawElementsBaseVertex(gl::TRIANGLES, counts[range], INDEX_TYPE, indexOffsets[range],
+                                      baseVertices[range]);
+        } else {
+            gl.MultiDrawElementsBaseVertex(gl::TRIANGLES, counts.data() + range, INDEX_TYPE,
+                                           indexOffsets.data() + range, static_cast<gl::Sizei>(batch.rangeCount),
+                                           baseVertices.data() + range);
+        }
+        ++stats.drawCalls;
+    }
+    stats.commands += batcher.GetCommandCount();
+    batcher.Reset();
+}
+
+GLStreamRenderer::Impl::SavedState GLStreamRenderer::Impl::SaveState() {
+    SavedState state;
+    gl.GetIntegerv(gl::CURRENT_PROGRAM, &state.program);
+    gl.GetIntegerv(gl::ACTIVE_TEXTURE, &state.activeTexture);
+    gl.ActiveTexture(gl::TEXTURE0);
+    gl.GetIntegerv(gl::TEXTURE_BINDING_2D, &state.texture);
+    gl.GetIntegerv(gl::VERTEX_ARRAY_BINDING, &state.vertexArray);
+    gl.GetIntegerv(gl::ARRAY_BUFFER_BINDING, &state.arrayBuffer);
+    state.blend = gl.IsEnabled(gl::BLEND);
+    state.cullFace = gl.IsEnabled(gl::CULL_FACE);
+    state.depthTest = gl.IsEnabled(gl::DEPTH_TEST);
+    state.stencilTest = gl.IsEnabled(gl::STENCIL_TEST);
+    state.scissorTest = gl.IsEnabled(gl::SCISSOR_TEST);
+    state.primitiveRestart = gl.IsEnabled(gl::PRIMITIVE_RESTART);
+    return state;
+}
+
+void GLStreamRenderer::Impl::Toggle(gl::Enum capability, gl::Boolean enabled) {
+    if (enabled != 0) {
+        gl.Enable(capability);
+    } else {
+        gl.Disable(capability);
+    }
+}
+
+void GLStreamRenderer::Impl::RestoreState(const SavedState& state) {
+    gl.UseProgram(static_cast<gl::Uint>(state.program));
+    gl.BindTexture(gl::TEXTURE_2D, static_cast<gl::Uint>(state.texture));
+    gl.ActiveTexture(static_cast<gl::Enum>(state.activeTexture));
+    gl.BindVertexArray(static_cast<gl::Uint>(state.vertexArray));
+    gl.BindBuffer(gl::ARRAY_BUFFER, static_cast<gl::Uint>(state.arrayBuffer));
+    Toggle(gl::BLEND, state.blend);
+    Toggle(gl::CULL_FACE, state.cullFace);
+    Toggle(gl::DEPTH_TEST, state.depthTest);
+    Toggle(gl::STENCIL_TEST, state.stencilTest);
+    Toggle(gl::SCISSOR_TEST, state.scissorTest);
+    Toggle(gl::PRIMITIVE_RESTART, state.primitiveRestart);
+}
+
+void GLStreamRenderer::Impl::SetupRenderState(const ImDrawData* drawData, int framebufferWidth,
+                                              int framebufferHeight) {
+    // Alpha blending, no face culling, no depth or stencil testing; clipping is done per vertex, not by scissor
+    gl.Enable(gl::BLEND);
+    gl.BlendEquation(gl::FUNC_ADD);
+    gl.BlendFuncSeparate(gl::SRC_ALPHA, gl::ONE_MINUS_SRC_ALPHA, gl::ONE, gl::ONE_MINUS_SRC_ALPHA);
+    gl.Disable(gl::CULL_FACE);
+    gl.Disable(gl::DEPTH_TEST);
+    gl.Disable(gl::STENCIL_TEST);
+    gl.Disable(gl::SCISSOR_TEST);
+    gl.Disable(gl::PRIMITIVE_RESTART);
+    gl.Viewport(0, 0, framebufferWidth, framebufferHeight);
+
+    // Orthographic projection of the display rect (DisplayPos is the top left of the main viewport)
+    const float left = drawData->DisplayPos.x;
+    const float right = drawData->DisplayPos.x + drawData->DisplaySize.x;
+    const float top = drawData->DisplayPos.y;
+    const float bottom = drawData->DisplayPos.y + drawData->DisplaySize.y;
+    const std::array<float, 16> projection = {2.0f / (right - left),
+                                              0.0f,
+                                              0.0f,
+                                              0.0f,
+                                              0.0f,
+                                              2.0f / (top - bottom),
+                                              0.0f,
+                                              0.0f,
+                                              0.0f,
+                                              0.0f,
+                                              -1.0f,
+                                              0.0f,
+                                              (right + left) / (left - right),
+                                              (top + bottom) / (bottom - top),
+                                              0.0f,
+                                              1.0f};
+    gl.UseProgram(program);
+    gl.Uniform1i(textureLocation, 0);
+    gl.UniformMatrix4fv(projectionLocation, 1, gl::FALSE_, projection.data());
+    gl.BindVertexArray(vertexArray);
+    gl.ActiveTexture(gl::TEXTURE0);
+}
+
+GLStreamRenderer::GLStreamRenderer() : m_impl(std::make_unique<Impl>()) {}
+
+GLStreamRenderer::~GLStreamRenderer() = default;
+
+bool GLStreamRenderer::Initialize() {
+    GLFWwindow* window = glfwGetCurrentContext();
+    if (window == nullptr) {
+        return false;
+    }
+    const int major = glfwGetWindowAttrib(window, GLFW_CONTEXT_VERSION_MAJOR);
+    const int minor = glfwGetWindowAttrib(window, GLFW_CONTEXT_VERSION_MINOR);
+    const bool hasBufferStorage =
+        major > 4 || (major == 4 && minor >= 4) || glfwExtensionSupported("GL_ARB_buffer_storage") == GLFW_TRUE;
+    if (!hasBufferStorage) {
+        LOG_INFO("GL stream renderer unavailable: OpenGL {}.{} without GL_ARB_buffer_storage", major, minor);
+        return false;
+    }
+
+    if (!LoadFunctions(m_impl->gl) || !m_impl->CompileProgram() ||
+        !m_impl->CreateBuffers(INITIAL_VERTEX_CAPACITY, INITIAL_INDEX_CAPACITY)) {
+        Shutdown();
+        return false;
+    }
+
+    LOG_INFO("GL stream renderer: {} persistently mapped regions of {} vertices / {} indices", REGION_COUNT,
+             m_impl->vertexCapacity, m_impl->indexCapacity);
+    return true;
+}
+
+void GLStreamRenderer::Shutdown() {
+    Impl& impl = *m_impl;
+    if (impl.gl.DeleteBuffers == nullptr) {
+        return; // Entry points were never loaded
+    }
+    impl.DestroyBuffers();
+    if (impl.program != 0) {
+        impl.gl.DeleteProgram(impl.program);
+        impl.program = 0;
+    }
+}
+
+const DrawCallStats& GLStreamRenderer::GetStats() const {
+    return m_impl->stats;
+}
+
+void GLStreamRenderer::RenderDrawData(ImDrawData* drawData) {
+    Impl& impl = *m_impl;
+    const int framebufferWidth = static_cast<int>(drawData->DisplaySize.x * drawData->FramebufferScale.x);
+    const int framebufferHeight = static_cast<int>(drawData->DisplaySize.y * drawData->FramebufferScale.y);
+    if (framebufferWidth <= 0 || framebufferHeight <= 0 || impl.program == 0) {
+        return;
+    }
+
+    // Texture creation and uploads stay with the stock backend
+    if (drawData->Textures != nullptr) {
+        for (ImTextureData* texture : *drawData->Textures) {
+            if (texture->Status != ImTextureStatus_OK) {
+                ImGui_ImplOpenGL3_UpdateTexture(texture);
+            }
+        }
+    }
+
+    const auto vertexCount = static_cast<size_t>(drawData->TotalVtxCount);
+    const auto indexCount = static_cast<size_t>(drawData->TotalIdxCount);
+    if (vertexCount > impl.vertexCapacity || indexCount > impl.indexCapacity) {
+        // Rare: wait for every region to drain, then reallocate larger storage
+        for (size_t i = 0; i < REGION_COUNT; ++i) {
+            impl.WaitForRegion(i);
+        }
+        const size_t vertices = GrowCapacity(impl.vertexCapacity, vertexCount);
+        const size_t indices = GrowCapacity(impl.indexCapacity, indexCount);
+        impl.DestroyBuffers();
+        if (!impl.CreateBuffers(vertices, indices)) {
+            LOG_ERROR("GL stream renderer: falling back to the stock renderer for this frame");
+            // Keep trying at the initial size next frame
+            impl.CreateBuffers(INITIAL_VERTEX_CAPACITY, INITIAL_INDEX_CAPACITY);
+            ImGui_ImplOpenGL3_RenderDrawData(drawData);
+            return;
+        }
+        LOG_INFO("GL stream renderer: regions grown to {} vertices / {} indices", vertices, indices);
+    }
+
+    if (!impl.WaitForRegion(impl.region)) {
+        ImGui_ImplOpenGL3_RenderDrawData(drawData);
+        return;
+    }
+
+    // Copy every list into this frame's region; the mapping is coherent, so no flush is needed
+    const size_t regionVertex = impl.region * impl.vertexCapacity;
+    const size_t regionIndex = impl.region * impl.indexCapacity;
+    size_t vertexOffset = 0;
+    size_t indexOffset = 0;
+    for (const ImDrawList* list : drawData->CmdLists) {
+        std::memcpy(impl.vertexData + (regionVertex + vertexOffset) * sizeof(ImDrawVert), list->VtxBuffer.Data,
+                    static_cast<size_t>(list->VtxBuffer.Size) * sizeof(ImDrawVert));
+        std::memcpy(impl.indexData + (regionIndex + indexOffset) * sizeof(ImDrawIdx), list->IdxBuffer.Data,
+                    static_cast<size_t>(list->IdxBuffer.Size) * sizeof(ImDrawIdx));
+        vertexOffset += static_cast<size_t>(list->VtxBuffer.Size);
+        indexOffset += static_cast<size_t>(list->IdxBuffer.Size);
+    }
+
+    impl.WriteVertexClipRects(drawData, regionVertex);
+
+    const Impl::SavedState saved = impl.SaveState();
+    impl.SetupRenderState(drawData, framebufferWidth, framebufferHeight);
+
+    impl.stats = DrawCallStats{};
+    impl.stats.vertices = vertexCount;
+    impl.stats.indices = indexCount;
+    size_t listVertex = regionVertex;
+    size_t listIndex = regionIndex;
+    for (ImDrawList* list : drawData->CmdLists) {
+        for (const ImDrawCmd& command : list->CmdBuffer) {
+            if (command.UserCallback != nullptr) {
+                // Draw what is pending first so the callback runs in submission order
+                impl.DrawBatches();
+                if (command.UserCallback == ImDrawCallback_ResetRenderState) {
+                    impl.SetupRenderState(drawData, framebufferWidth, framebufferHeight);
+                } else {
+                    command.UserCallback(list, &command);
+                }
+                continue;
+            }
+            if (command.ClipRect.z <= command.ClipRect.x || command.ClipRect.w <= command.ClipRect.y) {
+                continue;
+            }
+            impl.batcher.Add(static_cast<uint64_t>(command.GetTexID()), listIndex + command.IdxOffset,
+                             command.ElemCount, static_cast<int32_t>(listVertex + command.VtxOffset));
+        }
+        listVertex += static_cast<size_t>(list->VtxBuffer.Size);
+        listIndex += static_cast<size_t>(list->IdxBuffer.Size);
+    }
+    impl.DrawBatches();
+
+    // The region may be rewritten once the GPU has consumed these draws
+    impl.fences[impl.region] = impl.gl.FenceSync(gl::SYNC_GPU_COMMANDS_COMPLETE, 0);
+    impl.region = (impl.region + 1) % REGION_COUNT;
+
+    impl.RestoreState(saved);
+}
+
+} // namespace MetaImGUI
@@ -0,0 +1,448 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "HttpCache.h"
+
+#include "Logger.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <condition_variable>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+namespace MetaImGUI {
+
+using json = nlohmann::json;
+
+namespace {
+// Stable across builds and platforms, unlike std::hash
+uint64_t Fnv1a(std::string_view text) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (const char c : text) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::string_view Trim(std::string_view text) {
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front())) != 0) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back())) != 0) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+std::optional<int64_t> ParseSeconds(std::string_view text) {
+    text = Trim(text);
+    int64_t value = 0;
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc{} || end != text.data() + text.size() || value < 0) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+// Write then rename so a crash never leaves a truncated file behind
+bool WriteFileAtomically(const std::filesystem::path& path, std::string_view contents) {
+    std::filesystem::path temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            LOG_WARNING("HTTP Cache: Failed to write {}", temporary.string());
+            return false;
+        }
+        file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if (error) {
+        LOG_WARNING("HTTP Cache: Failed to replace {}: {}", path.string(), error.message());
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+    return true;
+}
+
+std::filesystem::path BodyPath(std::filesystem::path entryPath) {
+    return entryPath.replace_extension(".body");
+}
+} // namespace
+
+struct HttpCache::DiskWriter {
+    struct Pending {
+        Entry entry;
+        bool writeBody = false;
+    };
+
+    std::filesystem::path directory;
+    std::mutex mutex;
+    std::condition_variable idle;
+    std::unordered_map<std::string, Pending> pending; // Latest state per URL
+    bool writing = false;                             // A batch is being written
+    bool scheduled = false;                           // A worker task is queued
+
+    // Write queued entries until none are left. Without wait, returns at once if another
+    // thread is writing: that thread picks up whatever is queued meanwhile.
+    void Write(bool wait) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (writing && !wait) {
+            return;
+        }
+        idle.wait(lock, [this]() { return !writing; });
+
+        while (!pending.empty()) {
+            std::unordered_map<std::string, Pending> batch;
+            batch.swap(pending);
+            writing = true;
+            lock.unlock();
+            for (const auto& [url, write] : batch) {
+                SaveToDisk(directory, write.entry, write.writeBody);
+            }
+            lock.lock();
+            writing = false;
+        }
+        idle.notify_all();
+    }
+};
+
+// Entry
+
+void HttpCache::Entry::AddConditionalHeaders(std::vector<std::string>& headers) const {
+    if (!etag.empty()) {
+        headers.push_back("If-None-Match: " + etag);
+    }
+    if (!lastModified.empty()) {
+        headers.push_back("If-Modified-Since: " + lastModified);
+    }
+}
+
+HttpResponse HttpCache::Entry::ToResponse() const {
+    HttpResponse response;
+    response.statusCode = 200;
+    response.body = body;
+    response.fromCache = true;
+    if (!etag.empty()) {
+        response.headers["etag"] = etag;
+    }
+    if (!lastModified.empty()) {
+        response.headers["last-modified"] = lastModified;
+    }
+    return response;
+}
+
+// HttpCache
+
+HttpCache::HttpCache(std::filesystem::path directory, TaskScheduler& scheduler)
+    : m_directory(std::move(directory)), m_scheduler(scheduler) {
+    if (m_directory.empty()) {
+        return;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(m_directory, error);
+    if (error) {
+        LOG_WARNING("HTTP Cache: Cannot create {}: {}; caching in memory only", m_directory.string(), error.message());
+        m_directory.clear();
+        return;
+    }
+    m_writer = std::make_shared<DiskWriter>();
+    m_writer->directory = m_directory;
+}
+
+HttpCache::~HttpCache() {
+    // Also covers writes whose task never ran because the scheduler shut down first
+    Flush();
+}
+
+std::optional<HttpCache::Entry> HttpCache::Lookup(const std::string& url) {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_entries.find(url);
+    if (it == m_entries.end()) {
+        std::optional<Entry> loaded = LoadFromDisk(url);
+        if (!loaded) {
+            return std::nullopt;
+        }
+        InsertLocked(std::move(*loaded));
+        it = m_entries.find(url);
+    }
+
+    it->second.lastUsed = ++m_useCounter;
+    if (it->second.entry.IsFresh(Clock::now())) {
+        m_freshHits.fetch_add(1, std::memory_order_relaxed);
+    }
+    return it->second.entry;
+}
+
+bool HttpCache::Store(const std::string& url, const HttpResponse& response) {
+    if (!response.Succeeded() || response.statusCode != 200 || response.body.size() > MAX_ENTRY_BYTES) {
+        return false;
+    }
+
+    const auto now = Clock::now();
+    const std::optional<Clock::time_point> freshUntil = ComputeFreshUntil(response, now);
+    if (!freshUntil) {
+        return false;
+    }
+
+    Entry entry{.url = url,
+                .body = response.body,
+                .etag = response.GetHeader("etag"),
+                .lastModified = response.GetHeader("last-modified"),
+                .freshUntil = *freshUntil};
+
+    // Without a validator or a lifetime the entry could never be reused
+    if (entry.etag.empty() && entry.lastModified.empty() && !entry.IsFresh(now)) {
+        return false;
+    }
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    QueueWrite(entry, true);
+    InsertLocked(std::move(entry));
+    m_stored.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+std::optional<HttpCache::Entry> HttpCache::Revalidate(const std::string& url, const HttpResponse& notModified) {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto it = m_entries.find(url);
+    if (it == m_entries.end()) {
+        return std::nullopt;
+    }
+
+    // A 304 may carry updated validators and caching directives
+    Entry& entry = it->second.entry;
+    if (const std::string etag = notModified.GetHeader("etag"); !etag.empty()) {
+        entry.etag = etag;
+    }
+    if (const std::string lastModified = notModified.GetHeader("last-modified"); !lastModified.empty()) {
+        entry.lastModified = lastModified;
+    }
+    entry.freshUntil = ComputeFreshUntil(notModified, Clock::now()).value_or(Clock::time_point{});
+
+    it->second.lastUsed = ++m_useCounter;
+    QueueWrite(entry, false); // The body on disk is unchanged
+    m_revalidated.fetch_add(1, std::memory_order_relaxed);
+    return entry;
+}
+
+void HttpCache::Clear() {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+
+    if (!m_writer) {
+        return;
+    }
+    {
+        // Drop queued writes and let a batch in progress finish before deleting its files
+        std::unique_lock<std::mutex> writerLock(m_writer->mutex);
+        m_writer->pending.clear();
+        m_writer->idle.wait(writerLock, [this]() { return !m_writer->writing; });
+    }
+
+    std::error_code error;
+    for (const auto& file : std::filesystem::directory_iterator(m_directory, error)) {
+        const std::filesystem::path extension = file.path().extension();
+        if (extension == ".json" || extension == ".body" || extension == ".tmp") {
+            std::filesystem::remove(file.path(), error);
+        }
+    }
+}
+
+void HttpCache::Flush() {
+    if (m_writer) {
+        m_writer->Write(true);
+    }
+}
+
+size_t HttpCache::GetMemoryEntryCount() const {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+HttpCache::Stats HttpCache::GetStats() const {
+    return Stats{.freshHits = m_freshHits.load(std::memory_order_relaxed),
+                 .revalidated = m_revalidated.load(std::memory_order_relaxed),
+                 .stored = m_stored.load(std::memory_order_relaxed)};
+}
+
+std::optional<HttpCache::Clock::time_point> HttpCache::ComputeFreshUntil(const HttpResponse& response,
+                                                                         Clock::time_point now) {
+    std::string cacheControl = response.GetHeader("cache-control");
+    std::transform(cacheControl.begin(), cacheControl.end(), cacheControl.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    std::optional<int64_t> maxAge;
+    bool noCache = false;
+
+    std::string_view remaining = cacheControl;
+    while (!remaining.empty()) {
+        const size_t comma = remaining.find(',');
+        const std::string_view directive = Trim(remaining.substr(0, comma));
+        remaining = (comma == std::string_view::npos) ? std::string_view{} : remaining.substr(comma + 1);
+
+        if (directive == "no-store") {
+            return std::nullopt;
+        }
+        if (directive == "no-cache") {
+            noCache = true;
+        } else if (directive.starts_with("max-age=")) {
+            maxAge = ParseSeconds(directive.substr(8));
+        }
+    }
+
+    if (noCache || !maxAge) {
+        return Clock::time_point{};
+    }
+
+    // Time already spent in upstream caches counts against the lifetime
+    const int64_t age = ParseSeconds(response.GetHeader("age")).value_or(0);
+    if (age >= *maxAge) {
+        return Clock::time_point{};
+    }
+    return now + std::chrono::seconds(*maxAge - age);
+}
+
+void HttpCache::InsertLocked(Entry entry) {
+    if (m_entries.size() >= MAX_MEMORY_ENTRIES && !m_entries.contains(entry.url)) {
+        // Evict the least recently used entry; it remains on disk
+        const auto oldest = std::min_element(m_entries.begin(), m_entries.end(), [](const auto& a, const auto& b) {
+            return a.second.lastUsed < b.second.lastUsed;
+        });
+        m_entries.erase(oldest);
+    }
+
+    std::string url = entry.url;
+    m_entries.insert_or_assign(std::move(url), Slot{.entry = std::move(entry), .lastUsed = ++m_useCounter});
+}
+
+void HttpCache::QueueWrite(const Entry& entry, bool writeBody) {
+    if (!m_writer) {
+        return;
+    }
+
+    bool schedule = false;
+    {
+        const std::lock_guard<std::mutex> lock(m_writer->mutex);
+        DiskWriter::Pending& pending = m_writer->pending[entry.url];
+        pending.entry = entry;
+        pending.writeBody = pending.writeBody || writeBody; // A queued full write stays one
+        schedule = !std::exchange(m_writer->scheduled, true);
+    }
+    if (schedule) {
+        // The task shares the writer, so it may outlive the cache
+        m_scheduler.Submit(
+            [writer = m_writer](std::stop_token /*stopToken*/) {
+                {
+                    const std::lock_guard<std::mutex> lock(writer->mutex);
+                    writer->scheduled = false;
+                }
+                writer->Write(false);
+            },
+            TaskPriority::Low);
+    }
+}
+
+std::filesystem::path HttpCache::EntryPath(const std::filesystem::path& directory, const std::string& url) {
+    std::array<char, 16> hex{};
+    hex.fill('0');
+    const uint64_t hash = Fnv1a(url);
+    // Right-align so every name has the same width
+    const size_t digits = (static_cast<size_t>(std::bit_width(hash)) + 3) / 4;
+    std::to_chars(hex.data() + hex.size() - digits, hex.data() + hex.size(), hash, 16);
+    return directory / (std::string(hex.data(), hex.size()) + ".json");
+}
+
+std::optional<HttpCache::Entry> HttpCache::LoadFromDisk(const std::string& url) const {
+    if (!m_writer) {
+        return std::nullopt;
+    }
+
+    // An entry evicted from memory before its write ran is newer than the files
+    {
+        const std::lock_guard<std::mutex> lock(m_writer->mutex);
+        if (const auto it = m_writer->pending.find(url); it != m_writer->pending.end()) {
+            return it->second.entry;
+        }
+    }
+
+    const std::filesystem::path path = EntryPath(m_directory, url);
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+
+    try {
+        const json data = json::parse(file);
+        // The file name is a hash, so confirm it holds this URL
+        if (data.at("url").get<std::string>() != url) {
+            return std::nullopt;
+        }
+
+        std::ifstream bodyFile(BodyPath(path), std::ios::binary);
+        std::string body{std::istreambuf_iterator<char>(bodyFile), std::istreambuf_iterator<char>()};
+        // A crash between writing the body and its metadata leaves them mismatched
+        if (body.size() != data.at("bodySize").get<size_t>() || Fnv1a(body) != data.at("bodyHash").get<uint64_t>()) {
+            LOG_WARNING("HTTP Cache: Ignoring entry for {}: body does not match its metadata", url);
+            return std::nullopt;
+        }
+
+        return Entry{.url = url,
+                     .body = std::move(body),
+                     .etag = data.value("etag", ""),
+                     .lastModified = data.value("lastModified", ""),
+                     .freshUntil = Clock::time_point(std::chrono::seconds(data.value("freshUntil", int64_t{0})))};
+    } catch (const json::exception& e) {
+        LOG_WARNING("HTTP Cache: Ignoring unreadable entry for {}: {}", url, e.what());
+        return std::nullopt;
+    }
+}
+
+void HttpCache::SaveToDisk(const std::filesystem::path& directory, const Entry& entry, bool writeBody) {
+    // Body first: if the metadata write is then lost, the old metadata no longer matches the
+    // new body and the entry is rejected on load
+    const std::filesystem::path path = EntryPath(directory, entry.url);
+    if (writeBody && !WriteFileAtomically(BodyPath(path), entry.body)) {
+        return;
+    }
+
+    const json data = {
+        {"url", entry.url},
+        {"etag", entry.etag},
+        {"lastModified", entry.lastModified},
+        {"freshUntil", std::chrono::duration_cast<std::chrono::seconds>(entry.freshUntil.time_since_epoch()).count()},
+        {"bodySize", entry.body.size()},
+        {"bodyHash", Fnv1a(entry.body)}};
+    WriteFileAtomically(path, data.dump());
+}
+
+} // namespace MetaImGUI
@@ -0,0 +1,600 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "HttpClient.h"
+
+#include "HttpCache.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+// HTTP requests using libcurl (cross-platform)
+#include <curl/curl.h>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace MetaImGUI {
+
+namespace {
+constexpr int POLL_TIMEOUT_MS = 1000;
+
+// Parallel connections per host; further transfers queue or multiplex over HTTP/2
+constexpr long MAX_HOST_CONNECTIONS = 8;
+
+#ifdef __linux__
+constexpr int MAX_EPOLL_EVENTS = 64;
+#endif
+
+// libcurl's global state is set up on first use, keeping TLS library start-up off the startup path
+std::once_flag g_curlInitOnce;
+std::atomic<bool> g_curlInitialized{false};
+
+void EnsureCurlGlobalInit() {
+    std::call_once(g_curlInitOnce, [] {
+        // Must precede the first handle: implicit initialization by curl_easy_init is not thread-safe
+        if (curl_global_init(CURL_GLOBAL_DEFAULT) == CURLE_OK) {
+            g_curlInitialized = true;
+        } else {
+            LOG_ERROR("HTTP Client: curl_global_init failed");
+        }
+    });
+}
+
+size_t WriteCallback(void* contents, size_t size, size_t nmemb, void* userp) {
+    static_cast<std::string*>(userp)->append(static_cast<char*>(contents), size * nmemb);
+    return size * nmemb;
+}
+
+// Called once per header line, including the status line of every response in a redirect chain
+size_t HeaderCallback(char* buffer, size_t size, size_t nitems, void* userp) {
+    auto& headers = *static_cast<std::map<std::string, std::string>*>(userp);
+    const std::string_view line(buffer, size * nitems);
+
+    if (line.starts_with("HTTP/")) {
+        headers.clear(); // Keep only the final response's headers
+        return line.size();
+    }
+
+    const size_t colon = line.find(':');
+    if (colon == std::string_view::npos) {
+        return line.size();
+    }
+
+    std::string name(line.substr(0, colon));
+    std::transform(name.begin(), name.end(), name.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    std::string_view value = line.substr(colon + 1);
+    while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) {
+        value.remove_prefix(1);
+    }
+    while (!value.empty() && (value.back() == '\r' || value.back() == '\n' || value.back() == ' ')) {
+        value.remove_suffix(1);
+    }
+    headers.insert_or_assign(std::move(name), std::string(value));
+    return line.size();
+}
+} // namespace
+
+struct HttpClient::Transfer {
+    std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> easy{nullptr, curl_easy_cleanup};
+    std::unique_ptr<curl_slist, decltype(&curl_slist_free_all)> headers{nullptr, curl_slist_free_all};
+    std::stop_token stopToken;
+    std::unique_ptr<std::stop_callback<std::function<void()>>> wakeOnStop;
+    std::function<bool(long, std::string_view)> onBody;
+
+    // Hands each chunk to onBody; nothing is buffered. Exceptions must not unwind through libcurl.
+    static size_t SinkWriteCallback(void* contents, size_t size, size_t nmemb, void* userp) {
+        auto& transfer = *static_cast<Transfer*>(userp);
+        long statusCode = 0;
+        curl_easy_getinfo(transfer.easy.get(), CURLINFO_RESPONSE_CODE, &statusCode);
+        const std::string_view chunk(static_cast<char*>(contents), size * nmemb);
+        try {
+            return transfer.onBody(statusCode, chunk) ? chunk.size() : 0;
+        } catch (const std::exception& e) {
+            LOG_ERROR("HTTP Client: Body handler threw exception: {}", e.what());
+            return 0;
+        }
+    }
+
+    // Owned by the suspended awaiter, which stays alive until continuation is resumed
+    HttpResponse* response = nullptr;
+    std::coroutine_handle<> continuation;
+};
+
+struct HttpClient::Impl {
+    Impl() = default;
+    ~Impl();
+
+    Impl(const Impl&) = delete;
+    Impl& operator=(const Impl&) = delete;
+    Impl(Impl&&) = delete;
+    Impl& operator=(Impl&&) = delete;
+
+    bool StartLocked();
+    bool Submit(std::unique_ptr<Transfer>& transfer);
+    void Wakeup();
+    void Run();
+    void WaitAndPerform();
+    void Complete(std::unique_ptr<Transfer> transfer, const char* error);
+    void Shutdown();
+
+#ifdef __linux__
+    static int SocketCallback(CURL* easy, curl_socket_t socket, int what, void* userp, void* socketp);
+    static int TimerCallback(CURLM* multi, long timeoutMs, void* userp);
+#endif
+
+    std::mutex mutex; // Protects multi (lifetime), pending, started, stopping and the wakeup handles
+    CURLM* multi = nullptr;
+    std::vector<std::unique_ptr<Transfer>> pending;
+    bool started = false; // The I/O thread is launched by the first request
+    bool stopping = false;
+
+    // DNS and TLS session caches; only touched by the I/O thread, so no lock callbacks are needed
+    CURLSH* share = nullptr;
+    bool http2 = false;
+
+    mutable std::mutex cacheMutex;
+    std::shared_ptr<HttpCache> cache;
+
+#ifdef __linux__
+    int epollFd = -1;
+    int wakeFd = -1;
+    std::optional<std::chrono::steady_clock::time_point> timerDue; // Set by TimerCallback
+#endif
+
+    std::atomic<size_t> activeCount{0};
+    std::jthread thread;
+};
+
+bool HttpClient::Impl::StartLocked() {
+    if (started) {
+        return multi != nullptr;
+    }
+    started = true;
+
+    multi = curl_multi_init();
+    if (multi == nullptr) {
+        LOG_ERROR("HTTP Client: Failed to initialize CURL multi handle");
+        return false;
+    }
+
+    const curl_version_info_data* version = curl_version_info(CURLVERSION_NOW);
+    http2 = (version->features & CURL_VERSION_HTTP2) != 0;
+    curl_multi_setopt(multi, CURLMOPT_PIPELINING, http2 ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING);
+    curl_multi_setopt(multi, CURLMOPT_MAX_HOST_CONNECTIONS, MAX_HOST_CONNECTIONS);
+
+    // The multi handle already pools connections across its transfers; the share adds DNS and TLS sessions
+    share = curl_share_init();
+    if (share != nullptr) {
+        curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    }
+
+#ifdef __linux__
+    // Readiness comes from epoll instead of curl's per-call poll set, so idle sockets cost nothing per wakeup
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    epoll_event wakeEvent{};
+    wakeEvent.events = EPOLLIN;
+    wakeEvent.data.fd = wakeFd;
+    if (epollFd < 0 || wakeFd < 0 || epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &wakeEvent) != 0) {
+        LOG_ERROR("HTTP Client: Failed to set up epoll");
+        curl_multi_cleanup(multi);
+        multi = nullptr;
+        return false;
+    }
+    curl_multi_setopt(multi, CURLMOPT_SOCKETFUNCTION, SocketCallback);
+    curl_multi_setopt(multi, CURLMOPT_SOCKETDATA, this);
+    curl_multi_setopt(multi, CURLMOPT_TIMERFUNCTION, TimerCallback);
+    curl_multi_setopt(multi, CURLMOPT_TIMERDATA, this);
+#endif
+
+    LOG_INFO("HTTP Client: Started I/O thread (libcurl {}, HTTP/2 {})", version->version,
+             http2 ? "available" : "unavailable");
+    thread = std::jthread([this] { Run(); });
+    return true;
+}
+
+HttpClient::Impl::~Impl() {
+    Shutdown();
+#ifdef __linux__
+    // Closed only after the multi handle, whose cleanup still reports sockets to SocketCallback
+    if (wakeFd >= 0) {
+        close(wakeFd);
+    }
+    if (epollFd >= 0) {
+        close(epollFd);
+    }
+#endif
+}
+
+bool HttpClient::Impl::Submit(std::unique_ptr<Transfer>& transfer) {
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (stopping || !StartLocked()) {
+            return false;
+        }
+        activeCount.fetch_add(1, std::memory_order_relaxed);
+        pending.push_back(std::move(transfer));
+    }
+    Wakeup();
+    return true;
+}
+
+void HttpClient::Impl::Wakeup() {
+    const std::lock_guard<std::mutex> lock(mutex);
+#ifdef __linux__
+    if (wakeFd >= 0) {
+        const uint64_t one = 1;
+        [[maybe_unused]] const ssize_t written = write(wakeFd, &one, sizeof(one));
+    }
+#else
+    if (multi != nullptr) {
+        curl_multi_wakeup(multi);
+    }
+#endif
+}
+
+void HttpClient::Impl::Complete(std::unique_ptr<Transfer> transfer, const char* error) {
+    HttpResponse& response = *transfer->response;
+    if (error != nullptr) {
+        response.error = error;
+    }
+    curl_easy_getinfo(transfer->easy.get(), CURLINFO_RESPONSE_CODE, &response.statusCode);
+
+    // Release the handle before resuming; the continuation may destroy the awaiter
+    const std::coroutine_handle<> continuation = transfer->continuation;
+    transfer.reset();
+    activeCount.fetch_sub(1, std::memory_order_relaxed);
+    continuation.resume();
+}
+
+#ifdef __linux__
+int HttpClient::Impl::SocketCallback(CURL* /*easy*/, curl_socket_t socket, int what, void* userp, void* socketp) {
+    auto* impl = static_cast<Impl*>(userp);
+
+    if (what == CURL_POLL_REMOVE) {
+        // The socket may already be closed, in which case epoll has dropped it itself
+        epoll_ctl(impl->epollFd, EPOLL_CTL_DEL, socket, nullptr);
+        return 0;
+    }
+
+    epoll_event event{};
+    event.events = (((what & CURL_POLL_IN) != 0) ? EPOLLIN : 0u) | (((what & CURL_POLL_OUT) != 0) ? EPOLLOUT : 0u);
+    event.data.fd = socket;
+
+    // socketp is null until curl_multi_assign marks the socket as registered
+    if (socketp == nullptr) {
+        epoll_ctl(impl->epollFd, EPOLL_CTL_ADD, socket, &event);
+        curl_multi_assign(impl->multi, socket, impl);
+    } else {
+        epoll_ctl(impl->epollFd, EPOLL_CTL_MOD, socket, &event);
+    }
+    return 0;
+}
+
+int HttpClient::Impl::TimerCallback(CURLM* /*multi*/, long timeoutMs, void* userp) {
+    auto* impl = static_cast<Impl*>(userp);
+    if (timeoutMs < 0) {
+        impl->timerDue.reset();
+    } else {
+        impl->timerDue = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    }
+    return 0;
+}
+
+void HttpClient::Impl::WaitAndPerform() {
+    using Clock = std::chrono::steady_clock;
+
+    int timeoutMs = POLL_TIMEOUT_MS;
+    if (timerDue) {
+        const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(*timerDue - Clock::now()).count();
+        timeoutMs = static_cast<int>(std::clamp<decltype(remaining)>(remaining, 0, POLL_TIMEOUT_MS));
+    }
+
+    std::array<epoll_event, MAX_EPOLL_EVENTS> events{};
+    const int count = epoll_wait(epollFd, events.data(), MAX_EPOLL_EVENTS, timeoutMs);
+
+    int running = 0;
+    for (int i = 0; i < count; ++i) {
+        const epoll_event& event = events[static_cast<size_t>(i)];
+        if (event.data.fd == wakeFd) {
+            uint64_t value = 0;
+            [[maybe_unused]] const ssize_t drained = read(wakeFd, &value, sizeof(value));
+            continue;
+        }
+
+        int flags = 0;
+        if ((event.events & EPOLLIN) != 0) {
+            flags |= CURL_CSELECT_IN;
+        }
+        if ((event.events & EPOLLOUT) != 0) {
+            flags |= CURL_CSELECT_OUT;
+        }
+        if ((event.events & (EPOLLERR | EPOLLHUP)) != 0) {
+            flags |= CURL_CSELECT_ERR;
+        }
+        curl_multi_socket_action(multi, event.data.fd, flags, &running);
+    }
+
+    if (timerDue && Clock::now() >= *timerDue) {
+        timerDue.reset();
+        curl_multi_socket_action(multi, CURL_SOCKET_TIMEOUT, 0, &running);
+    }
+}
+#else
+void HttpClient::Impl::WaitAndPerform() {
+    // Sleeps until socket activity, a curl timeout, or a wakeup from Submit or a stop request
+    curl_multi_poll(multi, nullptr, 0, POLL_TIMEOUT_MS, nullptr);
+
+    int running = 0;
+    curl_multi_perform(multi, &running);
+}
+#endif
+
+void HttpClient::Impl::Run() {
+    std::unordered_map<CURL*, std::unique_ptr<Transfer>> active;
+
+    for (;;) {
+        std::vector<std::unique_ptr<Transfer>> added;
+        bool stop = false;
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            added.swap(pending);
+            stop = stopping;
+        }
+
+        for (auto& transfer : added) {
+            CURL* easy = transfer->easy.get();
+            if (stop) {
+                Complete(std::move(transfer), "HTTP client shut down");
+                continue;
+            }
+
+            // Attached here rather than by the requester so the share is only used on this thread
+            if (share != nullptr) {
+                curl_easy_setopt(easy, CURLOPT_SHARE, share);
+            }
+            if (http2) {
+                // Negotiated over TLS via ALPN; waiting for an existing connection lets requests share it
+                curl_easy_setopt(easy, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+                curl_easy_setopt(easy, CURLOPT_PIPEWAIT, 1L);
+            }
+            if (const CURLMcode code = curl_multi_add_handle(multi, easy); code != CURLM_OK) {
+                Complete(std::move(transfer), curl_multi_strerror(code));
+            } else {
+                active.emplace(easy, std::move(transfer));
+            }
+        }
+        if (stop) {
+            break;
+        }
+
+        // Abort transfers whose requester has given up
+        for (auto it = active.begin(); it != active.end();) {
+            if (it->second->stopToken.stop_requested()) {
+                curl_multi_remove_handle(multi, it->first);
+                std::unique_ptr<Transfer> transfer = std::move(it->second);
+                it = active.erase(it);
+                Complete(std::move(transfer), "Cancelled");
+            } else {
+                ++it;
+            }
+        }
+
+        WaitAndPerform();
+
+        int queued = 0;
+        while (CURLMsg* message = curl_multi_info_read(multi, &queued)) {
+            if (message->msg != CURLMSG_DONE) {
+                continue;
+            }
+            // The message is invalidated by remove_handle, so read it first
+            CURL* easy = message->easy_handle;
+            const CURLcode result = message->data.result;
+            curl_multi_remove_handle(multi, easy);
+
+            auto node = active.extract(easy);
+            if (!node.empty()) {
+                Complete(std::move(node.mapped()), (result == CURLE_OK) ? nullptr : curl_easy_strerror(result));
+            }
+        }
+    }
+
+    for (auto& [easy, transfer] : active) {
+        curl_multi_remove_handle(multi, easy);
+        Complete(std::move(transfer), "HTTP client shut down");
+    }
+}
+
+void HttpClient::Impl::Shutdown() {
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    Wakeup();
+
+    if (thread.joinable()) {
+        thread.join();
+    }
+
+    const std::lock_guard<std::mutex> lock(mutex);
+    if (multi != nullptr) {
+        curl_multi_cleanup(multi);
+        multi = nullptr;
+    }
+    // Every easy handle using the share has been cleaned up by now
+    if (share != nullptr) {
+        curl_share_cleanup(share);
+        share = nullptr;
+    }
+}
+
+bool HttpClient::GetAwaiter::await_suspend(std::coroutine_handle<> handle) {
+    if (m_stopToken.stop_requested()) {
+        m_response.error = "Cancelled";
+        return false;
+    }
+
+    EnsureCurlGlobalInit();
+    auto transfer = std::make_unique<Transfer>();
+    transfer->easy.reset(curl_easy_init());
+    if (!transfer->easy) {
+        m_response.error = "Failed to initialize CURL";
+        return false;
+    }
+
+    CURL* curl = transfer->easy.get();
+    curl_easy_setopt(curl, CURLOPT_URL, m_request.url.c_str());
+    if (m_request.onBody) {
+        transfer->onBody = std::move(m_request.onBody);
+        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, Transfer::SinkWriteCallback);
+        curl_easy_setopt(curl, CURLOPT_WRITEDATA, transfer.get());
+    } else {
+        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
+        curl_easy_setopt(curl, CURLOPT_WRITEDATA, &m_response.body);
+    }
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, HeaderCallback);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &m_response.headers);
+    curl_easy_setopt(curl, CURLOPT_USERAGENT, m_request.userAgent.c_str());
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, m_request.timeoutSeconds);
+    if (m_request.stallTimeoutSeconds > 0) {
+        curl_easy_setopt(curl, CURLOPT_LOW_SPEED_LIMIT, 1L);
+        curl_easy_setopt(curl, CURLOPT_LOW_SPEED_TIME, m_request.stallTimeoutSeconds);
+    }
+    if (m_request.rangeStart > 0) {
+        // CURLOPT_RANGE rather than RESUME_FROM, which fails outright when a server ignores the range
+        const std::string range = std::to_string(m_request.rangeStart) + "-";
+        curl_easy_setopt(curl, CURLOPT_RANGE, range.c_str());
+    }
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 2L);
+    curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L); // Timeouts must not raise signals on the I/O thread
+
+    curl_slist* headers = nullptr;
+    for (const auto& header : m_request.headers) {
+        if (curl_slist* appended = curl_slist_append(headers, header.c_str())) {
+            headers = appended;
+        }
+    }
+    transfer->headers.reset(headers);
+    if (transfer->headers) {
+        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, transfer->headers.get());
+    }
+
+    transfer->stopToken = m_stopToken;
+    transfer->response = &m_response;
+    transfer->continuation = handle;
+    if (m_stopToken.stop_possible()) {
+        // Wake the I/O thread so a cancelled transfer is aborted promptly
+        transfer->wakeOnStop = std::make_unique<std::stop_callback<std::function<void()>>>(
+            m_stopToken, [impl = &m_impl] { impl->Wakeup(); });
+    }
+
+    // Once submitted the coroutine may be resumed at any time; do not touch members after this
+    Impl& impl = m_impl;
+    if (!impl.Submit(transfer)) {
+        transfer.reset();
+        m_response.error = "HTTP client shut down";
+        return false;
+    }
+    return true;
+}
+
+HttpClient::HttpClient() : m_impl(std::make_unique<Impl>()) {}
+
+HttpClient::~HttpClient() {
+    Shutdown();
+}
+
+HttpClient& HttpClient::Instance() {
+    static HttpClient instance;
+    return instance;
+}
+
+AsyncTask<HttpResponse> HttpClient::Get(HttpRequest request, std::stop_token stopToken) {
+    const std::shared_ptr<HttpCache> cache = GetCache();
+    if (!cache || request.onBody || request.rangeStart > 0) {
+        co_return co_await GetAwaiter(*m_impl, std::move(request), std::move(stopToken));
+    }
+
+    const std::optional<HttpCache::Entry> cached = cache->Lookup(request.url);
+    if (cached) {
+        if (cached->IsFresh(HttpCache::Clock::now())) {
+            co_return cached->ToResponse();
+        }
+        cached->AddConditionalHeaders(request.headers);
+    }
+
+    const std::string url = request.url;
+    HttpResponse response = co_await GetAwaiter(*m_impl, std::move(request), std::move(stopToken));
+    if (!response.Succeeded()) {
+        co_return response;
+    }
+
+    if (response.statusCode == 304 && cached) {
+        // Unchanged: the stored body stands in for the one the server did not send
+        const std::optional<HttpCache::Entry> refreshed = cache->Revalidate(url, response);
+        co_return (refreshed ? *refreshed : *cached).ToResponse();
+    }
+    // Runs on the I/O thread: the cache updates memory here and writes to disk on a worker
+    cache->Store(url, response);
+    co_return response;
+}
+
+void HttpClient::SetCache(std::shared_ptr<HttpCache> cache) {
+    const std::lock_guard<std::mutex> lock(m_impl->cacheMutex);
+    m_impl->cache = std::move(cache);
+}
+
+std::shared_ptr<HttpCache> HttpClient::GetCache() const {
+    const std::lock_guard<std::mutex> lock(m_impl->cacheMutex);
+    return m_impl->cache;
+}
+
+void HttpClient::Shutdown() {
+    m_impl->Shutdown();
+}
+
+void HttpClient::GlobalCleanup() {
+    if (g_curlInitialized.exchange(false)) {
+        curl_global_cleanup();
+    }
+}
+
+size_t HttpClient::GetActiveTransferCount() const {
+    return m_impl->activeCount.load(std::memory_order_relaxed);
+}
+
+} // namespace MetaImGUI
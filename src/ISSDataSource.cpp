@@ -0,0 +1,142 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ISSDataSource.h"
+
+#include "Logger.h"
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <numbers>
+
+namespace MetaImGUI {
+
+// ISSDataSource
+
+AsyncTask<std::string> ISSDataSource::FetchAsync(std::stop_token /*stopToken*/) {
+    // Synchronous sources finish without suspending, so the lock is never held across threads
+    const std::lock_guard<std::mutex> lock(m_fetchMutex);
+    co_return Fetch();
+}
+
+// HttpDataSource
+
+HttpDataSource::HttpDataSource(std::string url, HttpClient& client) : m_url(std::move(url)), m_client(client) {}
+
+std::string HttpDataSource::Fetch() {
+    return FetchAsync({}).SyncWait();
+}
+
+AsyncTask<std::string> HttpDataSource::FetchAsync(std::stop_token stopToken) {
+    HttpRequest request;
+    request.url = m_url;
+    request.userAgent = "MetaImGUI-ISSTracker/1.0";
+    request.timeoutSeconds = 30; // Generous for slow networks
+
+    HttpResponse response = co_await m_client.Get(std::move(request), stopToken);
+    if (!response.Succeeded()) {
+        if (!stopToken.stop_requested()) {
+            LOG_ERROR("ISS Tracker: Request failed: {}", response.error);
+        }
+        co_return std::string{};
+    }
+    co_return std::move(response.body);
+}
+
+std::string HttpDataSource::GetName() const {
+    return m_url;
+}
+
+// FileDataSource
+
+FileDataSource::FileDataSource(const std::filesystem::path& path, bool loop) : m_name(path.string()), m_loop(loop) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        LOG_ERROR("ISS Tracker: Failed to open response log: {}", m_name);
+        return;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (!line.empty() && line.front() != '#') {
+            m_responses.push_back(std::move(line));
+        }
+    }
+}
+
+std::string FileDataSource::Fetch() {
+    if (m_next >= m_responses.size()) {
+        if (!m_loop || m_responses.empty()) {
+            return {};
+        }
+        m_next = 0;
+    }
+    return m_responses[m_next++];
+}
+
+std::string FileDataSource::GetName() const {
+    return m_name;
+}
+
+// SyntheticDataSource
+
+SyntheticDataSource::SyntheticDataSource(double sampleRate, long startTime)
+    : m_sampleRate(sampleRate > 0.0 ? sampleRate : 1.0), m_startTime(startTime) {}
+
+std::string SyntheticDataSource::Fetch() {
+    constexpr double DEG_TO_RAD = std::numbers::pi / 180.0;
+    constexpr double RAD_TO_DEG = 180.0 / std::numbers::pi;
+    constexpr double EARTH_ROTATION_DEG_PER_S = 360.0 / 86164.0; // Sidereal day
+
+    const double elapsed = static_cast<double>(m_sample++) / m_sampleRate;
+
+    // Circular orbit: argument of latitude advances uniformly while the Earth turns underneath
+    const double u = 2.0 * std::numbers::pi * elapsed / ORBITAL_PERIOD_S;
+    const double inclination = INCLINATION_DEG * DEG_TO_RAD;
+    const double latitude = std::asin(std::sin(inclination) * std::sin(u)) * RAD_TO_DEG;
+    double longitude = (std::atan2(std::cos(inclination) * std::sin(u), std::cos(u)) * RAD_TO_DEG) -
+                       (EARTH_ROTATION_DEG_PER_S * elapsed);
+    longitude = std::fmod(longitude + 180.0, 360.0);
+    if (longitude < 0.0) {
+        longitude += 360.0;
+    }
+    longitude -= 180.0;
+
+    const long timestamp = m_startTime + static_cast<long>(elapsed);
+
+    std::array<char, 256> buffer{};
+    const int length = std::snprintf(buffer.data(), buffer.size(),
+                                     R"({"name":"iss","id":25544,"latitude":%.6f,"longitude":%.6f,)"
+                                     R"("altitude":%.3f,"velocity":%.3f,"timestamp":%ld})",
+                                     latitude, longitude, ALTITUDE_KM, VELOCITY_KMH, timestamp);
+    if (length <= 0) {
+        return {};
+    }
+    return {buffer.data(), static_cast<size_t>(length)};
+}
+
+std::string SyntheticDataSource::GetName() const {
+    return "synthetic @ " + std::to_string(m_sampleRate) + " Hz";
+}
+
+} // namespace MetaImGUI
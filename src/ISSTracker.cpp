@@ -18,23 +18,41 @@
 
 #include "ISSTracker.h"
 
+#include "ISSDataSource.h"
 #include "Logger.h"
+#include "MainThreadDispatcher.h"
+#include "TrackReplay.h"
 
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <stop_token>
-#include <thread>
-
-// HTTP requests using libcurl (cross-platform)
-#include <curl/curl.h>
 
 namespace MetaImGUI {
 
-ISSTracker::ISSTracker() : m_tracking(false) {}
+namespace {
+uint64_t ElapsedMicroseconds(std::chrono::steady_clock::time_point start) {
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
+int64_t SampleAgeMs(const ISSPosition& position) {
+    const auto now = std::chrono::system_clock::now().time_since_epoch();
+    const auto nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    return static_cast<int64_t>(nowMs) - (static_cast<int64_t>(position.timestamp) * 1000);
+}
+} // namespace
+
+ISSTracker::ISSTracker(TaskScheduler& scheduler)
+    : m_dataSource(std::make_shared<HttpDataSource>()), m_scheduler(scheduler), m_tracking(false) {}
 
 ISSTracker::~ISSTracker() {
     StopTracking();
+
+    // The task refers to this tracker, so it must have finished before members are destroyed
+    const std::lock_guard<std::mutex> lock(m_threadMutex);
+    m_trackingTask.Wait();
 }
 
 void ISSTracker::StartTracking(std::function<void(const ISSPosition&)> callback) {
@@ -53,9 +71,19 @@ void ISSTracker::StartTracking(std::function<void(const ISSPosition&)> callback)
         m_callback = callback;
     }
 
-    // C++20: std::jthread with stop_token for clean cancellation
-    // jthread creates its own stop_source internally
-    m_trackingThread = std::jthread([this](const std::stop_token& stopToken) { TrackingLoop(stopToken); });
+    // Live fixes should not be joined onto a replayed trail
+    {
+        const std::lock_guard<std::mutex> dataLock(m_dataMutex);
+        if (m_historyFromReplay) {
+            m_positionHistory.Clear();
+            m_currentPosition = ISSPosition{};
+            m_historyFromReplay = false;
+        }
+    }
+
+    // A task cancelled by StopTracking may still be finishing its last fetch
+    StopTaskLocked();
+    m_trackingTask = m_scheduler.Spawn([this](std::stop_token stopToken) { return TrackLoop(std::move(stopToken)); });
 
     LOG_INFO("ISS Tracker: Started tracking");
 }
@@ -67,13 +95,20 @@ void ISSTracker::StopTracking() {
         return;
     }
 
-    // Request stop using jthread's internal stop_source
-    m_trackingThread.request_stop();
+    // Cancelling does not wait; an in-flight fetch is discarded when it returns
+    m_trackingTask.Cancel();
     m_tracking = false;
+    m_replaying = false;
 
     LOG_INFO("ISS Tracker: Stopped tracking");
 }
 
+void ISSTracker::StopTaskLocked() {
+    m_trackingTask.Cancel();
+    m_trackingTask.Wait();
+    m_trackingTask = TaskHandle{};
+}
+
 bool ISSTracker::IsTracking() const {
     return m_tracking;
 }
@@ -83,144 +118,395 @@ ISSPosition ISSTracker::GetCurrentPosition() const {
     return m_currentPosition;
 }
 
-void ISSTracker::GetPositionHistory(std::vector<double>& latitudes, std::vector<double>& longitudes) const {
+void ISSTracker::GetPositionHistory(std::vector<double>& latitudes, std::vector<double>& longitudes,
+                                    size_t maxPoints) const {
     const std::lock_guard<std::mutex> lock(m_dataMutex);
 
-    latitudes.clear();
-    longitudes.clear();
-    latitudes.reserve(m_positionHistory.size());
-    longitudes.reserve(m_positionHistory.size());
+    const size_t level = (maxPoints == 0) ? 0 : m_positionHistory.SelectLevel(maxPoints);
+    m_positionHistory.CopyLevel(level, latitudes, longitudes);
+}
 
-    for (const auto& pos : m_positionHistory) {
-        if (pos.valid) {
-            latitudes.push_back(pos.latitude);
-            longitudes.push_back(pos.longitude);
-        }
-    }
+void ISSTracker::GetPositionHistory(std::vector<double>& latitudes, std::vector<double>& longitudes,
+                                    std::vector<size_t>& segmentStarts, size_t maxPoints) const {
+    const std::lock_guard<std::mutex> lock(m_dataMutex);
+
+    const size_t level = (maxPoints == 0) ? 0 : m_positionHistory.SelectLevel(maxPoints);
+    m_positionHistory.CopyLevel(level, latitudes, longitudes, segmentStarts);
+}
+
+void ISSTracker::GetPositionHistory(std::pmr::vector<double>& latitudes, std::pmr::vector<double>& longitudes,
+                                    std::pmr::vector<size_t>& segmentStarts, size_t maxPoints) const {
+    const std::lock_guard<std::mutex> lock(m_dataMutex);
+
+    const size_t level = (maxPoints == 0) ? 0 : m_positionHistory.SelectLevel(maxPoints);
+    m_positionHistory.CopyLevel(level, latitudes, longitudes, segmentStarts);
 }
 
 ISSPosition ISSTracker::FetchPositionSync() {
-    return FetchPositionImpl();
+    return FetchPositionAsync().SyncWait();
+}
+
+void ISSTracker::SetDataSource(std::shared_ptr<ISSDataSource> source) {
+    if (!source) {
+        source = std::make_shared<HttpDataSource>();
+    }
+
+    const std::lock_guard<std::mutex> lock(m_sourceMutex);
+    LOG_INFO("ISS Tracker: Using data source {}", source->GetName());
+    m_dataSource = std::move(source);
 }
 
-void ISSTracker::TrackingLoop(const std::stop_token& stopToken) {
+void ISSTracker::SetPollInterval(std::chrono::milliseconds interval) {
+    m_pollIntervalMs = (std::max)(interval.count(), std::chrono::milliseconds::rep{0});
+}
+
+std::chrono::milliseconds ISSTracker::GetPollInterval() const {
+    return std::chrono::milliseconds(m_pollIntervalMs.load());
+}
+
+void ISSTracker::SetCallbackDispatcher(MainThreadDispatcher* dispatcher) {
+    m_callbackDispatcher.store(dispatcher, std::memory_order_release);
+}
+
+TrackerMetrics::Snapshot ISSTracker::GetMetrics() const {
+    return m_metrics.GetSnapshot();
+}
+
+void ISSTracker::ResetMetrics() {
+    m_metrics.Reset();
+}
+
+int64_t ISSTracker::GetCurrentSampleAgeMs() const {
+    const ISSPosition position = GetCurrentPosition();
+    if (!position.valid || position.timestamp <= 0) {
+        return -1;
+    }
+    return SampleAgeMs(position);
+}
+
+AsyncTask<void> ISSTracker::TrackLoop(std::stop_token stopToken) {
     while (!stopToken.stop_requested()) {
-        try {
-            const ISSPosition position = FetchPositionImpl();
+        const ISSPosition position = co_await FetchPositionAsync(stopToken);
 
-            // Check if stop was requested after fetch (important for slow networks)
-            if (stopToken.stop_requested()) {
-                LOG_INFO("ISS Tracker: Stop requested, discarding fetched data");
-                break;
-            }
+        // Check if stop was requested after fetch (important for slow networks)
+        if (stopToken.stop_requested()) {
+            LOG_INFO("ISS Tracker: Stop requested, discarding fetched data");
+            break;
+        }
 
-            if (position.valid) {
-                // Update current position and add to history
-                {
-                    const std::lock_guard<std::mutex> lock(m_dataMutex);
-                    m_currentPosition = position;
-                    AddToHistory(position);
-                }
-
-                // Invoke callback if set (copy under lock to avoid data race)
-                std::function<void(const ISSPosition&)> callback;
-                {
-                    const std::lock_guard<std::mutex> lock(m_callbackMutex);
-                    callback = m_callback;
-                }
-
-                if (callback) {
-                    try {
-                        callback(position);
-                    } catch (const std::exception& e) {
-                        LOG_ERROR("ISS Tracker: Callback threw exception: {}", e.what());
-                    } catch (...) {
-                        LOG_ERROR("ISS Tracker: Callback threw unknown exception");
-                    }
-                }
-
-                LOG_INFO("ISS Tracker: Position updated - Lat: {}, Long: {}, Alt: {} km, Vel: {} km/h",
-                         position.latitude, position.longitude, position.altitude, position.velocity);
+        if (position.valid) {
+            // Freshness of live data; replayed samples are historical by design
+            if (position.timestamp > 0) {
+                m_metrics.sampleAgeMs.Record(static_cast<uint64_t>((std::max)(SampleAgeMs(position), int64_t{0})));
             }
+            PublishPosition(position);
+
+            // Debug level: synthetic sources publish thousands of fixes per second
+            LOG_DEBUG("ISS Tracker: Position updated - Lat: {}, Long: {}, Alt: {} km, Vel: {} km/h",
+                      position.latitude, position.longitude, position.altitude, position.velocity);
+        }
+
+        // No worker is held while waiting; StopTracking ends the wait immediately
+        co_await m_scheduler.SleepFor(GetPollInterval(), stopToken);
+    }
+
+    LOG_INFO("ISS Tracker: Tracking loop exited");
+}
+
+void ISSTracker::PublishPosition(const ISSPosition& position) {
+    // Update current position and add to history
+    {
+        const std::lock_guard<std::mutex> lock(m_dataMutex);
+        m_currentPosition = position;
+        AddToHistory(position);
+    }
+
+    InvokeCallback(position);
+}
+
+void ISSTracker::InvokeCallback(const ISSPosition& position) {
+    MainThreadDispatcher* dispatcher = m_callbackDispatcher.load(std::memory_order_acquire);
+    if (dispatcher == nullptr) {
+        RunCallback(position);
+        return;
+    }
+
+    // The task holds only this pointer and the position, so it fits inline in the queue
+    if (!dispatcher->Post([this, position] { RunCallback(position); })) {
+        m_metrics.callbacksDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void ISSTracker::RunCallback(const ISSPosition& position) {
+    // Invoke callback if set (copy under lock to avoid data race)
+    std::function<void(const ISSPosition&)> callback;
+    {
+        const std::lock_guard<std::mutex> lock(m_callbackMutex);
+        callback = m_callback;
+    }
+
+    if (callback) {
+        const auto callbackStart = std::chrono::steady_clock::now();
+        try {
+            callback(position);
         } catch (const std::exception& e) {
-            LOG_ERROR("ISS Tracker: Error fetching position: {}", e.what());
+            LOG_ERROR("ISS Tracker: Callback threw exception: {}", e.what());
         } catch (...) {
-            LOG_ERROR("ISS Tracker: Unknown error fetching position");
+            LOG_ERROR("ISS Tracker: Callback threw unknown exception");
         }
+        m_metrics.callbackDurationUs.Record(ElapsedMicroseconds(callbackStart));
+    }
+}
 
-        // Wait 5 seconds before next update (if not stopped)
-        auto start = std::chrono::steady_clock::now();
-        while (!stopToken.stop_requested()) {
-            auto now = std::chrono::steady_clock::now();
-            auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - start).count();
-            if (elapsed >= 5) {
-                break;
-            }
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+// Session replay
+
+bool ISSTracker::LoadReplay(const std::filesystem::path& path) {
+    auto replay = std::make_shared<TrackReplay>();
+    if (!replay->Load(path)) {
+        LOG_ERROR("ISS Tracker: No valid samples in replay session: {}", path.string());
+        return false;
+    }
+
+    StopTracking();
+
+    const std::lock_guard<std::mutex> lock(m_threadMutex);
+
+    // Wait for the previous task so it cannot consume the seek below against the old session
+    StopTaskLocked();
+    m_replay = std::move(replay);
+    m_replayPaused = true;
+    m_replayTime = m_replay->GetStartTime();
+    m_seekTarget = m_replay->GetStartTime();
+    m_seekPending = true;
+    return true;
+}
+
+bool ISSTracker::HasReplay() const {
+    const std::lock_guard<std::mutex> lock(m_threadMutex);
+    return m_replay != nullptr;
+}
+
+void ISSTracker::StartReplay() {
+    const std::lock_guard<std::mutex> lock(m_threadMutex);
+
+    if (!m_replay) {
+        LOG_ERROR("ISS Tracker: No replay session loaded");
+        return;
+    }
+
+    // Playing from the end starts over
+    if (m_replayTime >= m_replay->GetEndTime()) {
+        m_seekTarget = m_replay->GetStartTime();
+        m_seekPending = true;
+    }
+    m_replayPaused = false;
+
+    if (m_replaying) {
+        return;
+    }
+
+    // Stops and waits for live tracking if it is running
+    StopTaskLocked();
+    m_tracking = true;
+    m_replaying = true;
+
+    ReplayCursor state;
+    state.replay = m_replay;
+    state.sessionTime = static_cast<double>(m_replayTime.load());
+    state.cursor = m_replay->CountUpTo(m_replayTime);
+    state.lastTick = std::chrono::steady_clock::now();
+    m_trackingTask = m_scheduler.SchedulePeriodic(
+        REPLAY_TICK,
+        [this, state = std::move(state)](const std::stop_token& stopToken) mutable { ReplayTick(stopToken, state); });
+
+    LOG_INFO("ISS Tracker: Started replay");
+}
+
+void ISSTracker::PauseReplay() {
+    m_replayPaused = true;
+}
+
+bool ISSTracker::IsReplaying() const {
+    return m_replaying;
+}
+
+bool ISSTracker::IsReplayPaused() const {
+    return m_replayPaused;
+}
+
+void ISSTracker::SetReplaySpeed(double speed) {
+    m_replaySpeed = std::clamp(speed, MIN_REPLAY_SPEED, MAX_REPLAY_SPEED);
+}
+
+double ISSTracker::GetReplaySpeed() const {
+    return m_replaySpeed;
+}
+
+void ISSTracker::SeekReplay(long timestamp) {
+    const long start = GetReplayStartTime();
+    const long end = GetReplayEndTime();
+    const long target = std::clamp(timestamp, start, (std::max)(start, end));
+
+    // The replay thread applies the seek; publish the target now so the UI follows immediately
+    m_seekTarget = target;
+    m_replayTime = target;
+    m_seekPending = true;
+}
+
+long ISSTracker::GetReplayStartTime() const {
+    const std::lock_guard<std::mutex> lock(m_threadMutex);
+    return m_replay ? m_replay->GetStartTime() : 0;
+}
+
+long ISSTracker::GetReplayEndTime() const {
+    const std::lock_guard<std::mutex> lock(m_threadMutex);
+    return m_replay ? m_replay->GetEndTime() : 0;
+}
+
+long ISSTracker::GetReplayTime() const {
+    return m_replayTime;
+}
+
+void ISSTracker::ReplayTick(const std::stop_token& stopToken, ReplayCursor& state) {
+    const TrackReplay& replay = *state.replay;
+    const auto now = std::chrono::steady_clock::now();
+    const double elapsed = std::chrono::duration<double>(now - state.lastTick).count();
+    state.lastTick = now;
+
+    if (m_seekPending.exchange(false)) {
+        // O(log n) lookup in the pre-indexed session, then redraw the trail up to that point
+        state.sessionTime = static_cast<double>(m_seekTarget.load());
+        state.cursor = replay.CountUpTo(m_seekTarget);
+        RebuildHistoryFromReplay(replay, state.cursor);
+    } else if (!m_replayPaused) {
+        const auto endTime = static_cast<double>(replay.GetEndTime());
+        state.sessionTime = (std::min)(state.sessionTime + (elapsed * m_replaySpeed), endTime);
+        const size_t target = replay.CountUpTo(static_cast<long>(state.sessionTime));
+        for (; state.cursor < target && !stopToken.stop_requested(); ++state.cursor) {
+            PublishPosition(replay.GetSample(state.cursor));
+        }
+
+        if (state.cursor >= replay.GetSampleCount()) {
+            m_replayPaused = true;
+            LOG_INFO("ISS Tracker: Replay reached end of session");
         }
     }
 
-    LOG_INFO("ISS Tracker: Tracking loop exited");
+    if (!m_seekPending) {
+        m_replayTime = static_cast<long>(state.sessionTime);
+    }
 }
 
-ISSPosition ISSTracker::FetchPositionImpl() {
-    ISSPosition position;
-    position.valid = false;
+void ISSTracker::RebuildHistoryFromReplay(const TrackReplay& replay, size_t sampleCount) {
+    ISSPosition current;
+    {
+        const std::lock_guard<std::mutex> lock(m_dataMutex);
+        m_positionHistory.Clear();
 
-    try {
-        const std::string jsonResponse = FetchJSON(ISS_API_URL);
-        if (jsonResponse.empty()) {
-            LOG_ERROR("ISS Tracker: Empty response from server");
-            return position;
+        // Only the samples that fit in the history can be visible in the trail
+        const size_t first = (sampleCount > m_maxHistorySize) ? sampleCount - m_maxHistorySize : 0;
+        for (size_t i = first; i < sampleCount; ++i) {
+            AddToHistory(replay.GetSample(i));
         }
 
-        position = ParseJSON(jsonResponse);
-    } catch (const std::bad_alloc& e) {
-        LOG_ERROR("ISS Tracker: Memory allocation failed: {}", e.what());
-    } catch (const std::exception& e) {
-        LOG_ERROR("ISS Tracker: Fetch failed: {}", e.what());
-    } catch (...) {
-        LOG_ERROR("ISS Tracker: Unknown error during fetch");
+        m_currentPosition = (sampleCount > 0) ? replay.GetSample(sampleCount - 1) : ISSPosition{};
+        m_historyFromReplay = true;
+        current = m_currentPosition;
     }
 
-    return position;
+    if (current.valid) {
+        InvokeCallback(current);
+    }
 }
 
-namespace {
-// Callback for libcurl to write response data
-size_t WriteCallback(void* contents, size_t size, size_t nmemb, void* userp) {
-    static_cast<std::string*>(userp)->append(static_cast<char*>(contents), size * nmemb);
-    return size * nmemb;
+// Recording
+
+bool ISSTracker::StartRecording(const std::filesystem::path& path) {
+    const std::lock_guard<std::mutex> lock(m_recordMutex);
+
+    m_recordFile = std::ofstream(path, std::ios::app);
+    if (!m_recordFile.is_open()) {
+        LOG_ERROR("ISS Tracker: Failed to open recording file: {}", path.string());
+        return false;
+    }
+
+    LOG_INFO("ISS Tracker: Recording responses to {}", path.string());
+    return true;
 }
-} // namespace
 
-std::string ISSTracker::FetchJSON(const std::string& url) {
-    std::string result;
+void ISSTracker::StopRecording() {
+    const std::lock_guard<std::mutex> lock(m_recordMutex);
+    if (m_recordFile.is_open()) {
+        m_recordFile.close();
+        LOG_INFO("ISS Tracker: Recording stopped");
+    }
+}
+
+bool ISSTracker::IsRecording() const {
+    const std::lock_guard<std::mutex> lock(m_recordMutex);
+    return m_recordFile.is_open();
+}
+
+void ISSTracker::RecordResponse(const std::string& jsonResponse) {
+    const std::lock_guard<std::mutex> lock(m_recordMutex);
+    if (!m_recordFile.is_open()) {
+        return;
+    }
+
+    // One response per line; the API returns compact JSON but guard against embedded newlines
+    std::string line = jsonResponse;
+    std::replace(line.begin(), line.end(), '\n', ' ');
+    std::replace(line.begin(), line.end(), '\r', ' ');
+    m_recordFile << line << '\n';
+    m_recordFile.flush();
+}
+
+AsyncTask<ISSPosition> ISSTracker::FetchPositionAsync(std::stop_token stopToken) {
+    ISSPosition position;
+    position.valid = false;
 
-    // RAII-wrap CURL handle to prevent leaks on exceptions
-    const std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> curl(curl_easy_init(), curl_easy_cleanup);
-    if (!curl) {
-        LOG_ERROR("ISS Tracker: Failed to initialize CURL");
-        return result;
+    // The source is kept alive by this reference even if SetDataSource replaces it mid-fetch
+    std::shared_ptr<ISSDataSource> source;
+    {
+        const std::lock_guard<std::mutex> lock(m_sourceMutex);
+        source = m_dataSource;
     }
 
-    curl_easy_setopt(curl.get(), CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl.get(), CURLOPT_WRITEFUNCTION, WriteCallback);
-    curl_easy_setopt(curl.get(), CURLOPT_WRITEDATA, &result);
-    curl_easy_setopt(curl.get(), CURLOPT_USERAGENT, "MetaImGUI-ISSTracker/1.0");
-    curl_easy_setopt(curl.get(), CURLOPT_FOLLOWLOCATION, 1L);
-    curl_easy_setopt(curl.get(), CURLOPT_TIMEOUT, 30L); // Increased to 30 seconds for slow networks
-    curl_easy_setopt(curl.get(), CURLOPT_SSL_VERIFYPEER, 1L);
-    curl_easy_setopt(curl.get(), CURLOPT_SSL_VERIFYHOST, 2L);
+    try {
+        const auto fetchStart = std::chrono::steady_clock::now();
+        const std::string jsonResponse = co_await source->FetchAsync(stopToken);
+        m_metrics.fetchLatencyUs.Record(ElapsedMicroseconds(fetchStart));
+
+        // HTTP fetches complete on the client's I/O thread; parse and publish on the pool
+        co_await m_scheduler.Schedule();
+
+        if (jsonResponse.empty()) {
+            if (!stopToken.stop_requested()) {
+                m_metrics.fetchFailures.fetch_add(1, std::memory_order_relaxed);
+                LOG_ERROR("ISS Tracker: Empty response from data source");
+            }
+            co_return position;
+        }
+        m_metrics.fetchSuccesses.fetch_add(1, std::memory_order_relaxed);
+        m_metrics.bytesReceived.fetch_add(jsonResponse.size(), std::memory_order_relaxed);
 
-    const CURLcode res = curl_easy_perform(curl.get());
+        RecordResponse(jsonResponse);
 
-    if (res != CURLE_OK) {
-        LOG_ERROR("ISS Tracker: Request failed: {}", curl_easy_strerror(res));
-        result.clear();
+        const auto parseStart = std::chrono::steady_clock::now();
+        position = ParseJSON(jsonResponse);
+        m_metrics.parseTimeUs.Record(ElapsedMicroseconds(parseStart));
+        if (!position.valid) {
+            m_metrics.parseFailures.fetch_add(1, std::memory_order_relaxed);
+        }
+    } catch (const std::bad_alloc& e) {
+        LOG_ERROR("ISS Tracker: Memory allocation failed: {}", e.what());
+    } catch (const std::exception& e) {
+        LOG_ERROR("ISS Tracker: Fetch failed: {}", e.what());
+    } catch (...) {
+        LOG_ERROR("ISS Tracker: Unknown error during fetch");
     }
 
-    return result;
+    co_return position;
 }
 
 ISSPosition ISSTracker::ParseJSON(const std::string& jsonResponse) {
@@ -268,13 +554,8 @@ void ISSTracker::AddToHistory(const ISSPosition& position) {
         return;
     }
 
-    // Add to history
-    m_positionHistory.push_back(position);
-
-    // Keep only the last maxHistorySize positions
-    while (m_positionHistory.size() > m_maxHistorySize) {
-        m_positionHistory.pop_front();
-    }
+    // TrackHistory trims the oldest samples itself once it exceeds its capacity
+    m_positionHistory.Append(position.longitude, position.latitude, position.timestamp);
 }
 
 } // namespace MetaImGUI
@@ -0,0 +1,128 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ListFilter.h"
+
+#include "ListDataProvider.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace MetaImGUI {
+
+namespace {
+// ASCII only: other bytes, including UTF-8 sequences, must match exactly
+char FoldCase(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+} // namespace
+
+ListFilter::ListFilter(const ListDataProvider& provider) : m_provider(provider), m_offsets{0} {}
+
+void ListFilter::SetQuery(std::string_view query) {
+    std::string folded;
+    folded.reserve(query.size());
+    std::transform(query.begin(), query.end(), std::back_inserter(folded), FoldCase);
+    if (folded == m_query) {
+        return;
+    }
+
+    // Every item containing the new query also contains the old one
+    const bool narrowing = !m_query.empty() && folded.find(m_query) != std::string::npos;
+    m_query = std::move(folded);
+
+    if (narrowing) {
+        // Matches found so far, then the broader query's candidates not yet re-tested; both ascending
+        m_matches.insert(m_matches.end(), m_candidates.begin() + static_cast<std::ptrdiff_t>(m_nextCandidate),
+                         m_candidates.end());
+        m_candidates = std::move(m_matches);
+        m_matches.clear();
+        m_nextCandidate = 0;
+        return;
+    }
+
+    m_matches.clear();
+    m_candidates.clear();
+    m_nextCandidate = 0;
+    m_scanned = 0;
+}
+
+bool ListFilter::Step(size_t budget) {
+    const size_t count = m_provider.GetCount();
+    const auto indexNext = [this]() {
+        const std::string_view item = m_provider.GetItem(GetIndexedCount());
+        const size_t start = m_folded.size();
+        m_folded.append(item);
+        std::transform(m_folded.begin() + static_cast<std::ptrdiff_t>(start), m_folded.end(),
+                       m_folded.begin() + static_cast<std::ptrdiff_t>(start), FoldCase);
+        m_offsets.push_back(m_folded.size());
+    };
+
+    if (!m_query.empty()) {
+        for (; budget > 0 && m_nextCandidate < m_candidates.size(); --budget) {
+            const size_t index = m_candidates[m_nextCandidate++];
+            if (Matches(index)) {
+                m_matches.push_back(index);
+            }
+        }
+        if (m_nextCandidate == m_candidates.size()) {
+            m_candidates.clear();
+            m_nextCandidate = 0;
+        }
+
+        // Items past the index are folded as the scan reaches them
+        for (; budget > 0 && m_scanned < count; --budget) {
+            if (m_scanned == GetIndexedCount()) {
+                indexNext();
+            }
+            if (Matches(m_scanned)) {
+                m_matches.push_back(m_scanned);
+            }
+            ++m_scanned;
+        }
+    }
+
+    // Spare budget prepares the index for the next query
+    for (; budget > 0 && GetIndexedCount() < count; --budget) {
+        indexNext();
+    }
+    return IsComplete();
+}
+
+bool ListFilter::IsComplete() const {
+    const size_t count = m_provider.GetCount();
+    if (GetIndexedCount() < count) {
+        return false;
+    }
+    return m_query.empty() || (m_candidates.empty() && m_scanned == count);
+}
+
+size_t ListFilter::GetRowCount() const {
+    return m_query.empty() ? m_provider.GetCount() : m_matches.size();
+}
+
+size_t ListFilter::GetItemIndex(size_t row) const {
+    return m_query.empty() ? row : m_matches[row];
+}
+
+bool ListFilter::Matches(size_t index) const {
+    const std::string_view text(m_folded.data() + m_offsets[index], m_offsets[index + 1] - m_offsets[index]);
+    return text.find(m_query) != std::string_view::npos;
+}
+
+} // namespace MetaImGUI
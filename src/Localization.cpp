@@ -63,7 +63,7 @@ void Localization::SetLanguage(const std::string& languageCode) {
     }
 }
 
-std::string Localization::GetCurrentLanguage() const {
+const std::string& Localization::GetCurrentLanguage() const {
     return m_currentLanguage;
 }
 
@@ -76,7 +76,7 @@ std::vector<std::string> Localization::GetAvailableLanguages() const {
     return languages;
 }
 
-std::string Localization::Tr(const std::string& key) const {
+const std::string& Localization::Tr(std::string_view key) const {
     // Try current language
     auto langIt = m_translations.find(m_currentLanguage);
     if (langIt != m_translations.end()) {
@@ -98,7 +98,11 @@ std::string Localization::Tr(const std::string& key) const {
     }
 
     // Return key if not found
-    return key;
+    auto missing = m_missingKeys.find(key);
+    if (missing == m_missingKeys.end()) {
+        missing = m_missingKeys.emplace(key).first;
+    }
+    return *missing;
 }
 
 void Localization::AddTranslation(const std::string& languageCode, const std::string& key, const std::string& value) {
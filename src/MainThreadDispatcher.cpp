@@ -0,0 +1,117 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "MainThreadDispatcher.h"
+
+#include "Logger.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <exception>
+
+namespace MetaImGUI {
+
+MainThreadDispatcher::MainThreadDispatcher(size_t capacity)
+    : m_mask(std::bit_ceil((std::max)(capacity, size_t{2})) - 1) {
+    m_slots = std::make_unique<Slot[]>(m_mask + 1); // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    for (size_t i = 0; i <= m_mask; ++i) {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+MainThreadDispatcher::~MainThreadDispatcher() {
+    Clear();
+}
+
+bool MainThreadDispatcher::Post(Task task) {
+    if (!Push(task)) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+bool MainThreadDispatcher::Push(Task& task) {
+    // Bounded ring with per-slot sequence numbers: a slot is free for position pos when
+    // its sequence equals pos, and holds a task for the consumer when it equals pos + 1
+    size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    for (;;) {
+        slot = &m_slots[pos & m_mask];
+        const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->task = std::move(task);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool MainThreadDispatcher::TryPop(Task& task) {
+    Slot& slot = m_slots[m_dequeuePos & m_mask];
+    if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+        return false;
+    }
+
+    task = std::move(slot.task);
+    slot.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+    ++m_dequeuePos;
+    return true;
+}
+
+size_t MainThreadDispatcher::Drain(std::chrono::microseconds budget) {
+    const auto deadline = std::chrono::steady_clock::now() + budget;
+
+    size_t executed = 0;
+    Task task;
+    while (TryPop(task)) {
+        try {
+            task();
+        } catch (const std::exception& e) {
+            LOG_ERROR("Main thread task threw exception: {}", e.what());
+        } catch (...) {
+            LOG_ERROR("Main thread task threw unknown exception");
+        }
+        task.Reset();
+        ++executed;
+
+        if (std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+    }
+    return executed;
+}
+
+void MainThreadDispatcher::Clear() {
+    Task task;
+    while (TryPop(task)) {
+        task.Reset();
+    }
+}
+
+} // namespace MetaImGUI
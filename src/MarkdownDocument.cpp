@@ -0,0 +1,631 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "MarkdownDocument.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace MetaImGUI {
+
+namespace {
+constexpr uint8_t MAX_HEADING_LEVEL = 6;
+constexpr uint8_t MAX_LIST_DEPTH = 4;
+constexpr size_t MAX_LIST_NUMBER_DIGITS = 9;
+constexpr int TAB_WIDTH = 4;
+
+bool IsSpace(char c) {
+    return c == ' ' || c == '\t';
+}
+
+bool IsAlnum(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) != 0;
+}
+
+bool IsDigit(char c) {
+    return std::isdigit(static_cast<unsigned char>(c)) != 0;
+}
+
+// Whitespace at text[position], with the ends of the text counting as whitespace
+bool IsSpaceAt(std::string_view text, size_t position) {
+    return position >= text.size() || std::isspace(static_cast<unsigned char>(text[position])) != 0;
+}
+
+// Number of consecutive c at the start of text
+size_t RunLength(std::string_view text, char c) {
+    const size_t end = text.find_first_not_of(c);
+    return (end == std::string_view::npos) ? text.size() : end;
+}
+
+// Leading indentation in columns, and the line without it
+std::string_view TrimIndent(std::string_view line, int& columns) {
+    columns = 0;
+    size_t i = 0;
+    for (; i < line.size() && IsSpace(line[i]); ++i) {
+        columns += (line[i] == '\t') ? TAB_WIDTH : 1;
+    }
+    return line.substr(i);
+}
+
+std::string_view TrimTrailing(std::string_view text) {
+    while (!text.empty() && IsSpace(text.back())) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+// "# Title", "## Title ##": returns the level and sets text, or 0
+uint8_t ParseHeading(std::string_view line, std::string_view& text) {
+    size_t hashes = 0;
+    while (hashes < line.size() && line[hashes] == '#') {
+        ++hashes;
+    }
+    if (hashes == 0 || hashes > MAX_HEADING_LEVEL || (hashes < line.size() && !IsSpace(line[hashes]))) {
+        return 0;
+    }
+
+    text = TrimTrailing(line.substr(hashes));
+    // An optional closing run of '#' preceded by a space
+    if (const size_t closing = text.find_last_not_of('#');
+        closing != std::string_view::npos && closing + 1 < text.size() && IsSpace(text[closing])) {
+        text = TrimTrailing(text.substr(0, closing));
+    }
+    while (!text.empty() && IsSpace(text.front())) {
+        text.remove_prefix(1);
+    }
+    return static_cast<uint8_t>(hashes);
+}
+
+// Three or more of the same '-', '*' or '_', optionally separated by spaces
+bool IsRule(std::string_view line) {
+    const char marker = line.empty() ? '\0' : line.front();
+    if (marker != '-' && marker != '*' && marker != '_') {
+        return false;
+    }
+    int count = 0;
+    for (const char c : line) {
+        if (c == marker) {
+            ++count;
+        } else if (!IsSpace(c)) {
+            return false;
+        }
+    }
+    return count >= 3;
+}
+
+// "- item", "* item", "+ item", "1. item", "2) item": sets number (0 for bullets) and text
+bool ParseListItem(std::string_view line, uint32_t& number, std::string_view& text) {
+    size_t markerEnd = 0;
+    number = 0;
+    if (!line.empty() && (line[0] == '-' || line[0] == '*' || line[0] == '+')) {
+        markerEnd = 1;
+    } else {
+        size_t digits = 0;
+        while (digits < line.size() && digits < MAX_LIST_NUMBER_DIGITS && IsDigit(line[digits])) {
+            number = number * 10 + static_cast<uint32_t>(line[digits] - '0');
+            ++digits;
+        }
+        if (digits == 0 || digits >= line.size() || (line[digits] != '.' && line[digits] != ')')) {
+            return false;
+        }
+        number = std::max<uint32_t>(number, 1);
+        markerEnd = digits + 1;
+    }
+    if (markerEnd < line.size() && !IsSpace(line[markerEnd])) {
+        return false;
+    }
+
+    text = line.substr(std::min(markerEnd + 1, line.size()));
+    while (!text.empty() && IsSpace(text.front())) {
+        text.remove_prefix(1);
+    }
+    return true;
+}
+
+// Length of a bare http(s) URL starting at text, without trailing punctuation; 0 if there is none
+size_t BareUrlLength(std::string_view text) {
+    if (!text.starts_with("https://") && !text.starts_with("http://")) {
+        return 0;
+    }
+    size_t end = 0;
+    while (!IsSpaceAt(text, end) && text[end] != '<') {
+        ++end;
+    }
+    // Sentence punctuation after a URL is not part of it
+    while (end > 0 && std::string_view(".,;:!?'\")").find(text[end - 1]) != std::string_view::npos) {
+        if (text[end - 1] == ')' && text.substr(0, end).find('(') != std::string_view::npos) {
+            break;
+        }
+        --end;
+    }
+    return (end > text.find("://") + 3) ? end : 0;
+}
+
+bool IsUtf8Boundary(std::string_view text, size_t position) {
+    return position >= text.size() || (static_cast<unsigned char>(text[position]) & 0xC0) != 0x80;
+}
+
+// Collects the runs of one laid-out block, breaking lines as words overflow
+class LineBuilder {
+public:
+    LineBuilder(MarkdownLayout& layout, uint32_t block, float y, float indent, float available, float lineHeight,
+                float fontScale)
+        : m_layout(layout), m_block(block), m_y(y), m_indent(indent), m_available(available),
+          m_lineHeight(lineHeight), m_fontScale(fontScale) {
+        StartLine();
+    }
+
+    [[nodiscard]] bool IsLineEmpty() const {
+        return m_layout.lines.back().runCount == 0;
+    }
+    [[nodiscard]] float GetRemaining() const {
+        return m_available - m_x;
+    }
+    [[nodiscard]] bool Fits(float width) const {
+        return m_x + width <= m_available;
+    }
+
+    void Add(const MarkdownSpan& span, uint32_t offset, uint32_t length, float width) {
+        MarkdownLine& line = m_layout.lines.back();
+        if (line.runCount > 0) {
+            MarkdownRun& last = m_layout.runs.back();
+            if (last.style == span.style && last.link == span.link && last.offset + last.length == offset) {
+                last.length += length;
+                last.width += width;
+                m_x += width;
+                return;
+            }
+        }
+        m_layout.runs.push_back({.offset = offset,
+                                 .length = length,
+                                 .style = span.style,
+                                 .link = span.link,
+                                 .x = m_indent + m_x,
+                                 .width = width});
+        ++line.runCount;
+        m_x += width;
+    }
+
+    void NewLine() {
+        m_y += m_lineHeight;
+        StartLine();
+        m_layout.lines.back().firstOfBlock = false;
+    }
+
+    // Bottom of the last line
+    [[nodiscard]] float Finish() const {
+        return m_y + m_lineHeight;
+    }
+
+private:
+    void StartLine() {
+        m_layout.lines.push_back({.y = m_y,
+                                  .height = m_lineHeight,
+                                  .fontScale = m_fontScale,
+                                  .block = m_block,
+                                  .firstRun = static_cast<uint32_t>(m_layout.runs.size()),
+                                  .runCount = 0,
+                                  .firstOfBlock = true});
+        m_x = 0.0f;
+    }
+
+    MarkdownLayout& m_layout;
+    uint32_t m_block;
+    float m_y;
+    float m_indent;
+    float m_available;
+    float m_lineHeight;
+    float m_fontScale;
+    float m_x = 0.0f;
+};
+} // namespace
+
+MarkdownDocument::MarkdownDocument(std::string_view markdown) {
+    Parse(markdown);
+}
+
+float MarkdownDocument::HeadingScale(uint8_t level) {
+    switch (level) {
+    case 1:
+        return 1.5f;
+    case 2:
+        return 1.3f;
+    case 3:
+        return 1.15f;
+    default:
+        return 1.0f;
+    }
+}
+
+void MarkdownDocument::Parse(std::string_view markdown) {
+    m_text.clear();
+    m_blocks.clear();
+    m_spans.clear();
+    m_links.clear();
+    InvalidateLayout();
+
+    // Consecutive lines of a paragraph, list item or quote are gathered, then parsed inline as one
+    std::string pending;
+    MarkdownBlockType pendingType = MarkdownBlockType::Paragraph;
+    uint8_t pendingLevel = 0;
+    uint32_t pendingNumber = 0;
+    auto flush = [&]() {
+        if (!pending.empty()) {
+            AddBlock(pendingType, pendingLevel, pendingNumber, pending);
+            pending.clear();
+        }
+    };
+    auto append = [&](std::string_view text) {
+        if (!pending.empty()) {
+            pending += ' '; // Soft line break
+        }
+        pending += text;
+    };
+
+    bool inFence = false;
+    std::string_view fence;
+    std::string code;
+
+    while (!markdown.empty()) {
+        const size_t newline = markdown.find('\n');
+        std::string_view line = markdown.substr(0, newline);
+        markdown.remove_prefix((newline == std::string_view::npos) ? markdown.size() : newline + 1);
+        if (line.ends_with('\r')) {
+            line.remove_suffix(1);
+        }
+
+        int indent = 0;
+        const std::string_view trimmed = TrimIndent(line, indent);
+
+        if (inFence) {
+            const std::string_view closing = TrimTrailing(trimmed);
+            if (RunLength(closing, fence[0]) >= fence.size() && RunLength(closing, fence[0]) == closing.size()) {
+                if (!code.empty() && code.back() == '\n') {
+                    code.pop_back();
+                }
+                AddBlock(MarkdownBlockType::CodeBlock, 0, 0, code);
+                code.clear();
+                inFence = false;
+            } else {
+                code += line;
+                code += '\n';
+            }
+            continue;
+        }
+
+        if (trimmed.starts_with("```") || trimmed.starts_with("~~~")) {
+            flush();
+            inFence = true;
+            fence = trimmed.substr(0, 3);
+            continue;
+        }
+
+        if (TrimTrailing(trimmed).empty()) {
+            flush();
+            continue;
+        }
+
+        std::string_view text;
+        uint32_t number = 0;
+        if (const uint8_t level = ParseHeading(trimmed, text); level > 0) {
+            flush();
+            AddBlock(MarkdownBlockType::Heading, level, 0, text);
+        } else if (IsRule(TrimTrailing(trimmed))) {
+            flush();
+            AddBlock(MarkdownBlockType::Rule, 0, 0, {});
+        } else if (ParseListItem(trimmed, number, text)) {
+            flush();
+            pendingType = MarkdownBlockType::ListItem;
+            pendingLevel = static_cast<uint8_t>(std::min(indent / 2, MAX_LIST_DEPTH - 1));
+            pendingNumber = number;
+            append(TrimTrailing(text));
+        } else if (trimmed.starts_with('>')) {
+            if (pendingType != MarkdownBlockType::Quote) {
+                flush();
+                pendingType = MarkdownBlockType::Quote;
+            }
+            text = trimmed.substr(1);
+            while (!text.empty() && IsSpace(text.front())) {
+                text.remove_prefix(1);
+            }
+            append(TrimTrailing(text));
+        } else {
+            // Continues the open paragraph, list item or quote, or starts a paragraph
+            if (pending.empty()) {
+                pendingType = MarkdownBlockType::Paragraph;
+                pendingLevel = 0;
+                pendingNumber = 0;
+            }
+            append(TrimTrailing(trimmed));
+        }
+    }
+
+    if (inFence) {
+        // An unterminated fence runs to the end of the document
+        if (!code.empty() && code.back() == '\n') {
+            code.pop_back();
+        }
+        AddBlock(MarkdownBlockType::CodeBlock, 0, 0, code);
+    }
+    flush();
+}
+
+void MarkdownDocument::AddBlock(MarkdownBlockType type, uint8_t level, uint32_t number, std::string_view inlineText) {
+    m_blocks.push_back({.type = type,
+                        .level = level,
+                        .number = number,
+                        .firstSpan = static_cast<uint32_t>(m_spans.size()),
+                        .spanCount = 0});
+    if (type == MarkdownBlockType::CodeBlock) {
+        AppendSpan(inlineText, MarkdownStyle::CODE, -1);
+    } else if (type != MarkdownBlockType::Rule) {
+        ParseInline(inlineText);
+    }
+    m_blocks.back().spanCount = static_cast<uint32_t>(m_spans.size()) - m_blocks.back().firstSpan;
+}
+
+void MarkdownDocument::AppendSpan(std::string_view text, uint8_t style, int32_t link) {
+    if (text.empty()) {
+        return;
+    }
+    const auto offset = static_cast<uint32_t>(m_text.size());
+    m_text += text;
+
+    // Adjacent text in the same style within a block is one span
+    if (m_spans.size() > m_blocks.back().firstSpan) {
+        MarkdownSpan& last = m_spans.back();
+        if (last.style == style && last.link == link && last.offset + last.length == offset) {
+            last.length += static_cast<uint32_t>(text.size());
+            return;
+        }
+    }
+    m_spans.push_back({.offset = offset, .length = static_cast<uint32_t>(text.size()), .style = style, .link = link});
+}
+
+void MarkdownDocument::ParseInline(std::string_view text, uint8_t baseStyle, int32_t link) {
+    uint8_t style = baseStyle;
+    std::string plain; // Text waiting to be appended in the current style
+    auto flushPlain = [&]() {
+        AppendSpan(plain, style, link);
+        plain.clear();
+    };
+    auto addLink = [&](std::string_view label, std::string_view url) {
+        flushPlain();
+        m_links.emplace_back(url);
+        const auto index = static_cast<int32_t>(m_links.size() - 1);
+        if (label.empty()) {
+            AppendSpan(url, style | MarkdownStyle::LINK, index);
+        } else {
+            ParseInline(label, style | MarkdownStyle::LINK, index);
+        }
+    };
+
+    size_t i = 0;
+    while (i < text.size()) {
+        const char c = text[i];
+        const std::string_view rest = text.substr(i);
+
+        // Backslash escapes of ASCII punctuation
+        if (c == '\\' && i + 1 < text.size() && std::ispunct(static_cast<unsigned char>(text[i + 1])) != 0) {
+            plain += text[i + 1];
+            i += 2;
+            continue;
+        }
+
+        // Code spans: a run of backticks up to a run of the same length
+        if (c == '`') {
+            const size_t run = RunLength(rest, '`');
+            const std::string_view ticks = rest.substr(0, run);
+            size_t close = rest.find(ticks, run);
+            while (close != std::string_view::npos && close + run < rest.size() && rest[close + run] == '`') {
+                close = rest.find(ticks, rest.find_first_not_of('`', close));
+            }
+            if (close != std::string_view::npos) {
+                std::string_view code = rest.substr(run, close - run);
+                if (code.size() >= 2 && code.front() == ' ' && code.back() == ' ') {
+                    code = code.substr(1, code.size() - 2);
+                }
+                flushPlain();
+                AppendSpan(code, style | MarkdownStyle::CODE, link);
+                i += close + run;
+            } else {
+                plain += ticks;
+                i += run;
+            }
+            continue;
+        }
+
+        // Strong (** or __) and emphasis (* or _); '_' only at word boundaries so snake_case stays literal
+        if (c == '*' || c == '_') {
+            const size_t run = std::min<size_t>(RunLength(rest, c), 3);
+            const auto toggle = static_cast<uint8_t>((run >= 2 ? MarkdownStyle::STRONG : 0) |
+                                                     (run % 2 == 1 ? MarkdownStyle::EMPHASIS : 0));
+            const bool prevSpace = i == 0 || IsSpaceAt(text, i - 1);
+            const bool nextSpace = IsSpaceAt(text, i + run);
+            const bool closing = (style & toggle) == toggle && !prevSpace;
+            const bool opening = (style & toggle) == 0 && !nextSpace &&
+                                 rest.find(rest.substr(0, run), run) != std::string_view::npos;
+            const bool boundary = c == '*' || (closing ? (i + run >= text.size() || !IsAlnum(text[i + run]))
+                                                       : (i == 0 || !IsAlnum(text[i - 1])));
+            if ((closing || opening) && boundary) {
+                flushPlain();
+                style ^= toggle;
+            } else {
+                plain.append(run, c);
+            }
+            i += run;
+            continue;
+        }
+
+        // [label](url) links and ![alt](url) images, which are shown as links
+        if (link < 0 && (c == '[' || (c == '!' && rest.starts_with("![")))) {
+            const size_t open = (c == '!') ? 1 : 0;
+            const size_t close = rest.find(']', open);
+            if (close != std::string_view::npos && close + 1 < rest.size() && rest[close + 1] == '(') {
+                const size_t end = rest.find(')', close + 2);
+                if (end != std::string_view::npos) {
+                    std::string_view url = rest.substr(close + 2, end - close - 2);
+                    url = url.substr(0, url.find(' ')); // Drop an optional "title"
+                    addLink(rest.substr(open + 1, close - open - 1), url);
+                    i += end + 1;
+                    continue;
+                }
+            }
+        }
+
+        // <https://...> autolinks
+        if (link < 0 && c == '<' && BareUrlLength(rest.substr(1)) > 0) {
+            if (const size_t end = rest.find('>'); end != std::string_view::npos) {
+                addLink({}, rest.substr(1, end - 1));
+                i += end + 1;
+                continue;
+            }
+        }
+
+        // Bare URLs, as GitHub's "Full Changelog" lines use
+        if (link < 0 && c == 'h' && (i == 0 || !IsAlnum(text[i - 1]))) {
+            if (const size_t length = BareUrlLength(rest); length > 0) {
+                addLink({}, rest.substr(0, length));
+                i += length;
+                continue;
+            }
+        }
+
+        plain += c;
+        ++i;
+    }
+    flushPlain();
+}
+
+void MarkdownDocument::InvalidateLayout() {
+    m_layoutValid = false;
+}
+
+const MarkdownLayout& MarkdownDocument::Layout(float width, uint64_t fontKey, const MarkdownMetrics& metrics) {
+    // Whole pixels, so sub-pixel jitter in the available width does not relayout every frame
+    width = std::max(1.0f, static_cast<float>(static_cast<int>(width)));
+    if (!m_layoutValid || m_layout.width != width || m_layout.fontKey != fontKey) {
+        ComputeLayout(width, metrics);
+        m_layout.width = width;
+        m_layout.fontKey = fontKey;
+        m_layoutValid = true;
+        ++m_layoutCount;
+    }
+    return m_layout;
+}
+
+void MarkdownDocument::ComputeLayout(float width, const MarkdownMetrics& metrics) {
+    m_layout.lines.clear();
+    m_layout.runs.clear();
+
+    float y = 0.0f;
+    for (uint32_t b = 0; b < m_blocks.size(); ++b) {
+        const MarkdownBlock& block = m_blocks[b];
+        const bool listContinues = b > 0 && block.type == MarkdownBlockType::ListItem &&
+                                   m_blocks[b - 1].type == MarkdownBlockType::ListItem;
+        if (b > 0 && !listContinues) {
+            y += metrics.blockSpacing;
+        }
+
+        const float fontScale = (block.type == MarkdownBlockType::Heading) ? HeadingScale(block.level) : 1.0f;
+        float indent = 0.0f;
+        if (block.type == MarkdownBlockType::ListItem) {
+            indent = metrics.indentWidth * static_cast<float>(block.level + 1);
+        } else if (block.type == MarkdownBlockType::Quote || block.type == MarkdownBlockType::CodeBlock) {
+            indent = metrics.indentWidth * 0.5f;
+        }
+
+        LineBuilder builder(m_layout, b, y, indent, std::max(width - indent, 1.0f), metrics.lineHeight * fontScale,
+                            fontScale);
+        const bool preformatted = block.type == MarkdownBlockType::CodeBlock;
+
+        for (uint32_t s = block.firstSpan; s < block.firstSpan + block.spanCount; ++s) {
+            const MarkdownSpan& span = m_spans[s];
+            const std::string_view text = GetText(span.offset, span.length);
+            auto measure = [&](size_t from, size_t count) {
+                return metrics.measure(metrics.context, text.substr(from, count), span.style, fontScale);
+            };
+
+            size_t position = 0;
+            while (position < text.size()) {
+                if (preformatted && text[position] == '\n') {
+                    builder.NewLine();
+                    ++position;
+                    continue;
+                }
+
+                // A token is the whitespace before a word plus the word
+                size_t wordStart = position;
+                while (wordStart < text.size() && IsSpace(text[wordStart])) {
+                    ++wordStart;
+                }
+                size_t wordEnd = wordStart;
+                while (wordEnd < text.size() && !IsSpace(text[wordEnd]) && !(preformatted && text[wordEnd] == '\n')) {
+                    ++wordEnd;
+                }
+
+                // Wrapped lines do not start with the space that separated the words, but code keeps its indentation
+                size_t from = position;
+                if (builder.IsLineEmpty() && (!preformatted || builder.GetRemaining() < width - indent)) {
+                    from = wordStart;
+                }
+                float tokenWidth = measure(from, wordEnd - from);
+                if (!builder.Fits(tokenWidth) && !builder.IsLineEmpty()) {
+                    builder.NewLine();
+                    from = wordStart;
+                    tokenWidth = measure(from, wordEnd - from);
+                }
+
+                // A word wider than the line is split at the last character that fits
+                while (!builder.Fits(tokenWidth) && wordEnd - from > 1) {
+                    size_t low = from + 1;
+                    size_t high = wordEnd;
+                    while (low + 1 < high) {
+                        const size_t middle = low + (high - low) / 2;
+                        if (builder.Fits(measure(from, middle - from))) {
+                            low = middle;
+                        } else {
+                            high = middle;
+                        }
+                    }
+                    while (low > from + 1 && !IsUtf8Boundary(text, low)) {
+                        --low;
+                    }
+                    while (!IsUtf8Boundary(text, low)) {
+                        ++low;
+                    }
+                    builder.Add(span, span.offset + static_cast<uint32_t>(from), static_cast<uint32_t>(low - from),
+                                measure(from, low - from));
+                    builder.NewLine();
+                    from = low;
+                    tokenWidth = measure(from, wordEnd - from);
+                }
+
+                if (wordEnd > from) {
+                    builder.Add(span, span.offset + static_cast<uint32_t>(from), static_cast<uint32_t>(wordEnd - from),
+                                tokenWidth);
+                }
+                position = wordEnd;
+            }
+        }
+        y = builder.Finish();
+    }
+    m_layout.height = y;
+}
+
+} // namespace MetaImGUI
@@ -0,0 +1,179 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "Sha256.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace MetaImGUI {
+
+namespace {
+constexpr std::array<uint32_t, 8> INITIAL_STATE = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                                   0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+constexpr std::array<uint32_t, 64> ROUND_CONSTANTS = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+uint32_t LoadBigEndian(const uint8_t* bytes) noexcept {
+    return (uint32_t{bytes[0]} << 24) | (uint32_t{bytes[1]} << 16) | (uint32_t{bytes[2]} << 8) | uint32_t{bytes[3]};
+}
+} // namespace
+
+Sha256::Sha256() noexcept {
+    Reset();
+}
+
+void Sha256::Reset() noexcept {
+    m_state = INITIAL_STATE;
+    m_bufferSize = 0;
+    m_byteCount = 0;
+}
+
+void Sha256::Update(std::string_view data) noexcept {
+    const auto* input = reinterpret_cast<const uint8_t*>(data.data());
+    size_t remaining = data.size();
+    m_byteCount += remaining;
+
+    // Top up a partial block left by the previous call
+    if (m_bufferSize > 0) {
+        const size_t take = std::min(remaining, BLOCK_SIZE - m_bufferSize);
+        std::copy_n(input, take, m_buffer.begin() + static_cast<std::ptrdiff_t>(m_bufferSize));
+        m_bufferSize += take;
+        input += take;
+        remaining -= take;
+        if (m_bufferSize < BLOCK_SIZE) {
+            return;
+        }
+        ProcessBlock(m_buffer.data());
+        m_bufferSize = 0;
+    }
+
+    // Whole blocks are hashed straight from the input without copying
+    while (remaining >= BLOCK_SIZE) {
+        ProcessBlock(input);
+        input += BLOCK_SIZE;
+        remaining -= BLOCK_SIZE;
+    }
+
+    std::copy_n(input, remaining, m_buffer.begin());
+    m_bufferSize = remaining;
+}
+
+Sha256::Digest Sha256::Finish() noexcept {
+    const uint64_t bitCount = m_byteCount * 8;
+
+    // Padding: a 1 bit, zeros up to 56 bytes into the last block, then the 64-bit length
+    m_buffer[m_bufferSize++] = 0x80;
+    if (m_bufferSize > BLOCK_SIZE - 8) {
+        std::fill(m_buffer.begin() + static_cast<std::ptrdiff_t>(m_bufferSize), m_buffer.end(), uint8_t{0});
+        ProcessBlock(m_buffer.data());
+        m_bufferSize = 0;
+    }
+    std::fill(m_buffer.begin() + static_cast<std::ptrdiff_t>(m_bufferSize), m_buffer.end() - 8, uint8_t{0});
+    for (size_t i = 0; i < 8; ++i) {
+        m_buffer[BLOCK_SIZE - 1 - i] = static_cast<uint8_t>(bitCount >> (8 * i));
+    }
+    ProcessBlock(m_buffer.data());
+
+    Digest digest{};
+    for (size_t i = 0; i < m_state.size(); ++i) {
+        digest[i * 4] = static_cast<uint8_t>(m_state[i] >> 24);
+        digest[i * 4 + 1] = static_cast<uint8_t>(m_state[i] >> 16);
+        digest[i * 4 + 2] = static_cast<uint8_t>(m_state[i] >> 8);
+        digest[i * 4 + 3] = static_cast<uint8_t>(m_state[i]);
+    }
+
+    Reset();
+    return digest;
+}
+
+void Sha256::ProcessBlock(const uint8_t* block) noexcept {
+    std::array<uint32_t, 64> schedule{};
+    for (size_t i = 0; i < 16; ++i) {
+        schedule[i] = LoadBigEndian(block + i * 4);
+    }
+    for (size_t i = 16; i < 64; ++i) {
+        const uint32_t s0 =
+            std::rotr(schedule[i - 15], 7) ^ std::rotr(schedule[i - 15], 18) ^ (schedule[i - 15] >> 3);
+        const uint32_t s1 = std::rotr(schedule[i - 2], 17) ^ std::rotr(schedule[i - 2], 19) ^ (schedule[i - 2] >> 10);
+        schedule[i] = schedule[i - 16] + s0 + schedule[i - 7] + s1;
+    }
+
+    uint32_t a = m_state[0];
+    uint32_t b = m_state[1];
+    uint32_t c = m_state[2];
+    uint32_t d = m_state[3];
+    uint32_t e = m_state[4];
+    uint32_t f = m_state[5];
+    uint32_t g = m_state[6];
+    uint32_t h = m_state[7];
+
+    for (size_t i = 0; i < 64; ++i) {
+        const uint32_t s1 = std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25);
+        const uint32_t choose = (e & f) ^ (~e & g);
+        const uint32_t temp1 = h + s1 + choose + ROUND_CONSTANTS[i] + schedule[i];
+        const uint32_t s0 = std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22);
+        const uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+        const uint32_t temp2 = s0 + majority;
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+
+    m_state[0] += a;
+    m_state[1] += b;
+    m_state[2] += c;
+    m_state[3] += d;
+    m_state[4] += e;
+    m_state[5] += f;
+    m_state[6] += g;
+    m_state[7] += h;
+}
+
+std::string Sha256::ToHex(const Digest& digest) {
+    constexpr std::string_view HEX_DIGITS = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(DIGEST_SIZE * 2);
+    for (const uint8_t byte : digest) {
+        hex.push_back(HEX_DIGITS[byte >> 4]);
+        hex.push_back(HEX_DIGITS[byte & 0x0f]);
+    }
+    return hex;
+}
+
+std::string Sha256::HashHex(std::string_view data) {
+    Sha256 hash;
+    hash.Update(data);
+    return ToHex(hash.Finish());
+}
+
+} // namespace MetaImGUI
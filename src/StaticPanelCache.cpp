@@ -0,0 +1,69 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "StaticPanelCache.h"
+
+namespace MetaImGUI {
+
+const StaticPanelCache::Geometry* StaticPanelCache::Find(std::string_view id, const StaticPanelKey& key) {
+    const auto it = m_panels.find(id);
+    if (it == m_panels.end() || !(it->second.key == key)) {
+        ++m_misses;
+        return nullptr;
+    }
+    ++m_hits;
+    return &it->second.geometry;
+}
+
+StaticPanelCache::Geometry& StaticPanelCache::Record(std::string_view id, const StaticPanelKey& key) {
+    auto it = m_panels.find(id);
+    if (it == m_panels.end()) {
+        it = m_panels.emplace(std::string(id), Entry{}).first;
+    }
+    it->second.key = key;
+
+    // Keep the vectors' capacity; a panel is usually re-recorded at a similar size
+    Geometry& geometry = it->second.geometry;
+    geometry.vertices.clear();
+    geometry.indices.clear();
+    geometry.width = 0.0f;
+    geometry.height = 0.0f;
+    return geometry;
+}
+
+void StaticPanelCache::Discard(std::string_view id) {
+    if (const auto it = m_panels.find(id); it != m_panels.end()) {
+        m_panels.erase(it);
+    }
+}
+
+void StaticPanelCache::Clear() {
+    m_panels.clear();
+}
+
+uint64_t StaticPanelCache::Hash(const void* data, size_t size, uint64_t seed) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+} // namespace MetaImGUI
@@ -0,0 +1,612 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TaskScheduler.h"
+
+#include "Logger.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace MetaImGUI {
+
+namespace detail {
+
+using Clock = TaskScheduler::Clock;
+
+struct TaskState {
+    TaskScheduler::Function function;
+    TaskPriority priority = TaskPriority::Normal;
+    bool periodic = false;
+    std::atomic<Clock::rep> period{0};
+    std::stop_source stopSource;
+    std::weak_ptr<SchedulerCore> scheduler;
+
+    // Coroutines: a spawned body finishes the task itself; a resumption must run even when
+    // abandoned, otherwise the suspended coroutine would never complete
+    std::function<AsyncTask<void>(std::stop_token)> spawn;
+    bool spawned = false;
+    bool resumesCoroutine = false;
+    std::unique_ptr<std::stop_callback<std::function<void()>>> wakeOnStop;
+
+    // Timer queue membership (protected by SchedulerCore::m_sleepMutex)
+    bool inTimer = false;
+    std::multimap<Clock::time_point, std::shared_ptr<TaskState>>::iterator timerIt;
+
+    // Completion (protected by doneMutex)
+    std::mutex doneMutex;
+    std::condition_variable doneCv;
+    bool done = false;
+
+    void Finish() {
+        // Release captures now rather than when the last handle goes away
+        function = nullptr;
+        spawn = nullptr;
+        {
+            const std::lock_guard<std::mutex> lock(doneMutex);
+            done = true;
+        }
+        doneCv.notify_all();
+    }
+};
+
+class SchedulerCore : public std::enable_shared_from_this<SchedulerCore> {
+public:
+    explicit SchedulerCore(size_t threadCount);
+
+    SchedulerCore(const SchedulerCore&) = delete;
+    SchedulerCore& operator=(const SchedulerCore&) = delete;
+    SchedulerCore(SchedulerCore&&) = delete;
+    SchedulerCore& operator=(SchedulerCore&&) = delete;
+    ~SchedulerCore() = default;
+
+    void Start();
+    bool Enqueue(std::shared_ptr<TaskState> state);
+    bool AddTimer(std::shared_ptr<TaskState> state, Clock::time_point due);
+    void CancelTimer(TaskState* state);
+    void WakeTimer(TaskState* state);
+    bool Resume(std::coroutine_handle<> handle, Clock::duration delay, const std::stop_token& stopToken,
+                TaskPriority priority);
+    void Shutdown();
+
+    [[nodiscard]] size_t GetThreadCount() const {
+        return m_queues.size();
+    }
+
+private:
+    static constexpr size_t PRIORITY_COUNT = 3;
+    static constexpr Clock::rep NO_TIMER = std::numeric_limits<Clock::rep>::max();
+
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::array<std::deque<std::shared_ptr<TaskState>>, PRIORITY_COUNT> tasks;
+        std::shared_ptr<TaskState> running;
+    };
+
+    void WorkerLoop(size_t index);
+    std::shared_ptr<TaskState> FindWork(size_t index);
+    void PromoteDueTimers();
+    void Run(size_t index, const std::shared_ptr<TaskState>& state);
+    void StartSpawned(const std::shared_ptr<TaskState>& state);
+    void PushLocked(std::shared_ptr<TaskState> state, size_t index);
+    void UpdateNextDueLocked();
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+    std::vector<std::jthread> m_threads;
+    std::atomic<size_t> m_nextQueue{0};
+    std::atomic<size_t> m_queued{0};
+    std::atomic<Clock::rep> m_nextDue{NO_TIMER};
+
+    // Lock order: m_sleepMutex before any WorkerQueue::mutex
+    std::mutex m_sleepMutex;
+    std::condition_variable m_sleepCv;
+    std::multimap<Clock::time_point, std::shared_ptr<TaskState>> m_timers;
+    std::unordered_set<std::shared_ptr<TaskState>> m_suspended; // Spawned coroutines in flight
+    bool m_stopping = false;
+};
+
+namespace {
+// Lets a worker push follow-up work onto its own queue
+thread_local const SchedulerCore* t_workerOwner = nullptr;
+thread_local size_t t_workerIndex = 0;
+
+void CancelWithoutRunning(const std::shared_ptr<TaskState>& state) {
+    state->stopSource.request_stop();
+    state->Finish();
+}
+
+void RunInline(const std::shared_ptr<TaskState>& state) {
+    try {
+        state->function(state->stopSource.get_token());
+    } catch (const std::exception& e) {
+        LOG_ERROR("Task Scheduler: Task threw exception: {}", e.what());
+    } catch (...) {
+        LOG_ERROR("Task Scheduler: Task threw unknown exception");
+    }
+    state->Finish();
+}
+} // namespace
+
+SchedulerCore::SchedulerCore(size_t threadCount) {
+    m_queues.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+}
+
+void SchedulerCore::Start() {
+    m_threads.reserve(m_queues.size());
+    for (size_t i = 0; i < m_queues.size(); ++i) {
+        m_threads.emplace_back([this, i] { WorkerLoop(i); });
+    }
+}
+
+void SchedulerCore::PushLocked(std::shared_ptr<TaskState> state, size_t index) {
+    // Caller holds m_sleepMutex
+    WorkerQueue& queue = *m_queues[index];
+    const std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks[static_cast<size_t>(state->priority)].push_back(std::move(state));
+    m_queued.fetch_add(1, std::memory_order_release);
+}
+
+bool SchedulerCore::Enqueue(std::shared_ptr<TaskState> state) {
+    const size_t index =
+        (t_workerOwner == this) ? t_workerIndex : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+    {
+        const std::lock_guard<std::mutex> lock(m_sleepMutex);
+        if (m_stopping) {
+            CancelWithoutRunning(state);
+            return false;
+        }
+        PushLocked(std::move(state), index);
+    }
+    m_sleepCv.notify_one();
+    return true;
+}
+
+bool SchedulerCore::AddTimer(std::shared_ptr<TaskState> state, Clock::time_point due) {
+    {
+        const std::lock_guard<std::mutex> lock(m_sleepMutex);
+        // Checked under the lock so a Cancel racing with a periodic reschedule is never lost
+        if (m_stopping || state->stopSource.stop_requested()) {
+            CancelWithoutRunning(state);
+            return false;
+        }
+        TaskState* raw = state.get();
+        raw->timerIt = m_timers.emplace(due, std::move(state));
+        raw->inTimer = true;
+        UpdateNextDueLocked();
+    }
+    // A sleeping worker may need to wake earlier than it planned
+    m_sleepCv.notify_one();
+    return true;
+}
+
+void SchedulerCore::CancelTimer(TaskState* state) {
+    std::shared_ptr<TaskState> removed;
+    {
+        const std::lock_guard<std::mutex> lock(m_sleepMutex);
+        if (!state->inTimer) {
+            return; // Queued or running: the worker finishes it
+        }
+        removed = std::move(state->timerIt->second);
+        m_timers.erase(state->timerIt);
+        state->inTimer = false;
+        UpdateNextDueLocked();
+    }
+    removed->Finish();
+}
+
+void SchedulerCore::WakeTimer(TaskState* state) {
+    {
+        const std::lock_guard<std::mutex> lock(m_sleepMutex);
+        if (!state->inTimer) {
+            return; // Already due, or the scheduler is shutting down
+        }
+        std::shared_ptr<TaskState> owned = std::move(state->timerIt->second);
+        m_timers.erase(state->timerIt);
+        state->inTimer = false;
+        UpdateNextDueLocked();
+        PushLocked(std::move(owned), m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size());
+    }
+    m_sleepCv.notify_one();
+}
+
+bool SchedulerCore::Resume(std::coroutine_handle<> handle, Clock::duration delay, const std::stop_token& stopToken,
+                           TaskPriority priority) {
+    auto state = std::make_shared<TaskState>();
+    state->function = [handle](const std::stop_token&) { handle.resume(); };
+    state->priority = priority;
+    state->resumesCoroutine = true;
+
+    if (delay <= Clock::duration::zero()) {
+        return Enqueue(std::move(state));
+    }
+    if (!AddTimer(state, Clock::now() + delay)) {
+        return false;
+    }
+
+    // Registered after parking: a stop requested in between fires the callback immediately.
+    // The callback lives in the state, so the raw pointer is valid whenever it runs.
+    if (stopToken.stop_possible()) {
+        state->wakeOnStop = std::make_unique<std::stop_callback<std::function<void()>>>(
+            stopToken, [core = weak_from_this(), raw = state.get()] {
+                if (const auto self = core.lock()) {
+                    self->WakeTimer(raw);
+                }
+            });
+    }
+    return true;
+}
+
+void SchedulerCore::UpdateNextDueLocked() {
+    const Clock::rep next = m_timers.empty() ? NO_TIMER : m_timers.begin()->first.time_since_epoch().count();
+    m_nextDue.store(next, std::memory_order_relaxed);
+}
+
+void SchedulerCore::PromoteDueTimers() {
+    const auto now = Clock::now();
+    if (now.time_since_epoch().count() < m_nextDue.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    bool promoted = false;
+    {
+        const std::lock_guard<std::mutex> lock(m_sleepMutex);
+        while (!m_timers.empty() && m_timers.begin()->first <= now) {
+            std::shared_ptr<TaskState> state = std::move(m_timers.begin()->second);
+            m_timers.erase(m_timers.begin());
+            state->inTimer = false;
+            PushLocked(std::move(state), m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size());
+            promoted = true;
+        }
+        UpdateNextDueLocked();
+    }
+    if (promoted) {
+        m_sleepCv.notify_all();
+    }
+}
+
+std::shared_ptr<TaskState> SchedulerCore::FindWork(size_t index) {
+    if (m_queued.load(std::memory_order_acquire) == 0) {
+        return nullptr;
+    }
+
+    // Highest priority first across all queues; own queue FIFO, steal from the back of others
+    const size_t count = m_queues.size();
+    for (size_t priority = 0; priority < PRIORITY_COUNT; ++priority) {
+        for (size_t offset = 0; offset < count; ++offset) {
+            WorkerQueue& queue = *m_queues[(index + offset) % count];
+            const std::lock_guard<std::mutex> lock(queue.mutex);
+            auto& tasks = queue.tasks[priority];
+            if (tasks.empty()) {
+                continue;
+            }
+
+            std::shared_ptr<TaskState> state;
+            if (offset == 0) {
+                state = std::move(tasks.front());
+                tasks.pop_front();
+            } else {
+                state = std::move(tasks.back());
+                tasks.pop_back();
+            }
+            m_queued.fetch_sub(1, std::memory_order_relaxed);
+            return state;
+        }
+    }
+    return nullptr;
+}
+
+void SchedulerCore::StartSpawned(const std::shared_ptr<TaskState>& state) {
+    AsyncTask<void> task;
+    try {
+        task = state->spawn(state->stopSource.get_token());
+    } catch (const std::exception& e) {
+        LOG_ERROR("Task Scheduler: Coroutine factory threw exception: {}", e.what());
+    } catch (...) {
+        LOG_ERROR("Task Scheduler: Coroutine factory threw unknown exception");
+    }
+    if (!task.Valid()) {
+        state->Finish();
+        return;
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_suspended.insert(state);
+    }
+
+    // Runs until the first suspension here; completes on whichever thread resumes it last
+    std::move(task).Start([core = weak_from_this(), state](const std::exception_ptr& exception) {
+        if (exception) {
+            try {
+                std::rethrow_exception(exception);
+            } catch (const std::exception& e) {
+                LOG_ERROR("Task Scheduler: Coroutine threw exception: {}", e.what());
+            } catch (...) {
+                LOG_ERROR("Task Scheduler: Coroutine threw unknown exception");
+            }
+        }
+        if (const auto self = core.lock()) {
+            const std::lock_guard<std::mutex> lock(self->m_sleepMutex);
+            self->m_suspended.erase(state);
+        }
+        state->Finish();
+    });
+}
+
+void SchedulerCore::Run(size_t index, const std::shared_ptr<TaskState>& state) {
+    if (state->stopSource.stop_requested() && !state->resumesCoroutine) {
+        state->Finish();
+        return;
+    }
+
+    if (state->spawned) {
+        StartSpawned(state);
+        return;
+    }
+
+    WorkerQueue& queue = *m_queues[index];
+    {
+        const std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.running = state;
+    }
+
+    try {
+        state->function(state->stopSource.get_token());
+    } catch (const std::exception& e) {
+        LOG_ERROR("Task Scheduler: Task threw exception: {}", e.what());
+    } catch (...) {
+        LOG_ERROR("Task Scheduler: Task threw unknown exception");
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.running.reset();
+    }
+
+    if (state->periodic && !state->stopSource.stop_requested()) {
+        const Clock::duration period(state->period.load(std::memory_order_relaxed));
+        AddTimer(state, Clock::now() + period);
+        return;
+    }
+    state->Finish();
+}
+
+void SchedulerCore::WorkerLoop(size_t index) {
+    t_workerOwner = this;
+    t_workerIndex = index;
+
+    for (;;) {
+        PromoteDueTimers();
+        if (const auto state = FindWork(index)) {
+            Run(index, state);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        if (m_stopping) {
+            return;
+        }
+        if (m_queued.load(std::memory_order_acquire) > 0) {
+            continue;
+        }
+        if (m_timers.empty()) {
+            m_sleepCv.wait(lock);
+        } else {
+            // Copy the deadline: the node may be erased while the lock is released
+            const Clock::time_point due = m_timers.begin()->first;
+            m_sleepCv.wait_until(lock, due);
+        }
+    }
+}
+
+void SchedulerCore::Shutdown() {
+    std::vector<std::shared_ptr<TaskState>> pending;
+    std::vector<std::jthread> threads;
+    {
+        const std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_stopping = true;
+
+        for (auto& [due, state] : m_timers) {
+            state->inTimer = false;
+            pending.push_back(std::move(state));
+        }
+        m_timers.clear();
+        UpdateNextDueLocked();
+
+        for (auto& queue : m_queues) {
+            const std::lock_guard<std::mutex> queueLock(queue->mutex);
+            for (auto& tasks : queue->tasks) {
+                std::move(tasks.begin(), tasks.end(), std::back_inserter(pending));
+                tasks.clear();
+            }
+            if (queue->running) {
+                queue->running->stopSource.request_stop();
+            }
+        }
+        m_queued.store(0, std::memory_order_relaxed);
+        threads.swap(m_threads);
+
+        for (const auto& state : m_suspended) {
+            state->stopSource.request_stop();
+        }
+    }
+    m_sleepCv.notify_all();
+
+    // Suspended coroutines are resumed here rather than leaked; everything else is dropped
+    for (const auto& state : pending) {
+        if (state->resumesCoroutine) {
+            RunInline(state);
+        } else {
+            CancelWithoutRunning(state);
+        }
+    }
+
+    if (t_workerOwner == this) {
+        LOG_ERROR("Task Scheduler: Shutdown called from a worker thread; workers left detached");
+        for (auto& thread : threads) {
+            thread.detach();
+        }
+        return;
+    }
+    threads.clear(); // Joins
+}
+
+} // namespace detail
+
+// TaskHandle
+
+void TaskHandle::Cancel() const {
+    if (!m_state) {
+        return;
+    }
+    m_state->stopSource.request_stop();
+
+    // A task parked in the timer queue would otherwise only notice when it comes due
+    if (const auto core = m_state->scheduler.lock()) {
+        core->CancelTimer(m_state.get());
+    }
+}
+
+void TaskHandle::Wait() const {
+    if (!m_state) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(m_state->doneMutex);
+    m_state->doneCv.wait(lock, [this] { return m_state->done; });
+}
+
+bool TaskHandle::IsDone() const {
+    if (!m_state) {
+        return true;
+    }
+    const std::lock_guard<std::mutex> lock(m_state->doneMutex);
+    return m_state->done;
+}
+
+void TaskHandle::SetPeriod(std::chrono::steady_clock::duration period) const {
+    if (m_state) {
+        m_state->period.store((std::max)(period, TaskScheduler::Clock::duration::zero()).count(),
+                              std::memory_order_relaxed);
+    }
+}
+
+// TaskScheduler
+
+namespace {
+std::atomic<size_t> g_configuredThreadCount{0};
+
+std::shared_ptr<detail::TaskState> MakeState(const std::shared_ptr<detail::SchedulerCore>& core,
+                                             TaskScheduler::Function function, TaskPriority priority) {
+    auto state = std::make_shared<detail::TaskState>();
+    state->function = std::move(function);
+    state->priority = priority;
+    state->scheduler = core;
+    return state;
+}
+} // namespace
+
+TaskScheduler::TaskScheduler(size_t threadCount)
+    : m_core(std::make_shared<detail::SchedulerCore>(threadCount == 0 ? DefaultThreadCount() : threadCount)) {
+    m_core->Start();
+}
+
+TaskScheduler::~TaskScheduler() {
+    Shutdown();
+}
+
+TaskScheduler& TaskScheduler::Instance() {
+    static TaskScheduler instance(g_configuredThreadCount.load());
+    return instance;
+}
+
+void TaskScheduler::Configure(size_t threadCount) {
+    g_configuredThreadCount = threadCount;
+}
+
+size_t TaskScheduler::DefaultThreadCount() {
+    const size_t hardware = std::thread::hardware_concurrency();
+    return std::clamp<size_t>((hardware > 1) ? hardware - 1 : 1, 2, 8);
+}
+
+TaskHandle TaskScheduler::Submit(Function function, TaskPriority priority) {
+    auto state = MakeState(m_core, std::move(function), priority);
+    m_core->Enqueue(state);
+    return TaskHandle(std::move(state));
+}
+
+TaskHandle TaskScheduler::ScheduleAfter(Clock::duration delay, Function function, TaskPriority priority) {
+    auto state = MakeState(m_core, std::move(function), priority);
+    m_core->AddTimer(state, Clock::now() + delay);
+    return TaskHandle(std::move(state));
+}
+
+TaskHandle TaskScheduler::Spawn(std::function<AsyncTask<void>(std::stop_token)> body, TaskPriority priority) {
+    auto state = MakeState(m_core, nullptr, priority);
+    state->spawn = std::move(body);
+    state->spawned = true;
+    m_core->Enqueue(state);
+    return TaskHandle(std::move(state));
+}
+
+TaskHandle TaskScheduler::SchedulePeriodic(Clock::duration period, Function function, TaskPriority priority,
+                                           Clock::duration initialDelay) {
+    auto state = MakeState(m_core, std::move(function), priority);
+    state->periodic = true;
+    state->period = (std::max)(period, Clock::duration::zero()).count();
+
+    if (initialDelay <= Clock::duration::zero()) {
+        m_core->Enqueue(state);
+    } else {
+        m_core->AddTimer(state, Clock::now() + initialDelay);
+    }
+    return TaskHandle(std::move(state));
+}
+
+bool TaskScheduler::Resume(std::coroutine_handle<> handle, Clock::duration delay, std::stop_token stopToken,
+                           TaskPriority priority) {
+    return m_core->Resume(handle, delay, stopToken, priority);
+}
+
+bool TaskScheduler::IsWorkerThread() const {
+    return detail::t_workerOwner == m_core.get();
+}
+
+void TaskScheduler::Shutdown() {
+    m_core->Shutdown();
+}
+
+size_t TaskScheduler::GetThreadCount() const {
+    return m_core->GetThreadCount();
+}
+
+} // namespace MetaImGUI
@@ -0,0 +1,233 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TrackHistory.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace MetaImGUI {
+
+namespace {
+// The open bucket of a level contributes its current extremes plus the newest sample, so
+// the trail always ends at the latest position without emitting the bucket's raw samples
+size_t OpenBucketTail(size_t minIndex, size_t maxIndex, size_t lastIndex, std::array<size_t, 3>& tail) {
+    tail = {minIndex, maxIndex, lastIndex};
+    std::sort(tail.begin(), tail.end());
+    return static_cast<size_t>(std::unique(tail.begin(), tail.end()) - tail.begin());
+}
+} // namespace
+
+TrackHistory::TrackHistory(size_t capacity) : m_capacity((std::max)(capacity, size_t{1})) {
+    // Stop adding levels once a single bucket would cover the whole history
+    for (size_t bucketSize = LEVEL_FACTOR; bucketSize <= m_capacity; bucketSize *= LEVEL_FACTOR) {
+        Level level;
+        level.bucketSize = bucketSize;
+        m_levels.push_back(std::move(level));
+    }
+}
+
+void TrackHistory::Append(double longitude, double latitude, long timestamp) {
+    m_longitudes.push_back(longitude);
+    m_latitudes.push_back(latitude);
+    m_timestamps.push_back(timestamp);
+
+    // Trim in batches so the erase and pyramid rebuild are amortized over many appends
+    const size_t slack = (std::max)(m_capacity / 4, size_t{1});
+    if (m_longitudes.size() > m_capacity + slack) {
+        const auto drop = static_cast<std::ptrdiff_t>(m_longitudes.size() - m_capacity);
+        m_longitudes.erase(m_longitudes.begin(), m_longitudes.begin() + drop);
+        m_latitudes.erase(m_latitudes.begin(), m_latitudes.begin() + drop);
+        m_timestamps.erase(m_timestamps.begin(), m_timestamps.begin() + drop);
+        RebuildLevels();
+        return;
+    }
+
+    IndexSample(m_longitudes.size() - 1);
+}
+
+void TrackHistory::Clear() {
+    m_longitudes.clear();
+    m_latitudes.clear();
+    m_timestamps.clear();
+    RebuildLevels();
+}
+
+void TrackHistory::IndexSample(size_t index) {
+    if (index == 0) {
+        m_segmentStarts.assign(1, 0);
+        for (auto& level : m_levels) {
+            level.segmentStarts.assign(1, 0);
+            level.bucketStart = level.minIndex = level.maxIndex = 0;
+        }
+        return;
+    }
+
+    // A large longitude jump means the track wrapped across the antimeridian: start a new
+    // segment and close every open bucket so no decimated point bridges the wrap
+    const bool wrapped = std::abs(m_longitudes[index] - m_longitudes[index - 1]) > WRAP_THRESHOLD;
+    if (wrapped) {
+        m_segmentStarts.push_back(index);
+    }
+
+    for (auto& level : m_levels) {
+        if (wrapped) {
+            CloseBucket(level, index);
+            level.segmentStarts.push_back(level.indices.size());
+            continue;
+        }
+
+        if (index - level.bucketStart == level.bucketSize) {
+            CloseBucket(level, index);
+            continue;
+        }
+
+        if (m_latitudes[index] < m_latitudes[level.minIndex]) {
+            level.minIndex = index;
+        }
+        if (m_latitudes[index] > m_latitudes[level.maxIndex]) {
+            level.maxIndex = index;
+        }
+    }
+}
+
+void TrackHistory::CloseBucket(Level& level, size_t nextStart) {
+    // Keep the bucket's extremes in sample order
+    const size_t first = (std::min)(level.minIndex, level.maxIndex);
+    const size_t second = (std::max)(level.minIndex, level.maxIndex);
+    level.indices.push_back(static_cast<uint32_t>(first));
+    if (second != first) {
+        level.indices.push_back(static_cast<uint32_t>(second));
+    }
+    level.bucketStart = level.minIndex = level.maxIndex = nextStart;
+}
+
+void TrackHistory::RebuildLevels() {
+    m_segmentStarts.clear();
+    for (auto& level : m_levels) {
+        level.indices.clear();
+        level.segmentStarts.clear();
+        level.bucketStart = level.minIndex = level.maxIndex = 0;
+    }
+    for (size_t i = 0; i < m_longitudes.size(); ++i) {
+        IndexSample(i);
+    }
+}
+
+template <typename Visitor>
+void TrackHistory::ForEachLevelIndex(size_t level, Visitor&& visit) const {
+    const size_t count = m_longitudes.size();
+    if (count == 0) {
+        return;
+    }
+
+    if (level == 0 || level > m_levels.size()) {
+        for (size_t i = 0; i < count; ++i) {
+            visit(i);
+        }
+        return;
+    }
+
+    const Level& lod = m_levels[level - 1];
+    for (const uint32_t index : lod.indices) {
+        visit(index);
+    }
+
+    std::array<size_t, 3> tail{};
+    const size_t tailCount = OpenBucketTail(lod.minIndex, lod.maxIndex, count - 1, tail);
+    for (size_t i = 0; i < tailCount; ++i) {
+        visit(tail[i]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+}
+
+size_t TrackHistory::GetLevelPointCount(size_t level) const {
+    const size_t count = m_longitudes.size();
+    if (count == 0 || level == 0 || level > m_levels.size()) {
+        return count;
+    }
+
+    // O(1): closed buckets plus the open bucket's tail points
+    const Level& lod = m_levels[level - 1];
+    std::array<size_t, 3> tail{};
+    return lod.indices.size() + OpenBucketTail(lod.minIndex, lod.maxIndex, count - 1, tail);
+}
+
+size_t TrackHistory::SelectLevel(size_t maxPoints) const {
+    if (m_longitudes.size() <= maxPoints) {
+        return 0;
+    }
+    for (size_t level = 1; level < GetLevelCount(); ++level) {
+        if (GetLevelPointCount(level) <= maxPoints) {
+            return level;
+        }
+    }
+    return GetLevelCount() - 1;
+}
+
+template <typename DoubleVector, typename SizeVector>
+void TrackHistory::CopyLevelInto(size_t level, DoubleVector& latitudes, DoubleVector& longitudes,
+                                 SizeVector* segmentStarts) const {
+    latitudes.clear();
+    longitudes.clear();
+    if (segmentStarts != nullptr) {
+        segmentStarts->clear();
+    }
+
+    if (level == 0) {
+        latitudes.assign(m_latitudes.begin(), m_latitudes.end());
+        longitudes.assign(m_longitudes.begin(), m_longitudes.end());
+    } else {
+        const size_t points = GetLevelPointCount(level);
+        latitudes.reserve(points);
+        longitudes.reserve(points);
+        ForEachLevelIndex(level, [&](size_t index) {
+            latitudes.push_back(m_latitudes[index]);
+            longitudes.push_back(m_longitudes[index]);
+        });
+    }
+
+    if (segmentStarts == nullptr || m_longitudes.empty()) {
+        return;
+    }
+
+    // The open bucket's tail always belongs to the last segment, so the stored offsets
+    // line up with the copied points as they are
+    if (level == 0 || level > m_levels.size()) {
+        segmentStarts->assign(m_segmentStarts.begin(), m_segmentStarts.end());
+    } else {
+        const auto& starts = m_levels[level - 1].segmentStarts;
+        segmentStarts->assign(starts.begin(), starts.end());
+    }
+}
+
+void TrackHistory::CopyLevel(size_t level, std::vector<double>& latitudes, std::vector<double>& longitudes) const {
+    CopyLevelInto(level, latitudes, longitudes, static_cast<std::vector<size_t>*>(nullptr));
+}
+
+void TrackHistory::CopyLevel(size_t level, std::vector<double>& latitudes, std::vector<double>& longitudes,
+                             std::vector<size_t>& segmentStarts) const {
+    CopyLevelInto(level, latitudes, longitudes, &segmentStarts);
+}
+
+void TrackHistory::CopyLevel(size_t level, std::pmr::vector<double>& latitudes, std::pmr::vector<double>& longitudes,
+                             std::pmr::vector<size_t>& segmentStarts) const {
+    CopyLevelInto(level, latitudes, longitudes, &segmentStarts);
+}
+
+} // namespace MetaImGUI
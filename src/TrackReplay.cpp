@@ -0,0 +1,143 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TrackReplay.h"
+
+#include "Logger.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <string>
+
+namespace MetaImGUI {
+
+bool TrackReplay::Load(const std::filesystem::path& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        LOG_ERROR("Track Replay: Failed to open session file: {}", path.string());
+        return false;
+    }
+
+    const bool loaded = Load(file);
+    LOG_INFO("Track Replay: Loaded {} samples from {}", m_samples.size(), path.string());
+    return loaded;
+}
+
+bool TrackReplay::Load(std::istream& input) {
+    m_samples.clear();
+    m_timestamps.clear();
+
+    std::string line;
+    size_t skipped = 0;
+    while (std::getline(input, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line.front() == '#') {
+            continue;
+        }
+
+        ISSPosition position;
+        if (line.front() == '{') {
+            position = ISSTracker::ParseJSON(line);
+        } else if (!ParseHistoryRow(line, position)) {
+            position.valid = false;
+        }
+
+        if (position.valid) {
+            m_samples.push_back(position);
+        } else {
+            ++skipped;
+        }
+    }
+
+    if (skipped > 0) {
+        LOG_WARNING("Track Replay: Skipped {} unreadable lines", skipped);
+    }
+
+    // Index once so playback and scrubbing never touch the input again
+    std::stable_sort(m_samples.begin(), m_samples.end(),
+                     [](const ISSPosition& a, const ISSPosition& b) { return a.timestamp < b.timestamp; });
+    m_timestamps.reserve(m_samples.size());
+    for (const auto& sample : m_samples) {
+        m_timestamps.push_back(sample.timestamp);
+    }
+
+    return !m_samples.empty();
+}
+
+long TrackReplay::GetStartTime() const {
+    return m_timestamps.empty() ? 0 : m_timestamps.front();
+}
+
+long TrackReplay::GetEndTime() const {
+    return m_timestamps.empty() ? 0 : m_timestamps.back();
+}
+
+size_t TrackReplay::CountUpTo(long timestamp) const {
+    return static_cast<size_t>(std::upper_bound(m_timestamps.begin(), m_timestamps.end(), timestamp) -
+                               m_timestamps.begin());
+}
+
+bool TrackReplay::ParseHistoryRow(const std::string& line, ISSPosition& position) {
+    // timestamp,latitude,longitude[,altitude,velocity]
+    std::array<double, 5> fields{};
+    size_t fieldCount = 0;
+    const char* cursor = line.c_str();
+
+    while (fieldCount < fields.size()) {
+        char* end = nullptr;
+        const double value = std::strtod(cursor, &end);
+        if (end == cursor) {
+            return false;
+        }
+        fields.at(fieldCount++) = value;
+
+        while (*end == ' ' || *end == '\t') {
+            ++end;
+        }
+        if (*end == '\0') {
+            break;
+        }
+        if (*end != ',' || fieldCount == fields.size()) {
+            return false; // Bad separator, or more fields than a row has
+        }
+        cursor = end + 1;
+    }
+
+    // strtod accepts "nan", "inf" and huge exponents, none of which convert to a long
+    constexpr double TIMESTAMP_LIMIT = -static_cast<double>(std::numeric_limits<long>::min());
+    if (fieldCount < 3 || !std::isfinite(fields[0]) || fields[0] < -TIMESTAMP_LIMIT || fields[0] >= TIMESTAMP_LIMIT) {
+        return false;
+    }
+
+    position.timestamp = static_cast<long>(fields[0]);
+    position.latitude = fields[1];
+    position.longitude = fields[2];
+    position.altitude = fields[3];
+    position.velocity = fields[4];
+    position.valid = position.latitude >= -90.0 && position.latitude <= 90.0 && position.longitude >= -180.0 &&
+                     position.longitude <= 180.0;
+    return position.valid;
+}
+
+} // namespace MetaImGUI
@@ -0,0 +1,97 @@
+/*
+    MetaImGUI
+    Copyright (C) 2026  A P Nicholson
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TrackerMetrics.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace MetaImGUI {
+
+double LatencyHistogram::Snapshot::Mean() const {
+    return (count == 0) ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+}
+
+uint64_t LatencyHistogram::Snapshot::Percentile(double percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+
+    // Rank of the requested sample, 1-based
+    const double clamped = std::clamp(percentile, 0.0, 100.0);
+    const auto rank = (std::max)(static_cast<uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(count))),
+                                 uint64_t{1});
+
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+        seen += buckets[bucket];
+        if (seen >= rank) {
+            // The last bucket also holds everything beyond its nominal range
+            return (bucket + 1 == BUCKET_COUNT) ? max : (std::min)(BucketUpperBound(bucket), max);
+        }
+    }
+    return max;
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::GetSnapshot() const {
+    // Count is derived from the buckets so percentiles always agree with it
+    Snapshot snapshot;
+    for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+        snapshot.buckets[bucket] = m_buckets[bucket].load(std::memory_order_relaxed);
+        snapshot.count += snapshot.buckets[bucket];
+    }
+    snapshot.sum = m_sum.load(std::memory_order_relaxed);
+    snapshot.max = m_max.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+void LatencyHistogram::Reset() noexcept {
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_sum.store(0, std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+TrackerMetrics::Snapshot TrackerMetrics::GetSnapshot() const {
+    Snapshot snapshot;
+    snapshot.fetchLatencyUs = fetchLatencyUs.GetSnapshot();
+    snapshot.parseTimeUs = parseTimeUs.GetSnapshot();
+    snapshot.callbackDurationUs = callbackDurationUs.GetSnapshot();
+    snapshot.sampleAgeMs = sampleAgeMs.GetSnapshot();
+    snapshot.bytesReceived = bytesReceived.load(std::memory_order_relaxed);
+    snapshot.fetchSuccesses = fetchSuccesses.load(std::memory_order_relaxed);
+    snapshot.fetchFailures = fetchFailures.load(std::memory_order_relaxed);
+    snapshot.parseFailures = parseFailures.load(std::memory_order_relaxed);
+    snapshot.callbacksDropped = callbacksDropped.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+void TrackerMetrics::Reset() noexcept {
+    fetchLatencyUs.Reset();
+    parseTimeUs.Reset();
+    callbackDurationUs.Reset();
+    sampleAgeMs.Reset();
+    bytesReceived.store(0, std::memory_order_relaxed);
+    fetchSuccesses.store(0, std::memory_order_relaxed);
+    fetchFailures.store(0, std::memory_order_relaxed);
+    parseFailures.store(0, std::memory_order_relaxed);
+    callbacksDropped.store(0, std::memory_order_relaxed);
+}
+
+} // namespace MetaImGUI
@@ -18,6 +18,8 @@
 
 #include "UIRenderer.h"
 
+#include "AllocationTracker.h"
+#include "FrameArena.h"
 #include "ISSTracker.h"
 #include "Localization.h"
 #include "Logger.h"
@@ -31,9 +33,18 @@
 #include <imgui_impl_opengl3.h>
 #include <implot.h>
 
+#include <algorithm>
 #include <array>
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
+#include <filesystem>
+#include <memory_resource>
+#include <string_view>
 
 namespace MetaImGUI {
 
@@ -50,11 +61,19 @@ constexpr float STATUS_BAR_HEIGHT = 28.0f;
 constexpr float ABOUT_WINDOW_WIDTH = 450.0f;
 constexpr float ABOUT_WINDOW_HEIGHT = 350.0f;
 constexpr float UPDATE_WINDOW_WIDTH = 450.0f;
-constexpr float UPDATE_WINDOW_HEIGHT = 300.0f;
+constexpr float UPDATE_WINDOW_HEIGHT = 360.0f;
 constexpr float RELEASE_NOTES_HEIGHT = 120.0f;
 
+// Release notes markdown (bullet radius is a fraction of the font size; no italic font is
+// loaded, so emphasis is drawn dimmed)
+constexpr float MARKDOWN_BULLET_RADIUS = 0.18f;
+constexpr float MARKDOWN_QUOTE_BAR_WIDTH = 3.0f;
+constexpr float MARKDOWN_MARKER_GAP = 4.0f;
+constexpr float MARKDOWN_EMPHASIS_ALPHA = 0.75f;
+
 // Button sizes
 constexpr float BUTTON_OPEN_RELEASE_WIDTH = 200.0f;
+constexpr float BUTTON_DOWNLOAD_UPDATE_WIDTH = 200.0f;
 constexpr float BUTTON_REMIND_LATER_WIDTH = 150.0f;
 constexpr float BUTTON_CLOSE_WIDTH = 75.0f;
 constexpr float BUTTON_HEIGHT = 30.0f;
@@ -71,8 +90,108 @@ constexpr float ITEM_SPACING_X = 12.0f;
 constexpr float ITEM_SPACING_Y = 0.0f;
 constexpr float VERTICAL_SPACING_SMALL = 10.0f;
 constexpr float TEXT_WRAP_POS_MULTIPLIER = 35.0f;
+
+// Orbit trail level of detail: min/max decimation needs two points per pixel column
+constexpr float ORBIT_TRAIL_POINTS_PER_PIXEL = 2.0f;
+constexpr double ORBIT_FULL_LONGITUDE_SPAN = 360.0;
+
+// Replay controls
+constexpr float REPLAY_PATH_WIDTH = 300.0f;
+constexpr float REPLAY_SPEED_WIDTH = 150.0f;
+
+// Tracker metrics: live fixes older than this are shown as stale (API polled every 5 s)
+constexpr int64_t SAMPLE_AGE_SLO_MS = 15000;
+
+// Performance overlay, anchored to the top right corner below the menu bar
+constexpr float OVERLAY_MARGIN = 10.0f;
+constexpr float OVERLAY_BG_ALPHA = 0.75f;
 } // namespace UILayout
 
+namespace {
+// Everything a static panel's vertices depend on, gathered before it is drawn
+StaticPanelKey MakeStaticPanelKey(const ImDrawList* drawList) {
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const ImVec2 available = ImGui::GetContentRegionAvail();
+    const ImVec2 clipMin = drawList->GetClipRectMin();
+    const ImVec2 clipMax = drawList->GetClipRectMax();
+
+    StaticPanelKey key;
+    key.rect = {origin.x, origin.y, available.x, available.y};
+    key.clipRect = {clipMin.x, clipMin.y, clipMax.x, clipMax.y};
+
+    const ImGuiStyle& style = ImGui::GetStyle();
+    key.styleHash = StaticPanelCache::Hash(static_cast<const void*>(style.Colors), sizeof(style.Colors));
+    key.styleHash = StaticPanelCache::Hash(&style.Alpha, sizeof(style.Alpha), key.styleHash);
+
+    // Glyph UVs move when the atlas texture is recreated or resized
+    const ImFont* font = ImGui::GetFont();
+    const float fontSize = ImGui::GetFontSize();
+    const ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    const ImTextureData* texture = atlas->TexData;
+    const std::array<uintptr_t, 4> fontState = {reinterpret_cast<uintptr_t>(font),
+                                                reinterpret_cast<uintptr_t>(texture),
+                                                texture != nullptr ? static_cast<uintptr_t>(texture->Width) : 0,
+                                                texture != nullptr ? static_cast<uintptr_t>(texture->Height) : 0};
+    key.fontHash = StaticPanelCache::Hash(fontState.data(), sizeof(fontState));
+    key.fontHash = StaticPanelCache::Hash(&fontSize, sizeof(fontSize), key.fontHash);
+
+    const std::string& language = Localization::Instance().GetCurrentLanguage();
+    key.languageHash = StaticPanelCache::Hash(language.data(), language.size());
+    return key;
+}
+
+// Hash of everything the OpenGL backend would draw. forcePresent is set for frames that
+// must be submitted even if unchanged: pending texture uploads are only processed by
+// submitting, and user callbacks may draw anything.
+uint64_t FingerprintDrawData(const ImDrawData* drawData, bool& forcePresent) {
+    FrameHasher hasher;
+    if (drawData == nullptr || !drawData->Valid) {
+        forcePresent = true;
+        return hasher.Finish();
+    }
+
+    hasher.AddValue(drawData->DisplayPos);
+    hasher.AddValue(drawData->DisplaySize);
+    hasher.AddValue(drawData->FramebufferScale);
+    if (drawData->Textures != nullptr) {
+        for (const ImTextureData* texture : *drawData->Textures) {
+            forcePresent = forcePresent || texture->Status != ImTextureStatus_OK;
+        }
+    }
+
+    for (const ImDrawList* list : drawData->CmdLists) {
+        hasher.Add(list->VtxBuffer.Data, static_cast<size_t>(list->VtxBuffer.Size) * sizeof(ImDrawVert));
+        hasher.Add(list->IdxBuffer.Data, static_cast<size_t>(list->IdxBuffer.Size) * sizeof(ImDrawIdx));
+        for (const ImDrawCmd& command : list->CmdBuffer) {
+            forcePresent = forcePresent || command.UserCallback != nullptr;
+            hasher.AddValue(command.ClipRect);
+            hasher.AddValue(command.TexRef._TexData);
+            hasher.AddValue(command.TexRef._TexID);
+            hasher.AddValue(command.VtxOffset);
+            hasher.AddValue(command.IdxOffset);
+            hasher.AddValue(command.ElemCount);
+        }
+    }
+    return hasher.Finish();
+}
+
+// The stock backend issues one draw call per command with geometry
+DrawCallStats CountDrawCommands(const ImDrawData* drawData) {
+    DrawCallStats stats;
+    stats.vertices = static_cast<size_t>(drawData->TotalVtxCount);
+    stats.indices = static_cast<size_t>(drawData->TotalIdxCount);
+    for (const ImDrawList* list : drawData->CmdLists) {
+        for (const ImDrawCmd& command : list->CmdBuffer) {
+            if (command.UserCallback == nullptr && command.ElemCount > 0) {
+                ++stats.commands;
+            }
+        }
+    }
+    stats.drawCalls = stats.commands;
+    return stats;
+}
+} // namespace
+
 UIRenderer::UIRenderer() = default;
 
 UIRenderer::~UIRenderer() {
@@ -84,8 +203,11 @@ bool UIRenderer::Initialize(GLFWwindow* window) {
         return true;
     }
 
-    // Setup ImGui context
+    // Setup ImGui context; ImGui and ImPlot allocate through these, not operator new
     IMGUI_CHECKVERSION();
+    if (AllocationTracker::IsEnabled()) {
+        ImGui::SetAllocatorFunctions(&AllocationTracker::TrackedMalloc, &AllocationTracker::TrackedFree);
+    }
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO();
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
@@ -100,12 +222,25 @@ bool UIRenderer::Initialize(GLFWwindow* window) {
     ImGui_ImplGlfw_InitForOpenGL(window, true);
     ImGui_ImplOpenGL3_Init("#version 330");
 
+    // The stock backend still owns textures, so it is initialized either way
+    if (m_persistentBuffers) {
+        m_streamRenderer = std::make_unique<GLStreamRenderer>();
+        if (!m_streamRenderer->Initialize()) {
+            m_streamRenderer.reset();
+            LOG_INFO("Persistent GL buffers unavailable, using the stock OpenGL3 renderer");
+        }
+    }
+
     m_initialized = true;
     return true;
 }
 
 void UIRenderer::Shutdown() {
     if (m_initialized) {
+        if (m_streamRenderer) {
+            m_streamRenderer->Shutdown();
+            m_streamRenderer.reset();
+        }
         ImGui_ImplOpenGL3_Shutdown();
         ImGui_ImplGlfw_Shutdown();
         ImPlot::DestroyContext();
@@ -115,18 +250,40 @@ void UIRenderer::Shutdown() {
 }
 
 void UIRenderer::BeginFrame() {
+    const AllocationScope scope("ImGui new frame");
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
 }
 
-void UIRenderer::EndFrame() {
+bool UIRenderer::EndFrame(bool framebufferInvalidated) {
+    const AllocationScope scope("ImGui render");
     ImGui::Render();
+    if (framebufferInvalidated) {
+        m_presentGate.Invalidate();
+    }
+
+    bool forcePresent = false;
+    const uint64_t fingerprint = FingerprintDrawData(ImGui::GetDrawData(), forcePresent);
+
+    // The draw data holds copies of everything the frame built, so its scratch memory can go
+    FrameArena::Instance().Reset();
+    return m_presentGate.ShouldPresent(fingerprint, forcePresent);
+}
+
+void UIRenderer::SubmitFrame() {
+    const AllocationScope scope("GPU submit");
+    if (m_streamRenderer) {
+        m_streamRenderer->RenderDrawData(ImGui::GetDrawData());
+        m_drawStats = m_streamRenderer->GetStats();
+        return;
+    }
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    m_drawStats = CountDrawCommands(ImGui::GetDrawData());
 }
 
-void UIRenderer::RenderMainWindow(std::function<void()> onShowAbout, std::function<void()> onShowDemo,
-                                  std::function<void()> onShowInputDialog) {
+void UIRenderer::RenderMainWindow(const ActionTable& actions) {
+    const AllocationScope scope("Main window");
     auto& loc = Localization::Instance();
 
     // Calculate heights
@@ -135,67 +292,65 @@ void UIRenderer::RenderMainWindow(std::function<void()> onShowAbout, std::functi
     // Main content area
     if (ImGui::BeginChild("MainContent", ImVec2(0, contentHeight), ImGuiChildFlags_None, ImGuiWindowFlags_None)) {
         ImGui::SetCursorPos(ImVec2(UILayout::LEFT_MARGIN, UILayout::TOP_MARGIN));
-        ImGui::Text("Welcome to MetaImGUI!");
+        RenderStaticPanel("Welcome", []() {
+            ImGui::Text("Welcome to MetaImGUI!");
 
-        ImGui::SetCursorPos(ImVec2(UILayout::LEFT_MARGIN, UILayout::TOP_MARGIN + UILayout::LINE_SPACING));
-        ImGui::Text("This is a template for creating ImGui-based applications.");
+            ImGui::SetCursorPos(ImVec2(UILayout::LEFT_MARGIN, UILayout::TOP_MARGIN + UILayout::LINE_SPACING));
+            ImGui::Text("This is a template for creating ImGui-based applications.");
 
-        ImGui::SetCursorPos(ImVec2(UILayout::LEFT_MARGIN, UILayout::TOP_MARGIN + (UILayout::LINE_SPACING * 2)));
-        ImGui::Text("Use the menu bar above to access the About dialog.");
+            ImGui::SetCursorPos(ImVec2(UILayout::LEFT_MARGIN, UILayout::TOP_MARGIN + (UILayout::LINE_SPACING * 2)));
+            ImGui::Text("Use the menu bar above to access the About dialog.");
+        });
 
         ImGui::SetCursorPos(ImVec2(UILayout::LEFT_MARGIN,
                                    UILayout::TOP_MARGIN + (UILayout::LINE_SPACING * 2) + UILayout::BUTTON_SPACING));
         if (ImGui::Button(loc.Tr("button.show_about").c_str())) {
-            if (onShowAbout) {
-                onShowAbout();
-            }
+            actions.Invoke(ActionId::ShowAbout);
         }
 
         ImGui::SetCursorPos(ImVec2(UILayout::LEFT_MARGIN, UILayout::TOP_MARGIN + (UILayout::LINE_SPACING * 2) +
                                                               (UILayout::BUTTON_SPACING * 2)));
         if (ImGui::Button(loc.Tr("button.show_demo").c_str())) {
-            if (onShowDemo) {
-                onShowDemo();
-            }
+            actions.Invoke(ActionId::ShowDemoWindow);
         }
 
         ImGui::SetCursorPos(ImVec2(UILayout::LEFT_MARGIN, UILayout::TOP_MARGIN + (UILayout::LINE_SPACING * 2) +
                                                               (UILayout::BUTTON_SPACING * 3)));
         if (ImGui::Button(loc.Tr("button.show_input").c_str())) {
-            if (onShowInputDialog) {
-                onShowInputDialog();
-            }
+            actions.Invoke(ActionId::ShowInputDialog);
         }
     }
     ImGui::EndChild();
 }
 
-void UIRenderer::RenderMenuBar(std::function<void()> onExit, std::function<void()> onToggleDemo,
-                               std::function<void()> onCheckUpdates, std::function<void()> onShowAbout,
-                               bool showDemoWindow, std::function<void()> onToggleISSTracker, bool showISSTracker) {
+void UIRenderer::RenderMenuBar(const ActionTable& actions, bool showDemoWindow, bool showISSTracker,
+                               bool showPerformance) {
+    const AllocationScope scope("Menus");
     auto& loc = Localization::Instance();
 
     if (ImGui::BeginMenuBar()) {
         if (ImGui::BeginMenu(loc.Tr("menu.file").c_str())) {
             if (ImGui::MenuItem(loc.Tr("menu.exit").c_str(), "Alt+F4")) {
-                if (onExit) {
-                    onExit();
-                }
+                actions.Invoke(ActionId::Exit);
             }
             ImGui::EndMenu();
         }
 
         if (ImGui::BeginMenu(loc.Tr("menu.view").c_str())) {
             if (ImGui::MenuItem(loc.Tr("menu.demo_window").c_str(), nullptr, showDemoWindow)) {
-                if (onToggleDemo) {
-                    onToggleDemo();
-                }
+                actions.Invoke(ActionId::ToggleDemoWindow);
             }
 
             if (ImGui::MenuItem("ISS Tracker", nullptr, showISSTracker)) {
-                if (onToggleISSTracker) {
-                    onToggleISSTracker();
-                }
+                actions.Invoke(ActionId::ToggleISSTracker);
+            }
+
+            if (ImGui::MenuItem("Performance", "F3", showPerformance)) {
+                actions.Invoke(ActionId::TogglePerformanceOverlay);
+            }
+
+            if (ImGui::MenuItem(loc.Tr("menu.command_palette").c_str(), "Ctrl+P")) {
+                actions.Invoke(ActionId::ShowCommandPalette);
             }
 
             ImGui::Separator();
@@ -238,15 +393,11 @@ void UIRenderer::RenderMenuBar(std::function<void()> onExit, std::function<void(
 
         if (ImGui::BeginMenu(loc.Tr("menu.help").c_str())) {
             if (ImGui::MenuItem(loc.Tr("menu.check_updates").c_str())) {
-                if (onCheckUpdates) {
-                    onCheckUpdates();
-                }
+                actions.Invoke(ActionId::CheckForUpdates);
             }
             ImGui::Separator();
             if (ImGui::MenuItem(loc.Tr("menu.about").c_str(), "Ctrl+A")) {
-                if (onShowAbout) {
-                    onShowAbout();
-                }
+                actions.Invoke(ActionId::ShowAbout);
             }
             ImGui::EndMenu();
         }
@@ -257,6 +408,7 @@ void UIRenderer::RenderMenuBar(std::function<void()> onExit, std::function<void(
 
 void UIRenderer::RenderStatusBar(const std::string& statusMessage, float fps, const char* version,
                                  bool updateInProgress) {
+    const AllocationScope scope("Status bar");
     // Status bar styling - theme-aware background
     const ImVec4 windowBg = ImGui::GetStyle().Colors[ImGuiCol_WindowBg];
     const ImVec4 statusBarBg = ImVec4(windowBg.x * 0.85f, // Slightly darker/lighter than window
@@ -322,44 +474,102 @@ void UIRenderer::RenderStatusBar(const std::string& statusMessage, float fps, co
     ImGui::PopStyleColor();
 }
 
+void UIRenderer::RenderPerformanceOverlay(bool& showPerformanceOverlay) {
+    const AllocationScope scope("Performance overlay");
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    const ImVec2 anchor(viewport->WorkPos.x + viewport->WorkSize.x - UILayout::OVERLAY_MARGIN,
+                        viewport->WorkPos.y + ImGui::GetFrameHeight() + UILayout::OVERLAY_MARGIN);
+    ImGui::SetNextWindowPos(anchor, ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowBgAlpha(UILayout::OVERLAY_BG_ALPHA);
+
+    const ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize |
+                                   ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing |
+                                   ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoMove;
+    if (ImGui::Begin("Performance", &showPerformanceOverlay, flags)) {
+        const ImGuiIO& io = ImGui::GetIO();
+        ImGui::Text("%.2f ms/frame (%.0f FPS)", io.Framerate > 0.0f ? 1000.0f / io.Framerate : 0.0f,
+                    io.Framerate);
+        ImGui::Text("Presented %llu, unchanged %llu",
+                    static_cast<unsigned long long>(m_presentGate.GetPresentedFrames()),
+                    static_cast<unsigned long long>(m_presentGate.GetSkippedFrames()));
+        ImGui::Separator();
+
+        ImGui::TextDisabled("%s", m_streamRenderer ? "Persistent buffers, multi-draw" : "OpenGL3 backend");
+        ImGui::Text("Draw commands: %zu", m_drawStats.commands);
+        if (m_drawStats.commands > 0 && m_drawStats.drawCalls < m_drawStats.commands) {
+            const double saved = 100.0 * static_cast<double>(m_drawStats.commands - m_drawStats.drawCalls) /
+                                 static_cast<double>(m_drawStats.commands);
+            ImGui::Text("Draw calls: %zu (%.0f%% fewer)", m_drawStats.drawCalls, saved);
+        } else {
+            ImGui::Text("Draw calls: %zu", m_drawStats.drawCalls);
+        }
+        ImGui::Text("Vertices: %zu, indices: %zu", m_drawStats.vertices, m_drawStats.indices);
+        ImGui::Separator();
+
+        const FrameArena& arena = FrameArena::Instance();
+        ImGui::Text("Frame arena: %zu / %zu KiB", arena.GetLastFrameBytes() / 1024, arena.GetCapacity() / 1024);
+        ImGui::Text("Arena heap allocations: %zu", arena.GetLastFrameHeapAllocations());
+        ImGui::Separator();
+
+        if (!AllocationTracker::IsEnabled()) {
+            ImGui::TextDisabled("Heap allocations: not tracked (METAIMGUI_TRACK_ALLOCATIONS)");
+        } else {
+            const AllocationCounts total = AllocationTracker::GetLastFrame();
+            ImGui::Text("Heap allocations: %llu (%.1f KiB)", static_cast<unsigned long long>(total.allocations),
+                        static_cast<double>(total.bytes) / 1024.0);
+            for (const AllocationTracker::ScopeCounts& entry : AllocationTracker::GetLastFrameScopes()) {
+                if (entry.counts.allocations > 0) {
+                    ImGui::BulletText("%s: %llu (%.1f KiB)", entry.name,
+                                      static_cast<unsigned long long>(entry.counts.allocations),
+                                      static_cast<double>(entry.counts.bytes) / 1024.0);
+                }
+            }
+        }
+    }
+    ImGui::End();
+}
+
 void UIRenderer::RenderAboutWindow(bool& showAboutWindow) {
     if (!showAboutWindow) {
         return;
     }
+    const AllocationScope scope("About window");
 
     auto& loc = Localization::Instance();
 
     ImGui::SetNextWindowSize(ImVec2(UILayout::ABOUT_WINDOW_WIDTH, UILayout::ABOUT_WINDOW_HEIGHT),
                              ImGuiCond_FirstUseEver);
     if (ImGui::Begin("About MetaImGUI", &showAboutWindow, ImGuiWindowFlags_AlwaysAutoResize)) {
-        ImGui::Text("MetaImGUI v%s", Version::VERSION);
-        ImGui::TextDisabled("Build: %s", Version::VERSION_FULL);
-        ImGui::Separator();
+        RenderStaticPanel("About", []() {
+            ImGui::Text("MetaImGUI v%s", Version::VERSION);
+            ImGui::TextDisabled("Build: %s", Version::VERSION_FULL);
+            ImGui::Separator();
 
-        ImGui::Text("A template for creating ImGui-based applications");
-        ImGui::Spacing();
+            ImGui::Text("A template for creating ImGui-based applications");
+            ImGui::Spacing();
 
-        ImGui::Text("Built with:");
-        ImGui::BulletText("ImGui v1.92.4");
-        ImGui::BulletText("ImPlot v0.17");
-        ImGui::BulletText("GLFW");
-        ImGui::BulletText("OpenGL 4.6 (4.1 on macOS)");
-        ImGui::BulletText("C++20");
-        ImGui::Separator();
+            ImGui::Text("Built with:");
+            ImGui::BulletText("ImGui v1.92.4");
+            ImGui::BulletText("ImPlot v0.17");
+            ImGui::BulletText("GLFW");
+            ImGui::BulletText("OpenGL 4.6 (4.1 on macOS)");
+            ImGui::BulletText("C++20");
+            ImGui::Separator();
 
-        ImGui::Text("This template provides:");
-        ImGui::BulletText("Basic ImGui application structure");
-        ImGui::BulletText("Cross-platform build system");
-        ImGui::BulletText("Dependency management");
-        ImGui::BulletText("Automated CI/CD and releases");
-        ImGui::BulletText("Version management from git");
-        ImGui::BulletText("Modern C++20 codebase");
-        ImGui::Spacing();
-        ImGui::TextWrapped("Use this as a starting point for your own ImGui applications!");
+            ImGui::Text("This template provides:");
+            ImGui::BulletText("Basic ImGui application structure");
+            ImGui::BulletText("Cross-platform build system");
+            ImGui::BulletText("Dependency management");
+            ImGui::BulletText("Automated CI/CD and releases");
+            ImGui::BulletText("Version management from git");
+            ImGui::BulletText("Modern C++20 codebase");
+            ImGui::Spacing();
+            ImGui::TextWrapped("Use this as a starting point for your own ImGui applications!");
 
-        ImGui::Separator();
-        ImGui::TextDisabled("Git: %s (%s)", Version::COMMIT, Version::BRANCH);
-        ImGui::TextDisabled("Config: %s", Version::BUILD_CONFIG);
+            ImGui::Separator();
+            ImGui::TextDisabled("Git: %s (%s)", Version::COMMIT, Version::BRANCH);
+            ImGui::TextDisabled("Config: %s", Version::BUILD_CONFIG);
+        });
 
         ImGui::SetCursorPosY(ImGui::GetCursorPosY() + UILayout::VERTICAL_SPACING_SMALL);
         if (ImGui::Button(loc.Tr("button.close").c_str())) {
@@ -369,11 +579,13 @@ void UIRenderer::RenderAboutWindow(bool& showAboutWindow) {
     ImGui::End();
 }
 
-void UIRenderer::RenderUpdateNotification(bool& showUpdateNotification, UpdateInfo* updateInfo) {
+void UIRenderer::RenderUpdateNotification(bool& showUpdateNotification, UpdateInfo* updateInfo,
+                                          const ActionTable& actions) {
     if (updateInfo == nullptr) {
         showUpdateNotification = false;
         return;
     }
+    const AllocationScope scope("Update notification");
 
     ImGui::SetNextWindowSize(ImVec2(UILayout::UPDATE_WINDOW_WIDTH, UILayout::UPDATE_WINDOW_HEIGHT),
                              ImGuiCond_FirstUseEver);
@@ -392,7 +604,8 @@ void UIRenderer::RenderUpdateNotification(bool& showUpdateNotification, UpdateIn
 
             ImGui::Text("Current version: v%s", updateInfo->currentVersion.c_str());
             ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.4f, 0.8f, 1.0f, 1.0f));
-            ImGui::Text("Latest version:  v%s", updateInfo->latestVersion.c_str());
+            ImGui::Text("Latest version:  v%s%s", updateInfo->latestVersion.c_str(),
+                        updateInfo->preRelease ? " (pre-release)" : "");
             ImGui::PopStyleColor();
 
             ImGui::Spacing();
@@ -402,7 +615,7 @@ void UIRenderer::RenderUpdateNotification(bool& showUpdateNotification, UpdateIn
             if (!updateInfo->releaseNotes.empty()) {
                 ImGui::Text("Release Notes:");
                 ImGui::BeginChild("ReleaseNotes", ImVec2(0, UILayout::RELEASE_NOTES_HEIGHT), ImGuiChildFlags_Border);
-                ImGui::TextWrapped("%s", updateInfo->releaseNotes.c_str());
+                RenderReleaseNotes(updateInfo->releaseNotes);
                 ImGui::EndChild();
             }
 
@@ -410,7 +623,18 @@ void UIRenderer::RenderUpdateNotification(bool& showUpdateNotification, UpdateIn
             ImGui::Separator();
             ImGui::Spacing();
 
-            ImGui::Text("Visit the release page to download:");
+            if (!updateInfo->downloadUrl.empty() && actions.IsBound(ActionId::DownloadUpdate)) {
+                ImGui::Text("Download %s (%.1f MB):", updateInfo->downloadName.c_str(),
+                            static_cast<double>(updateInfo->downloadSize) / (1024.0 * 1024.0));
+                if (ImGui::Button("Download Update",
+                                  ImVec2(UILayout::BUTTON_DOWNLOAD_UPDATE_WIDTH, UILayout::BUTTON_HEIGHT))) {
+                    actions.Invoke(ActionId::DownloadUpdate);
+                }
+                ImGui::Spacing();
+                ImGui::Text("Or visit the release page:");
+            } else {
+                ImGui::Text("Visit the release page to download:");
+            }
             ImGui::Spacing();
 
             // Buttons for update available
@@ -518,6 +742,7 @@ void UIRenderer::RenderISSTrackerWindow(bool& showISSTracker, ISSTracker* issTra
     if (!showISSTracker || issTracker == nullptr) {
         return;
     }
+    const AllocationScope scope("ISS tracker");
 
     ImGui::SetNextWindowSize(ImVec2(900, 700), ImGuiCond_FirstUseEver);
     if (ImGui::Begin("ISS Tracker", &showISSTracker)) {
@@ -541,6 +766,11 @@ void UIRenderer::RenderISSTrackerWindow(bool& showISSTracker, ISSTracker* issTra
                 }
             }
 
+            ImGui::Separator();
+            RenderReplayControls(issTracker);
+            if (ImGui::CollapsingHeader("Metrics")) {
+                RenderTrackerMetrics(issTracker);
+            }
             ImGui::Separator();
 
             // Display current position info
@@ -589,10 +819,6 @@ void UIRenderer::RenderISSTrackerWindow(bool& showISSTracker, ISSTracker* issTra
 
         ImGui::Separator();
 
-        // Get position history
-        std::vector<double> latitudes, longitudes;
-        issTracker->GetPositionHistory(latitudes, longitudes);
-
         // Plot area
         if (ImPlot::BeginPlot("ISS Orbit", ImVec2(-1, -1))) {
             // Set axis limits for Earth coordinates
@@ -600,11 +826,30 @@ void UIRenderer::RenderISSTrackerWindow(bool& showISSTracker, ISSTracker* issTra
             ImPlot::SetupAxisLimits(ImAxis_X1, -180, 180, ImGuiCond_Always);
             ImPlot::SetupAxisLimits(ImAxis_Y1, -90, 90, ImGuiCond_Always);
 
-            // Plot orbit trail if we have data
-            if (!latitudes.empty() && !longitudes.empty()) {
+            // Size the trail to the plot: a ground track sweeps every longitude once per orbit,
+            // so the share of samples on screen follows the visible longitude span
+            const double visibleSpan = (std::max)(ImPlot::GetPlotLimits().X.Size(), 1.0);
+            const double pointBudget = static_cast<double>(ImPlot::GetPlotSize().x) *
+                                       UILayout::ORBIT_TRAIL_POINTS_PER_PIXEL *
+                                       (UILayout::ORBIT_FULL_LONGITUDE_SPAN / visibleSpan);
+
+            // Get position history, decimated to the point budget, into frame scratch memory
+            FrameArena& arena = FrameArena::Instance();
+            std::pmr::vector<double> latitudes(&arena);
+            std::pmr::vector<double> longitudes(&arena);
+            std::pmr::vector<size_t> segmentStarts(&arena);
+            const size_t maxPoints = (std::max)(static_cast<size_t>(pointBudget), size_t{2});
+            issTracker->GetPositionHistory(latitudes, longitudes, segmentStarts, maxPoints);
+
+            // Plot orbit trail if we have data, one line per segment so the trail never
+            // draws across the plot where longitude wraps from +180 to -180
+            for (size_t segment = 0; segment < segmentStarts.size(); ++segment) {
+                const size_t begin = segmentStarts[segment];
+                const size_t end =
+                    (segment + 1 < segmentStarts.size()) ? segmentStarts[segment + 1] : longitudes.size();
                 ImPlot::SetNextMarkerStyle(ImPlotMarker_Circle, 2.0f);
-                ImPlot::PlotLine("Orbit Trail", longitudes.data(), latitudes.data(),
-                                 static_cast<int>(longitudes.size()));
+                ImPlot::PlotLine("Orbit Trail", longitudes.data() + begin, latitudes.data() + begin,
+                                 static_cast<int>(end - begin));
             }
 
             // Plot current position as a larger marker
@@ -634,6 +879,310 @@ void UIRenderer::RenderISSTrackerWindow(bool& showISSTracker, ISSTracker* issTra
     }
 }
 
+void UIRenderer::RenderReplayControls(ISSTracker* issTracker) {
+    ImGui::SetNextItemWidth(UILayout::REPLAY_PATH_WIDTH);
+    ImGui::InputTextWithHint("##session", "Session file", m_sessionPath.data(), m_sessionPath.size());
+    // Built only on click: a path copies its string, which would allocate every frame
+    const auto sessionPath = [this]() { return std::filesystem::path(m_sessionPath.data()); };
+
+    ImGui::SameLine();
+    ImGui::BeginDisabled(m_sessionPath[0] == '\0');
+    if (ImGui::Button("Load Replay")) {
+        issTracker->LoadReplay(sessionPath());
+    }
+    ImGui::SameLine();
+    if (issTracker->IsRecording()) {
+        ImGui::EndDisabled();
+        if (ImGui::Button("Stop Recording")) {
+            issTracker->StopRecording();
+        }
+    } else {
+        if (ImGui::Button("Record")) {
+            issTracker->StartRecording(sessionPath());
+        }
+        ImGui::EndDisabled();
+    }
+    ImGui::SameLine();
+    HelpMarker("Record appends every API response to the file, one JSON object per line.\n"
+               "Load Replay accepts recorded responses or timestamp,latitude,longitude rows.");
+
+    if (!issTracker->HasReplay()) {
+        return;
+    }
+
+    const bool playing = issTracker->IsReplaying() && !issTracker->IsReplayPaused();
+    if (ImGui::Button(playing ? "Pause" : "Play")) {
+        if (playing) {
+            issTracker->PauseReplay();
+        } else {
+            issTracker->StartReplay();
+        }
+    }
+
+    ImGui::SameLine();
+    float speed = static_cast<float>(issTracker->GetReplaySpeed());
+    ImGui::SetNextItemWidth(UILayout::REPLAY_SPEED_WIDTH);
+    if (ImGui::SliderFloat("Speed", &speed, static_cast<float>(ISSTracker::MIN_REPLAY_SPEED),
+                           static_cast<float>(ISSTracker::MAX_REPLAY_SPEED), "%.0fx", ImGuiSliderFlags_Logarithmic)) {
+        issTracker->SetReplaySpeed(speed);
+    }
+
+    // Scrubbing only sends the target; the tracker locates it and rebuilds the trail
+    auto replayTime = static_cast<int64_t>(issTracker->GetReplayTime());
+    const auto startTime = static_cast<int64_t>(issTracker->GetReplayStartTime());
+    const auto endTime = static_cast<int64_t>(issTracker->GetReplayEndTime());
+    const auto elapsed = static_cast<long long>(replayTime - startTime);
+    const auto total = static_cast<long long>(endTime - startTime);
+    std::array<char, 64> label{};
+    std::snprintf(label.data(), label.size(), "%lld / %lld s", elapsed, total);
+    ImGui::SetNextItemWidth(-1.0f);
+    if (ImGui::SliderScalar("##scrub", ImGuiDataType_S64, &replayTime, &startTime, &endTime, label.data())) {
+        issTracker->SeekReplay(static_cast<long>(replayTime));
+    }
+}
+
+void UIRenderer::RenderTrackerMetrics(const ISSTracker* issTracker) {
+    const TrackerMetrics::Snapshot metrics = issTracker->GetMetrics();
+
+    ImGui::Text("Fetches: %llu ok, %llu failed, %llu unparsable",
+                static_cast<unsigned long long>(metrics.fetchSuccesses),
+                static_cast<unsigned long long>(metrics.fetchFailures),
+                static_cast<unsigned long long>(metrics.parseFailures));
+    ImGui::Text("Received: %.1f KiB, callbacks dropped: %llu", static_cast<double>(metrics.bytesReceived) / 1024.0,
+                static_cast<unsigned long long>(metrics.callbacksDropped));
+
+    const int64_t ageMs = issTracker->GetCurrentSampleAgeMs();
+    if (ageMs >= 0 && !issTracker->IsReplaying()) {
+        const bool fresh = ageMs <= UILayout::SAMPLE_AGE_SLO_MS;
+        ImGui::PushStyleColor(ImGuiCol_Text, fresh ? ImVec4(0.4f, 0.8f, 0.4f, 1.0f) : ImVec4(0.8f, 0.4f, 0.4f, 1.0f));
+        ImGui::Text("Displayed sample age: %.1f s", static_cast<double>(ageMs) / 1000.0);
+        ImGui::PopStyleColor();
+    }
+
+    if (ImGui::BeginTable("TrackerMetrics", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("Stage");
+        ImGui::TableSetupColumn("Count");
+        ImGui::TableSetupColumn("Mean");
+        ImGui::TableSetupColumn("p50");
+        ImGui::TableSetupColumn("p99");
+        ImGui::TableSetupColumn("Max");
+        ImGui::TableHeadersRow();
+
+        const auto row = [](const char* stage, const LatencyHistogram::Snapshot& histogram, const char* unit) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(stage);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(histogram.count));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.0f %s", histogram.Mean(), unit);
+            ImGui::TableNextColumn();
+            ImGui::Text("<= %llu %s", static_cast<unsigned long long>(histogram.Percentile(50.0)), unit);
+            ImGui::TableNextColumn();
+            ImGui::Text("<= %llu %s", static_cast<unsigned long long>(histogram.Percentile(99.0)), unit);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu %s", static_cast<unsigned long long>(histogram.max), unit);
+        };
+        row("Fetch", metrics.fetchLatencyUs, "us");
+        row("Parse", metrics.parseTimeUs, "us");
+        row("Callback", metrics.callbackDurationUs, "us");
+        row("Age at publish", metrics.sampleAgeMs, "ms");
+        ImGui::EndTable();
+    }
+}
+
+void UIRenderer::RenderReleaseNotes(const std::string& releaseNotes) {
+    if (releaseNotes != m_releaseNotesSource) {
+        m_releaseNotesSource = releaseNotes;
+        m_releaseNotes.Parse(releaseNotes);
+    }
+
+    ImFont* font = ImGui::GetFont();
+    const float fontSize = ImGui::GetFontSize();
+    const ImGuiStyle& style = ImGui::GetStyle();
+
+    // The font travels as the context pointer, so no callable is constructed per frame
+    struct FontContext {
+        ImFont* font;
+        float size;
+    };
+    const FontContext fontContext{font, fontSize};
+    MarkdownMetrics metrics;
+    metrics.measure = [](const void* context, std::string_view text, uint8_t textStyle, float fontScale) {
+        const auto& [measured, size] = *static_cast<const FontContext*>(context);
+        const float width =
+            measured->CalcTextSizeA(size * fontScale, FLT_MAX, 0.0f, text.data(), text.data() + text.size()).x;
+        // Strong text is drawn twice, one pixel apart
+        return ((textStyle & MarkdownStyle::STRONG) != 0) ? width + 1.0f : width;
+    };
+    metrics.context = &fontContext;
+    metrics.lineHeight = ImGui::GetTextLineHeightWithSpacing();
+    metrics.indentWidth = style.IndentSpacing;
+    metrics.blockSpacing = style.ItemSpacing.y * 2.0f;
+
+    // The font and its size identify the measurements; the layout is only rebuilt when they or the width change
+    uint32_t sizeBits = 0;
+    std::memcpy(&sizeBits, &fontSize, sizeof(sizeBits));
+    const uint64_t fontKey = (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(font)) << 16) ^ sizeBits;
+    const MarkdownLayout& layout = m_releaseNotes.Layout(ImGui::GetContentRegionAvail().x, fontKey, metrics);
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    const float clipTop = drawList->GetClipRectMin().y;
+    const float clipBottom = drawList->GetClipRectMax().y;
+    const ImU32 textColor = ImGui::GetColorU32(ImGuiCol_Text);
+    const ImU32 emphasisColor = ImGui::GetColorU32(ImGuiCol_Text, UILayout::MARKDOWN_EMPHASIS_ALPHA);
+    const ImU32 linkColor = ImGui::GetColorU32(ImGuiCol_TextLink);
+    const ImU32 codeColor = ImGui::GetColorU32(ImGuiCol_FrameBg);
+    const ImU32 ruleColor = ImGui::GetColorU32(ImGuiCol_Separator);
+    const bool hovered = ImGui::IsWindowHovered();
+    const auto& blocks = m_releaseNotes.GetBlocks();
+
+    for (const MarkdownLine& line : layout.lines) {
+        const float top = origin.y + line.y;
+        if (top + line.height < clipTop) {
+            continue;
+        }
+        if (top > clipBottom) {
+            break; // Lines are in vertical order
+        }
+
+        const MarkdownBlock& block = blocks[line.block];
+        const float size = fontSize * line.fontScale;
+        const float textTop = top + (line.height - size) * 0.5f;
+        const float middle = top + line.height * 0.5f;
+
+        switch (block.type) {
+        case MarkdownBlockType::Rule:
+            drawList->AddLine(ImVec2(origin.x, middle), ImVec2(origin.x + layout.width, middle), ruleColor);
+            break;
+        case MarkdownBlockType::Quote:
+            drawList->AddRectFilled(ImVec2(origin.x, top),
+                                    ImVec2(origin.x + UILayout::MARKDOWN_QUOTE_BAR_WIDTH, top + line.height),
+                                    ruleColor);
+            break;
+        case MarkdownBlockType::CodeBlock:
+            drawList->AddRectFilled(ImVec2(origin.x, top), ImVec2(origin.x + layout.width, top + line.height),
+                                    codeColor);
+            break;
+        case MarkdownBlockType::ListItem:
+            if (line.firstOfBlock) {
+                const float markerRight = metrics.indentWidth * static_cast<float>(block.level + 1);
+                if (block.number == 0) {
+                    drawList->AddCircleFilled(ImVec2(origin.x + markerRight - metrics.indentWidth * 0.5f, middle),
+                                              size * UILayout::MARKDOWN_BULLET_RADIUS, textColor);
+                } else {
+                    std::array<char, 16> marker{};
+                    const int length = std::snprintf(marker.data(), marker.size(), "%u.", block.number);
+                    const float width = font->CalcTextSizeA(size, FLT_MAX, 0.0f, marker.data()).x;
+                    drawList->AddText(font, size,
+                                      ImVec2(origin.x + markerRight - width - UILayout::MARKDOWN_MARKER_GAP, textTop),
+                                      textColor, marker.data(), marker.data() + length);
+                }
+            }
+            break;
+        default:
+            break;
+        }
+
+        for (uint32_t r = line.firstRun; r < line.firstRun + line.runCount; ++r) {
+            const MarkdownRun& run = layout.runs[r];
+            const std::string_view text = m_releaseNotes.GetText(run.offset, run.length);
+            const ImVec2 position(origin.x + run.x, textTop);
+            const ImVec2 end(position.x + run.width, textTop + size);
+
+            if ((run.style & MarkdownStyle::CODE) != 0 && block.type != MarkdownBlockType::CodeBlock) {
+                drawList->AddRectFilled(ImVec2(position.x - 1.0f, position.y), ImVec2(end.x + 1.0f, end.y), codeColor,
+                                        style.FrameRounding);
+            }
+
+            ImU32 color = textColor;
+            if ((run.style & MarkdownStyle::LINK) != 0) {
+                color = linkColor;
+            } else if ((run.style & MarkdownStyle::EMPHASIS) != 0) {
+                color = emphasisColor;
+            }
+            drawList->AddText(font, size, position, color, text.data(), text.data() + text.size());
+            if ((run.style & MarkdownStyle::STRONG) != 0) {
+                drawList->AddText(font, size, ImVec2(position.x + 1.0f, position.y), color, text.data(),
+                                  text.data() + text.size());
+            }
+
+            if ((run.style & MarkdownStyle::LINK) != 0) {
+                drawList->AddLine(ImVec2(position.x, end.y), end, color);
+                // Links in downloaded notes are not opened; clicking copies the URL instead
+                if (hovered && ImGui::IsMouseHoveringRect(position, end)) {
+                    const std::string& url = m_releaseNotes.GetLinks()[static_cast<size_t>(run.link)];
+                    ImGui::SetMouseCursor(ImGuiMouseCursor_Hand);
+                    ImGui::SetTooltip("%s\n(click to copy)", url.c_str());
+                    if (ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
+                        ImGui::SetClipboardText(url.c_str());
+                    }
+                }
+            }
+        }
+    }
+
+    // Reserve the laid-out height so the child window scrolls over it
+    ImGui::Dummy(ImVec2(layout.width, layout.height));
+}
+
+void UIRenderer::RenderStaticPanel(const char* id, void (*draw)()) {
+    static_assert(sizeof(ImDrawVert) == sizeof(StaticPanelVertex) && offsetof(ImDrawVert, pos) == 0 &&
+                      offsetof(ImDrawVert, uv) == offsetof(StaticPanelVertex, u) &&
+                      offsetof(ImDrawVert, col) == offsetof(StaticPanelVertex, color),
+                  "StaticPanelVertex must match the ImDrawVert layout");
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const StaticPanelKey key = MakeStaticPanelKey(drawList);
+
+    if (const StaticPanelCache::Geometry* geometry = m_staticPanels.Find(id, key)) {
+        const auto vertexCount = static_cast<int>(geometry->vertices.size());
+        const auto indexCount = static_cast<int>(geometry->indices.size());
+        drawList->PrimReserve(indexCount, vertexCount);
+        // Read after PrimReserve, which may start a new vertex offset for 16-bit indices
+        const unsigned int base = drawList->_VtxCurrentIdx;
+        std::memcpy(drawList->_VtxWritePtr, geometry->vertices.data(), geometry->vertices.size() * sizeof(ImDrawVert));
+        for (int i = 0; i < indexCount; ++i) {
+            drawList->_IdxWritePtr[i] = static_cast<ImDrawIdx>(base + geometry->indices[static_cast<size_t>(i)]);
+        }
+        drawList->_VtxWritePtr += vertexCount;
+        drawList->_IdxWritePtr += indexCount;
+        drawList->_VtxCurrentIdx += static_cast<unsigned int>(vertexCount);
+
+        // Occupy the same layout space the items did
+        ImGui::Dummy(ImVec2(geometry->width, geometry->height));
+        return;
+    }
+
+    const int commandCount = drawList->CmdBuffer.Size;
+    const int vertexStart = drawList->VtxBuffer.Size;
+    const int indexStart = drawList->IdxBuffer.Size;
+    const unsigned int vertexBase = drawList->_VtxCurrentIdx;
+
+    ImGui::BeginGroup();
+    draw();
+    ImGui::EndGroup();
+
+    // Geometry split across draw commands (a clip, texture or vertex offset change) is not replayable as one block
+    if (drawList->CmdBuffer.Size != commandCount || drawList->_VtxCurrentIdx < vertexBase) {
+        m_staticPanels.Discard(id);
+        return;
+    }
+
+    StaticPanelCache::Geometry& geometry = m_staticPanels.Record(id, key);
+    geometry.vertices.resize(static_cast<size_t>(drawList->VtxBuffer.Size - vertexStart));
+    std::memcpy(geometry.vertices.data(), drawList->VtxBuffer.Data + vertexStart,
+                geometry.vertices.size() * sizeof(ImDrawVert));
+    geometry.indices.reserve(static_cast<size_t>(drawList->IdxBuffer.Size - indexStart));
+    for (int i = indexStart; i < drawList->IdxBuffer.Size; ++i) {
+        geometry.indices.push_back(drawList->IdxBuffer.Data[i] - vertexBase);
+    }
+    const ImVec2 size = ImGui::GetItemRectSize();
+    geometry.width = size.x;
+    geometry.height = size.y;
+}
+
 void UIRenderer::HelpMarker(const char* desc) {
     ImGui::TextDisabled("(?)");
     if (ImGui::IsItemHovered()) {
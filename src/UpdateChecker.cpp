@@ -18,63 +18,592 @@
 
 #include "UpdateChecker.h"
 
+#include "BinaryPatch.h"
 #include "Logger.h"
+#include "SemVer.h"
+#include "Sha256.h"
 #include "version.h"
 
 #include <nlohmann/json.hpp>
 
 #include <algorithm>
 #include <cctype>
-#include <sstream>
-
-// HTTP requests using libcurl (cross-platform)
-#include <curl/curl.h>
+#include <cstdlib>
+#include <fstream>
+#include <optional>
 
 namespace MetaImGUI {
 
-UpdateChecker::UpdateChecker(std::string repoOwner, std::string repoName)
-    : m_repoOwner(std::move(repoOwner)), m_repoName(std::move(repoName)), m_checking(false) {}
+namespace {
+// Validated when the program is built rather than on every check
+constexpr std::optional<SemVer> CURRENT_VERSION = SemVer::Parse(Version::VERSION);
+static_assert(CURRENT_VERSION.has_value(), "PROJECT_VERSION must be a semantic version");
+
+constexpr std::string_view CHECKSUM_SUFFIX = ".sha256";
+constexpr std::string_view PART_SUFFIX = ".part";
+constexpr std::string_view DELTA_SUFFIX = ".bsdiff";
+constexpr std::string_view PATCHED_SUFFIX = ".patched";
+constexpr size_t SHA256_HEX_LENGTH = Sha256::DIGEST_SIZE * 2;
+constexpr size_t READ_CHUNK_SIZE = 64 * 1024;
+constexpr uint64_t MIN_PROGRESS_STEP = 256 * 1024;
+constexpr long DOWNLOAD_STALL_TIMEOUT_SECONDS = 30;
+constexpr std::chrono::seconds DOWNLOAD_RETRY_DELAY{2};
+
+// Lower-cased digest from the start of a "<hex>  <file>" line, or empty if there is none
+std::string ParseSha256Hex(std::string_view text) {
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front())) != 0) {
+        text.remove_prefix(1);
+    }
+    if (text.size() < SHA256_HEX_LENGTH ||
+        (text.size() > SHA256_HEX_LENGTH && std::isspace(static_cast<unsigned char>(text[SHA256_HEX_LENGTH])) == 0)) {
+        return {};
+    }
+
+    std::string hex(text.substr(0, SHA256_HEX_LENGTH));
+    for (char& c : hex) {
+        if (std::isxdigit(static_cast<unsigned char>(c)) == 0) {
+            return {};
+        }
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return hex;
+}
+
+// The asset name becomes a file name, so it must not be able to leave the download directory
+bool IsSafeFileName(std::string_view name) {
+    return !name.empty() && name.front() != '.' && name.find_first_of("/\\:") == std::string_view::npos;
+}
+
+// The download URL of the asset called name, or empty if the release has none
+std::string FindAssetUrl(const nlohmann::json& assets, std::string_view name) {
+    for (const auto& asset : assets) {
+        if (asset.value("name", "") == name && asset.contains("browser_download_url")) {
+            return asset["browser_download_url"].get<std::string>();
+        }
+    }
+    return {};
+}
+
+// GitHub publishes "sha256:<hex>" digests for release assets
+std::string AssetSha256(const nlohmann::json& asset) {
+    if (const std::string digest = asset.value("digest", ""); digest.starts_with("sha256:")) {
+        return ParseSha256Hex(std::string_view(digest).substr(7));
+    }
+    return {};
+}
+
+void SelectDeltaAsset(const nlohmann::json& assets, UpdateInfo& info) {
+    const std::string deltaName = info.downloadName + ".from-" + Version::VERSION + std::string(DELTA_SUFFIX);
+    for (const auto& asset : assets) {
+        if (asset.value("name", "") != deltaName || !asset.contains("browser_download_url")) {
+            continue;
+        }
+        info.deltaUrl = asset["browser_download_url"].get<std::string>();
+        info.deltaName = deltaName;
+        info.deltaSize = asset.value("size", uint64_t{0});
+        info.deltaSha256 = AssetSha256(asset);
+        info.deltaChecksumUrl = FindAssetUrl(assets, deltaName + std::string(CHECKSUM_SUFFIX));
+        return;
+    }
+}
+
+// Asset name endings for a package format (named by .github/workflows/release.yml), most specific first
+std::vector<std::string> PackageSuffixes(const UpdateAssetFilter& filter, UpdatePackage package) {
+    const std::string target = "-" + filter.platform + "-" + filter.arch;
+    switch (package) {
+    case UpdatePackage::AppImage:
+        return {target + ".AppImage"};
+    case UpdatePackage::Tarball:
+        return {target + ".tar.gz"};
+    case UpdatePackage::Installer:
+        // The x64 installer predates architecture-specific names
+        if (filter.arch == "x64") {
+            return {target + "-Setup.exe", "-Setup.exe"};
+        }
+        return {target + "-Setup.exe"};
+    case UpdatePackage::PortableZip:
+        return {target + "-portable.zip"};
+    case UpdatePackage::DiskImage:
+        return {target + ".dmg"};
+    }
+    return {};
+}
+
+// Assets are matched by exact name so "-Setup.exe" cannot pick up another architecture's installer
+void SelectDownloadAsset(const nlohmann::json& assets, const UpdateAssetFilter& filter, UpdateInfo& info) {
+    const std::string prefix = std::string(Version::PROJECT) + "-" + info.latestVersion;
+    for (const UpdatePackage package : filter.packages) {
+        for (const std::string& suffix : PackageSuffixes(filter, package)) {
+            const std::string name = prefix + suffix;
+            for (const auto& asset : assets) {
+                if (asset.value("name", "") != name || !asset.contains("browser_download_url")) {
+                    continue;
+                }
+
+                info.downloadUrl = asset["browser_download_url"].get<std::string>();
+                info.downloadName = name;
+                info.downloadSize = asset.value("size", uint64_t{0});
+                info.downloadSha256 = AssetSha256(asset);
+                info.checksumUrl = FindAssetUrl(assets, name + std::string(CHECKSUM_SUFFIX));
+                SelectDeltaAsset(assets, info);
+                return;
+            }
+        }
+    }
+}
+
+// Version, notes and download asset of one GitHub release object
+UpdateInfo ReadRelease(const nlohmann::json& release, const UpdateAssetFilter& filter) {
+    UpdateInfo info;
+
+    // Extract tag_name
+    if (release.contains("tag_name") && release["tag_name"].is_string()) {
+        std::string tag = release["tag_name"].get<std::string>();
+        // Remove 'v' prefix if present
+        info.latestVersion = (!tag.empty() && tag[0] == 'v') ? tag.substr(1) : tag;
+        LOG_INFO("Update Checker: Parsed version: {}", info.latestVersion);
+    } else {
+        LOG_ERROR("Update Checker: No tag_name in response");
+    }
+
+    // Extract html_url
+    if (release.contains("html_url") && release["html_url"].is_string()) {
+        info.releaseUrl = release["html_url"].get<std::string>();
+        LOG_INFO("Update Checker: Release URL: {}", info.releaseUrl);
+    }
+
+    // Extract body (release notes)
+    if (release.contains("body") && release["body"].is_string()) {
+        info.releaseNotes = release["body"].get<std::string>();
+        LOG_INFO("Update Checker: Release notes: {} chars", info.releaseNotes.length());
+    }
+
+    info.preRelease = release.value("prerelease", false);
+
+    // Pick the asset for this platform, with its checksum if one is published
+    if (release.contains("assets") && release["assets"].is_array()) {
+        SelectDownloadAsset(release["assets"], filter, info);
+        if (!info.downloadUrl.empty()) {
+            LOG_INFO("Update Checker: Download asset: {}", info.downloadName);
+        }
+    }
+    return info;
+}
+
+// The channel a release belongs to, or nullopt for drafts and tags that are not versions
+std::optional<UpdateChannel> ReleaseChannel(const nlohmann::json& release) {
+    const std::string tag = release.value("tag_name", "");
+    const std::optional<SemVer> version = SemVer::Parse(tag);
+    if (!version || release.value("draft", false)) {
+        return std::nullopt;
+    }
+    if (version->preRelease.starts_with("nightly")) {
+        return UpdateChannel::Nightly;
+    }
+    if (version->IsPreRelease() || release.value("prerelease", false)) {
+        return UpdateChannel::Beta;
+    }
+    return UpdateChannel::Stable;
+}
+
+// SAX handler for a /releases page. Each element of the top-level array is built as a small DOM and
+// offered to the predicate, then dropped; parsing stops as soon as the predicate accepts one, so
+// neither the rest of the document nor the whole list is ever materialized.
+class ReleaseListScanner {
+public:
+    using Json = nlohmann::json;
+
+    explicit ReleaseListScanner(std::function<bool(const Json&)> accept) : m_accept(std::move(accept)) {}
+
+    bool null() {
+        return Value(nullptr);
+    }
+    bool boolean(bool value) {
+        return Value(value);
+    }
+    bool number_integer(Json::number_integer_t value) {
+        return Value(value);
+    }
+    bool number_unsigned(Json::number_unsigned_t value) {
+        return Value(value);
+    }
+    bool number_float(Json::number_float_t value, const Json::string_t& /*text*/) {
+        return Value(value);
+    }
+    bool string(Json::string_t& value) {
+        return Value(std::move(value));
+    }
+    bool binary(Json::binary_t& value) {
+        return Value(std::move(value));
+    }
+    bool start_object(std::size_t /*size*/) {
+        return Open(Json::object());
+    }
+    bool key(Json::string_t& name) {
+        m_key = std::move(name);
+        return true;
+    }
+    bool end_object() {
+        return Close();
+    }
+    bool start_array(std::size_t /*size*/) {
+        if (!m_inList) {
+            m_inList = true;
+            return true;
+        }
+        return Open(Json::array());
+    }
+    bool end_array() {
+        if (m_stack.empty()) {
+            m_inList = false;
+            return true;
+        }
+        return Close();
+    }
+    bool parse_error(std::size_t /*position*/, const std::string& /*token*/, const nlohmann::detail::exception& e) {
+        m_error = e.what();
+        return false;
+    }
+
+    [[nodiscard]] std::optional<Json>& GetMatch() {
+        return m_match;
+    }
+    [[nodiscard]] size_t GetScannedCount() const {
+        return m_scanned;
+    }
+    [[nodiscard]] const std::string& GetError() const {
+        return m_error;
+    }
+
+private:
+    // Anything but an array at the top level (GitHub error objects, for one) is not a release list
+    bool NotAList() {
+        m_error = "Response is not a release list";
+        return false;
+    }
+
+    Json* Add(Json value) {
+        Json& parent = *m_stack.back();
+        if (parent.is_object()) {
+            Json& slot = parent[m_key];
+            slot = std::move(value);
+            return &slot;
+        }
+        parent.push_back(std::move(value));
+        return &parent.back();
+    }
+
+    bool Value(Json value) {
+        if (m_stack.empty()) {
+            return m_inList ? true : NotAList(); // Non-object list elements are skipped
+        }
+        Add(std::move(value));
+        return true;
+    }
+
+    // Children are only added to the innermost open container, so the pointers to outer ones stay valid
+    bool Open(Json container) {
+        if (m_stack.empty()) {
+            if (!m_inList) {
+                return NotAList();
+            }
+            m_element = std::move(container);
+            m_stack.push_back(&m_element);
+            return true;
+        }
+        m_stack.push_back(Add(std::move(container)));
+        return true;
+    }
+
+    bool Close() {
+        m_stack.pop_back();
+        if (!m_stack.empty()) {
+            return true;
+        }
+        ++m_scanned;
+        if (m_accept(m_element)) {
+            m_match = std::move(m_element);
+            return false; // Stop parsing
+        }
+        m_element = nullptr;
+        return true;
+    }
+
+    std::function<bool(const Json&)> m_accept;
+    Json m_element;
+    std::vector<Json*> m_stack; // Open containers of m_element, innermost last
+    Json::string_t m_key;
+    bool m_inList = false;
+    size_t m_scanned = 0;
+    std::optional<Json> m_match;
+    std::string m_error;
+};
+
+struct ReleaseScan {
+    std::optional<UpdateInfo> release;
+    size_t scanned = 0; // Releases examined
+    std::string error;
+};
+
+ReleaseScan ScanReleaseList(std::string_view releaseList, UpdateChannel channel, const UpdateAssetFilter& filter) {
+    ReleaseScan scan;
+    ReleaseListScanner scanner([channel](const nlohmann::json& release) {
+        const std::optional<UpdateChannel> releaseChannel = ReleaseChannel(release);
+        return releaseChannel && *releaseChannel <= channel;
+    });
+
+    try {
+        nlohmann::json::sax_parse(releaseList, &scanner);
+    } catch (const std::exception& e) {
+        scan.error = e.what();
+        return scan;
+    }
+
+    scan.scanned = scanner.GetScannedCount();
+    if (scanner.GetMatch()) {
+        scan.release = ReadRelease(*scanner.GetMatch(), filter);
+    } else {
+        scan.error = scanner.GetError();
+    }
+    return scan;
+}
+
+// Hash a file's contents into hash; returns the bytes read, or nullopt if it cannot be read
+std::optional<uint64_t> HashFile(const std::filesystem::path& path, Sha256& hash) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+
+    std::string buffer(READ_CHUNK_SIZE, '\0');
+    uint64_t total = 0;
+    while (file) {
+        file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        const auto count = static_cast<size_t>(file.gcount());
+        hash.Update(std::string_view(buffer.data(), count));
+        total += count;
+    }
+    if (file.bad()) {
+        return std::nullopt;
+    }
+    return total;
+}
+
+// Streams a response body onto the end of the partial file, hashing it on the way
+class PartFileWriter {
+public:
+    PartFileWriter(std::filesystem::path path, uint64_t expectedSize, const UpdateDownloadProgress& onProgress)
+        : m_path(std::move(path)), m_expectedSize(expectedSize), m_onProgress(onProgress) {}
+
+    // Hash what an earlier attempt left on disk and open the file for appending; returns the resume offset
+    std::optional<uint64_t> Open() {
+        m_hash.Reset();
+        const std::optional<uint64_t> existing = HashFile(m_path, m_hash);
+        m_received = existing.value_or(0);
+        if (!existing) {
+            m_hash.Reset(); // Missing or unreadable: start from scratch
+        }
+        m_file.open(m_path, std::ios::binary | (existing ? std::ios::app : std::ios::trunc));
+        if (!m_file.is_open()) {
+            m_error = "Cannot write " + m_path.string();
+            return std::nullopt;
+        }
+        m_started = false;
+        m_nextProgress = 0;
+        ReportProgress();
+        return m_received;
+    }
+
+    // Called on the HTTP I/O thread for each chunk
+    bool OnBody(long statusCode, std::string_view chunk) {
+        if (statusCode >= 300) {
+            return true; // An error page; the status is reported once the transfer ends
+        }
+        if (!m_started) {
+            m_started = true;
+            if (statusCode == 200 && m_received > 0) {
+                // The server ignored the range and is sending the whole file
+                LOG_INFO("Update Checker: Server does not support resuming, restarting download");
+                m_file.close();
+                m_file.open(m_path, std::ios::binary | std::ios::trunc);
+                m_hash.Reset();
+                m_received = 0;
+            }
+        }
+
+        m_file.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        if (!m_file) {
+            m_error = "Failed to write " + m_path.string();
+            return false;
+        }
+        m_hash.Update(chunk);
+        m_received += chunk.size();
+        if (m_expectedSize > 0 && m_received > m_expectedSize) {
+            m_error = "Download is larger than the published asset";
+            return false;
+        }
+        ReportProgress();
+        return true;
+    }
+
+    bool Close() {
+        m_file.close();
+        if (m_file.fail() && m_error.empty()) {
+            m_error = "Failed to write " + m_path.string();
+        }
+        m_file.clear();
+        return m_error.empty();
+    }
+
+    void Discard() {
+        m_file.close();
+        m_file.clear();
+        std::error_code error;
+        std::filesystem::remove(m_path, error);
+        m_hash.Reset();
+        m_received = 0;
+        m_error.clear();
+    }
+
+    [[nodiscard]] std::string FinishHex() {
+        return Sha256::ToHex(m_hash.Finish());
+    }
+
+    [[nodiscard]] const std::string& GetError() const {
+        return m_error;
+    }
+
+private:
+    // Throttled so a fast download does not flood the callback with one call per chunk
+    void ReportProgress() {
+        if (!m_onProgress || (m_received < m_nextProgress && m_received != m_expectedSize)) {
+            return;
+        }
+        m_onProgress(m_received, m_expectedSize);
+        m_nextProgress = m_received + std::max(MIN_PROGRESS_STEP, m_expectedSize / 200);
+    }
+
+    std::filesystem::path m_path;
+    uint64_t m_expectedSize;
+    const UpdateDownloadProgress& m_onProgress;
+
+    std::ofstream m_file;
+    Sha256 m_hash;
+    uint64_t m_received = 0;
+    uint64_t m_nextProgress = 0;
+    bool m_started = false; // A chunk of the current response has arrived
+    std::string m_error;
+};
+} // namespace
+
+std::optional<UpdateChannel> ParseUpdateChannel(std::string_view name) {
+    for (const UpdateChannel channel : {UpdateChannel::Stable, UpdateChannel::Beta, UpdateChannel::Nightly}) {
+        const std::string_view candidate = UpdateChannelName(channel);
+        if (std::equal(name.begin(), name.end(), candidate.begin(), candidate.end(), [](char a, char b) {
+                return std::tolower(static_cast<unsigned char>(a)) == b;
+            })) {
+            return channel;
+        }
+    }
+    return std::nullopt;
+}
+
+const char* UpdateChannelName(UpdateChannel channel) {
+    switch (channel) {
+    case UpdateChannel::Stable:
+        return "stable";
+    case UpdateChannel::Beta:
+        return "beta";
+    case UpdateChannel::Nightly:
+        return "nightly";
+    }
+    return "stable";
+}
+
+UpdateAssetFilter UpdateAssetFilter::ForThisBuild() {
+#if defined(__aarch64__) || defined(_M_ARM64)
+    const std::string arch = "arm64";
+#else
+    const std::string arch = "x64";
+#endif
+#ifdef _WIN32
+    return {"windows", arch, {UpdatePackage::Installer, UpdatePackage::PortableZip}};
+#elif defined(__APPLE__)
+    return {"macos", arch, {UpdatePackage::DiskImage}};
+#else
+    return {"linux", arch, {UpdatePackage::AppImage, UpdatePackage::Tarball}};
+#endif
+}
+
+UpdateChecker::UpdateChecker(std::string repoOwner, std::string repoName, TaskScheduler& scheduler, HttpClient& http)
+    : m_repoOwner(std::move(repoOwner)), m_repoName(std::move(repoName)), m_checking(false), m_scheduler(scheduler),
+      m_http(http), m_downloading(false), m_assetFilter(UpdateAssetFilter::ForThisBuild()) {
+#if !defined(_WIN32) && !defined(__APPLE__)
+    // The AppImage runtime exports the path of the image being run, which is exactly the file a delta patches
+    // NOLINTNEXTLINE(concurrency-mt-unsafe) - Read-only access; nothing in the application modifies it
+    if (const char* appImage = std::getenv("APPIMAGE"); appImage != nullptr) {
+        m_installedAsset = appImage;
+    }
+#endif
+}
 
 UpdateChecker::~UpdateChecker() {
-    // C++20: std::jthread automatically joins on destruction
     Cancel();
+    CancelDownload();
+
+    // The tasks refer to this checker, so wait for in-flight requests to return
+    const std::lock_guard<std::mutex> lock(m_threadMutex);
+    m_checkTask.Wait();
+    m_downloadTask.Wait();
 }
 
-void UpdateChecker::CheckForUpdatesAsync(std::function<void(const UpdateInfo&)> callback) {
+void UpdateChecker::CheckForUpdatesAsync(std::function<void(const UpdateInfo&)> callback,
+                                         std::chrono::milliseconds delay) {
     const std::lock_guard<std::mutex> lock(m_threadMutex);
 
-    if (m_checking) {
+    // A cancelled check still occupies the task until its request returns
+    if (m_checking || !m_checkTask.IsDone()) {
         LOG_INFO("Update Checker: Check already in progress, skipping");
         return; // Already checking
     }
 
     m_checking = true;
 
-    // C++20: std::jthread with stop_token for clean cancellation
-    m_stopSource = std::stop_source();
-    m_checkThread = std::jthread([this, callback](const std::stop_token& stopToken) {
-        const UpdateInfo info = CheckForUpdatesImpl(stopToken);
-
-        m_checking = false;
-
-        // Only invoke callback if not cancelled
-        if (!stopToken.stop_requested() && callback) {
-            try {
-                callback(info);
-            } catch (const std::exception& e) {
-                LOG_ERROR("Update Checker: Callback threw exception: {}", e.what());
-            } catch (...) {
-                LOG_ERROR("Update Checker: Callback threw unknown exception");
-            }
+    // The coroutine's stop_token is the one Cancel() signals; no thread is held during the request
+    m_checkTask = m_scheduler.Spawn(
+        [this, callback, delay](std::stop_token stopToken) { return RunCheck(std::move(stopToken), callback, delay); });
+}
+
+AsyncTask<void> UpdateChecker::RunCheck(std::stop_token stopToken, std::function<void(const UpdateInfo&)> callback,
+                                        std::chrono::milliseconds delay) {
+    if (delay.count() > 0) {
+        co_await m_scheduler.SleepFor(delay, stopToken);
+        if (stopToken.stop_requested()) {
+            m_checking = false;
+            co_return;
         }
-    });
-    // C++20: jthread automatically joins on destruction, no detach() needed
+    }
+
+    const UpdateInfo info = co_await CheckForUpdatesCoro(stopToken);
+
+    m_checking = false;
+
+    // Only invoke callback if not cancelled
+    if (!stopToken.stop_requested() && callback) {
+        try {
+            callback(info);
+        } catch (const std::exception& e) {
+            LOG_ERROR("Update Checker: Callback threw exception: {}", e.what());
+        } catch (...) {
+            LOG_ERROR("Update Checker: Callback threw unknown exception");
+        }
+    }
 }
 
 UpdateInfo UpdateChecker::CheckForUpdates() {
     m_checking = true;
     // For synchronous calls, use a default stop_token that never stops
-    UpdateInfo info = CheckForUpdatesImpl(std::stop_token{});
+    UpdateInfo info = CheckForUpdatesCoro().SyncWait();
     m_checking = false;
     return info;
 }
@@ -82,10 +611,10 @@ UpdateInfo UpdateChecker::CheckForUpdates() {
 void UpdateChecker::Cancel() {
     const std::lock_guard<std::mutex> lock(m_threadMutex);
 
-    // C++20: Request stop using stop_source
-    m_stopSource.request_stop();
+    m_checkTask.Cancel();
 
-    // jthread automatically joins, so we just need to request stop
+    // A check cancelled before it started never runs, so it cannot clear the flag itself
+    m_checking = false;
     LOG_INFO("Update Checker: Cancellation requested");
 }
 
@@ -93,142 +622,443 @@ bool UpdateChecker::IsChecking() const {
     return m_checking;
 }
 
-UpdateInfo UpdateChecker::CheckForUpdatesImpl(const std::stop_token& stopToken) {
+AsyncTask<UpdateInfo> UpdateChecker::CheckForUpdatesCoro(std::stop_token stopToken) {
+    UpdateChannel channel = UpdateChannel::Stable;
+    UpdateAssetFilter filter;
+    {
+        const std::lock_guard<std::mutex> lock(m_settingsMutex);
+        channel = m_channel;
+        filter = m_assetFilter;
+    }
+
+    UpdateInfo info = co_await FetchLatestRelease(channel, std::move(filter), stopToken);
+    info.currentVersion = Version::VERSION;
+    if (stopToken.stop_requested()) {
+        co_return info;
+    }
+
+    // Compare versions
+    if (!info.latestVersion.empty()) {
+        const std::optional<SemVer> latest = SemVer::Parse(info.latestVersion);
+        if (!latest) {
+            LOG_WARNING("Update Checker: Latest release tag is not a semantic version: {}", info.latestVersion);
+        }
+        info.updateAvailable = latest && (*CURRENT_VERSION < *latest);
+
+        if (info.updateAvailable) {
+            LOG_INFO("Update Checker: Update available - {} -> {}", info.currentVersion, info.latestVersion);
+        } else {
+            LOG_INFO("Update Checker: No update available (current: {})", info.currentVersion);
+        }
+    } else {
+        LOG_ERROR("Update Checker: Could not parse latest version from response");
+    }
+
+    co_return info;
+}
+
+AsyncTask<UpdateInfo> UpdateChecker::FetchLatestRelease(UpdateChannel channel, UpdateAssetFilter filter,
+                                                        std::stop_token stopToken) {
     // C++20: Using designated initializers for clear initialization
-    UpdateInfo info{.updateAvailable = false,
-                    .latestVersion = "",
-                    .currentVersion = Version::VERSION,
-                    .releaseUrl = "",
-                    .releaseNotes = "",
-                    .downloadUrl = ""};
+    const UpdateInfo none{.updateAvailable = false,
+                          .latestVersion = "",
+                          .currentVersion = Version::VERSION,
+                          .releaseUrl = "",
+                          .releaseNotes = "",
+                          .preRelease = false,
+                          .downloadUrl = "",
+                          .downloadName = "",
+                          .downloadSize = 0,
+                          .downloadSha256 = "",
+                          .checksumUrl = "",
+                          .deltaUrl = "",
+                          .deltaName = "",
+                          .deltaSize = 0,
+                          .deltaSha256 = "",
+                          .deltaChecksumUrl = ""};
 
-    try {
-        const std::string jsonResponse = FetchLatestReleaseInfo();
+    // The stable channel wants exactly what /releases/latest returns, in one small document; the others
+    // page through the newest-first /releases list until a release on the channel turns up
+    const std::string releases = "https://api.github.com/repos/" + m_repoOwner + "/" + m_repoName + "/releases";
+    const int pages = (channel == UpdateChannel::Stable) ? 1 : MAX_RELEASE_PAGES;
+    for (int page = 1; page <= pages; ++page) {
+        HttpRequest request;
+        if (channel == UpdateChannel::Stable) {
+            request.url = releases + "/latest";
+        } else {
+            request.url = releases + "?per_page=" + std::to_string(RELEASES_PER_PAGE) + "&page=" + std::to_string(page);
+        }
+        request.userAgent = "UpdateChecker/1.0";
+        request.timeoutSeconds = 10;
+        LOG_INFO("Update Checker: Requesting URL: {}", request.url);
+
+        const HttpResponse response = co_await m_http.Get(std::move(request), stopToken);
         if (stopToken.stop_requested()) {
             LOG_INFO("Update Checker: Check cancelled by user");
-            return info;
+            co_return none;
         }
 
-        if (jsonResponse.empty()) {
-            LOG_ERROR("Update Checker: Empty response from server");
-            return info;
+        // Resumed on the HTTP I/O thread; parse on the pool so other transfers are not held up
+        co_await m_scheduler.Schedule();
+
+        if (!response.Succeeded()) {
+            LOG_ERROR("Update Checker: Request failed: {}", response.error);
+            co_return none;
         }
+        LOG_INFO("Update Checker: Response received ({} bytes)", response.body.size());
 
-        info = ParseReleaseInfo(jsonResponse);
-        info.currentVersion = Version::VERSION;
+        if (channel == UpdateChannel::Stable) {
+            co_return ParseReleaseInfo(response.body, filter);
+        }
 
-        // Compare versions
-        if (!info.latestVersion.empty()) {
-            const int cmp = CompareVersions(info.currentVersion, info.latestVersion);
-            info.updateAvailable = (cmp < 0);
+        ReleaseScan scan = ScanReleaseList(response.body, channel, filter);
+        if (scan.release) {
+            LOG_INFO("Update Checker: Found {} release after scanning {} on page {}", UpdateChannelName(channel),
+                     scan.scanned, page);
+            co_return std::move(*scan.release);
+        }
+        if (!scan.error.empty()) {
+            LOG_ERROR("Update Checker: Cannot read release list: {}", scan.error);
+            co_return none;
+        }
+        if (scan.scanned < static_cast<size_t>(RELEASES_PER_PAGE)) {
+            break; // Last page
+        }
+    }
 
-            if (info.updateAvailable) {
-                LOG_INFO("Update Checker: Update available - {} -> {}", info.currentVersion, info.latestVersion);
-            } else {
-                LOG_INFO("Update Checker: No update available (current: {})", info.currentVersion);
-            }
-        } else {
-            LOG_ERROR("Update Checker: Could not parse latest version from response");
+    LOG_INFO("Update Checker: No {} release found", UpdateChannelName(channel));
+    co_return none;
+}
+
+bool UpdateChecker::DownloadUpdateAsync(const UpdateInfo& info, std::filesystem::path directory,
+                                        UpdateDownloadProgress onProgress,
+                                        std::function<void(const UpdateDownloadResult&)> onComplete) {
+    const std::lock_guard<std::mutex> lock(m_threadMutex);
+
+    // A cancelled download still occupies the task until its request returns
+    if (m_downloading || !m_downloadTask.IsDone()) {
+        LOG_INFO("Update Checker: Download already in progress, skipping");
+        return false;
+    }
+
+    m_downloading = true;
+    m_downloadTask = m_scheduler.Spawn([this, info, directory = std::move(directory),
+                                        onProgress = std::move(onProgress),
+                                        onComplete = std::move(onComplete)](std::stop_token stopToken) {
+        return RunDownload(std::move(stopToken), info, directory, onProgress, onComplete);
+    });
+    return true;
+}
+
+AsyncTask<void> UpdateChecker::RunDownload(std::stop_token stopToken, UpdateInfo info, std::filesystem::path directory,
+                                           UpdateDownloadProgress onProgress,
+                                           std::function<void(const UpdateDownloadResult&)> onComplete) {
+    const UpdateDownloadResult result =
+        co_await DownloadUpdateCoro(std::move(info), std::move(directory), std::move(onProgress), stopToken);
+
+    m_downloading = false;
+
+    // Only invoke callback if not cancelled
+    if (!stopToken.stop_requested() && onComplete) {
+        try {
+            onComplete(result);
+        } catch (const std::exception& e) {
+            LOG_ERROR("Update Checker: Download callback threw exception: {}", e.what());
+        } catch (...) {
+            LOG_ERROR("Update Checker: Download callback threw unknown exception");
         }
-    } catch (const std::bad_alloc& e) {
-        LOG_ERROR("Update Checker: Memory allocation failed: {}", e.what());
-        info.updateAvailable = false;
-    } catch (const std::exception& e) {
-        LOG_ERROR("Update Checker: Check failed: {}", e.what());
-        info.updateAvailable = false;
-    } catch (...) {
-        LOG_ERROR("Update Checker: Unknown error during update check");
-        info.updateAvailable = false;
     }
+}
 
-    return info;
+void UpdateChecker::CancelDownload() {
+    const std::lock_guard<std::mutex> lock(m_threadMutex);
+
+    m_downloadTask.Cancel();
+    m_downloading = false;
 }
 
-// Unified cross-platform implementation using libcurl
+bool UpdateChecker::IsDownloading() const {
+    return m_downloading;
+}
 
-namespace {
-size_t WriteCallback(void* contents, size_t size, size_t nmemb, void* userp) {
-    static_cast<std::string*>(userp)->append(static_cast<char*>(contents), size * nmemb);
-    return size * nmemb;
+void UpdateChecker::SetInstalledAsset(std::filesystem::path path) {
+    const std::lock_guard<std::mutex> lock(m_settingsMutex);
+    m_installedAsset = std::move(path);
+}
+
+std::filesystem::path UpdateChecker::GetInstalledAsset() const {
+    const std::lock_guard<std::mutex> lock(m_settingsMutex);
+    return m_installedAsset;
+}
+
+void UpdateChecker::SetChannel(UpdateChannel channel) {
+    const std::lock_guard<std::mutex> lock(m_settingsMutex);
+    m_channel = channel;
+}
+
+UpdateChannel UpdateChecker::GetChannel() const {
+    const std::lock_guard<std::mutex> lock(m_settingsMutex);
+    return m_channel;
+}
+
+void UpdateChecker::SetAssetFilter(UpdateAssetFilter filter) {
+    const std::lock_guard<std::mutex> lock(m_settingsMutex);
+    m_assetFilter = std::move(filter);
 }
-} // namespace
 
-std::string UpdateChecker::FetchLatestReleaseInfo() {
-    std::string result;
+AsyncTask<std::string> UpdateChecker::FetchExpectedSha256(std::string sha256, std::string checksumUrl,
+                                                          std::stop_token stopToken) {
+    if (!sha256.empty()) {
+        co_return sha256;
+    }
+    if (checksumUrl.empty()) {
+        co_return std::string{};
+    }
 
-    // RAII-wrap CURL handle to prevent leaks on exceptions
-    const std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> curl(curl_easy_init(), curl_easy_cleanup);
-    if (!curl) {
-        return result;
+    HttpRequest request;
+    request.url = std::move(checksumUrl);
+    request.userAgent = "UpdateChecker/1.0";
+    request.timeoutSeconds = 10;
+    const HttpResponse response = co_await m_http.Get(std::move(request), stopToken);
+    if (!response.Succeeded() || response.statusCode >= 400) {
+        LOG_ERROR("Update Checker: Failed to fetch checksum: {}",
+                  response.Succeeded() ? "HTTP " + std::to_string(response.statusCode) : response.error);
+        co_return std::string{};
     }
+    co_return ParseSha256Hex(response.body);
+}
 
-    const std::string url = "https://api.github.com/repos/" + m_repoOwner + "/" + m_repoName + "/releases/latest";
+AsyncTask<UpdateDownloadResult> UpdateChecker::DownloadUpdateCoro(UpdateInfo info, std::filesystem::path directory,
+                                                                  UpdateDownloadProgress onProgress,
+                                                                  std::stop_token stopToken) {
+    UpdateDownloadResult result;
+    if (info.downloadUrl.empty() || !IsSafeFileName(info.downloadName)) {
+        result.error = "No download is available for this platform";
+        co_return result;
+    }
 
-    LOG_INFO("Update Checker: Requesting URL: {}", url);
+    // Verifying is mandatory: an unverifiable file is never offered for installation
+    const std::string expectedSha256 = co_await FetchExpectedSha256(info.downloadSha256, info.checksumUrl, stopToken);
+    co_await m_scheduler.Schedule();
+    if (stopToken.stop_requested()) {
+        result.cancelled = true;
+        result.error = "Cancelled";
+        co_return result;
+    }
+    if (expectedSha256.empty()) {
+        result.error = "No SHA-256 checksum is published for " + info.downloadName;
+        LOG_ERROR("Update Checker: {}", result.error);
+        co_return result;
+    }
 
-    curl_easy_setopt(curl.get(), CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl.get(), CURLOPT_WRITEFUNCTION, WriteCallback);
-    curl_easy_setopt(curl.get(), CURLOPT_WRITEDATA, &result);
-    curl_easy_setopt(curl.get(), CURLOPT_USERAGENT, "UpdateChecker/1.0");
-    curl_easy_setopt(curl.get(), CURLOPT_FOLLOWLOCATION, 1L);
-    curl_easy_setopt(curl.get(), CURLOPT_TIMEOUT, 10L);
-    curl_easy_setopt(curl.get(), CURLOPT_SSL_VERIFYPEER, 1L);
-    curl_easy_setopt(curl.get(), CURLOPT_SSL_VERIFYHOST, 2L);
+    std::error_code fsError;
+    std::filesystem::create_directories(directory, fsError);
+    if (fsError) {
+        result.error = "Cannot create " + directory.string() + ": " + fsError.message();
+        LOG_ERROR("Update Checker: {}", result.error);
+        co_return result;
+    }
 
-    const CURLcode res = curl_easy_perform(curl.get());
+    const std::filesystem::path target = directory / info.downloadName;
 
-    if (res != CURLE_OK) {
-        LOG_ERROR("Update Checker: Request failed: {}", curl_easy_strerror(res));
-        result.clear();
+    // A previous session may already have finished this download
+    if (Sha256 existing; HashFile(target, existing) && Sha256::ToHex(existing.Finish()) == expectedSha256) {
+        LOG_INFO("Update Checker: {} already downloaded", target.string());
+        result.succeeded = true;
+        result.file = target;
+        co_return result;
     }
 
-    LOG_INFO("Update Checker: Response received ({} bytes)", result.size());
+    // A delta is only usable against the exact file it was made from; the output hash proves that afterwards
+    const std::filesystem::path installed = GetInstalledAsset();
+    if (!info.deltaUrl.empty() && IsSafeFileName(info.deltaName) && !installed.empty() &&
+        std::filesystem::is_regular_file(installed, fsError)) {
+        result = co_await DownloadDelta(info, installed, directory, expectedSha256, onProgress, stopToken);
+        if (result.succeeded || result.cancelled) {
+            co_return result;
+        }
+        LOG_WARNING("Update Checker: Delta update failed ({}), downloading the full asset", result.error);
+    }
 
-    return result;
+    co_return co_await DownloadFile(info.downloadUrl, info.downloadSize, expectedSha256, target, onProgress,
+                                    stopToken);
 }
 
-UpdateInfo UpdateChecker::ParseReleaseInfo(const std::string& jsonResponse) {
-    UpdateInfo info;
+AsyncTask<UpdateDownloadResult> UpdateChecker::DownloadDelta(UpdateInfo info, std::filesystem::path installed,
+                                                             std::filesystem::path directory,
+                                                             std::string expectedSha256,
+                                                             UpdateDownloadProgress onProgress,
+                                                             std::stop_token stopToken) {
+    // The patch's own checksum is optional: a bad patch cannot produce output matching expectedSha256
+    const std::string patchSha256 = co_await FetchExpectedSha256(info.deltaSha256, info.deltaChecksumUrl, stopToken);
+    co_await m_scheduler.Schedule();
 
-    if (jsonResponse.empty()) {
-        LOG_ERROR("Update Checker: Empty JSON response");
-        return info;
+    const std::filesystem::path patchFile = directory / info.deltaName;
+    LOG_INFO("Update Checker: Using delta update {} ({} bytes instead of {})", info.deltaName, info.deltaSize,
+             info.downloadSize);
+    UpdateDownloadResult result =
+        co_await DownloadFile(info.deltaUrl, info.deltaSize, patchSha256, patchFile, onProgress, stopToken);
+    if (!result.succeeded) {
+        co_return result;
     }
 
-    try {
-        // Parse JSON using nlohmann/json library
-        auto j = nlohmann::json::parse(jsonResponse);
-
-        // Extract tag_name
-        if (j.contains("tag_name") && j["tag_name"].is_string()) {
-            std::string tag = j["tag_name"].get<std::string>();
-            // Remove 'v' prefix if present
-            info.latestVersion = (!tag.empty() && tag[0] == 'v') ? tag.substr(1) : tag;
-            LOG_INFO("Update Checker: Parsed version: {}", info.latestVersion);
-        } else {
-            LOG_ERROR("Update Checker: No tag_name in response");
+    const std::filesystem::path target = directory / info.downloadName;
+    std::filesystem::path patched = target;
+    patched += PATCHED_SUFFIX;
+    const BinaryPatch::Result applied = BinaryPatch::Apply(installed, patchFile, patched, stopToken);
+    result.succeeded = false;
+    result.file.clear();
+    if (stopToken.stop_requested()) {
+        // The downloaded patch is kept, so trying again only repeats the patching
+        result.cancelled = true;
+        result.error = "Cancelled";
+        co_return result;
+    }
+
+    std::error_code fsError;
+    std::filesystem::remove(patchFile, fsError);
+    if (!applied.succeeded) {
+        result.error = "Cannot apply " + info.deltaName + ": " + applied.error;
+        co_return result;
+    }
+    if (applied.sha256 != expectedSha256) {
+        std::filesystem::remove(patched, fsError);
+        result.error = "Checksum mismatch after applying " + info.deltaName;
+        co_return result;
+    }
+
+    std::filesystem::rename(patched, target, fsError);
+    if (fsError) {
+        std::filesystem::remove(patched, fsError);
+        result.error = "Cannot move patched file to " + target.string();
+        co_return result;
+    }
+
+    LOG_INFO("Update Checker: Patched and verified {}", target.string());
+    result.succeeded = true;
+    result.file = target;
+    co_return result;
+}
+
+AsyncTask<UpdateDownloadResult> UpdateChecker::DownloadFile(std::string url, uint64_t size, std::string expectedSha256,
+                                                            std::filesystem::path target,
+                                                            UpdateDownloadProgress onProgress,
+                                                            std::stop_token stopToken) {
+    UpdateDownloadResult result;
+    const std::string name = target.filename().string();
+    std::filesystem::path partial = target;
+    partial += PART_SUFFIX;
+    std::error_code fsError;
+
+    PartFileWriter writer(partial, size, onProgress);
+    for (int attempt = 1; attempt <= MAX_DOWNLOAD_ATTEMPTS && !result.succeeded; ++attempt) {
+        const std::optional<uint64_t> offset = writer.Open();
+        if (!offset) {
+            result.error = writer.GetError();
+            break;
         }
 
-        // Extract html_url
-        if (j.contains("html_url") && j["html_url"].is_string()) {
-            info.releaseUrl = j["html_url"].get<std::string>();
-            LOG_INFO("Update Checker: Release URL: {}", info.releaseUrl);
+        HttpResponse response;
+        const bool complete = size > 0 && *offset == size;
+        if (!complete) {
+            if (*offset > 0) {
+                LOG_INFO("Update Checker: Resuming download of {} at byte {}", name, *offset);
+            } else {
+                LOG_INFO("Update Checker: Downloading {}", url);
+            }
+
+            HttpRequest request;
+            request.url = url;
+            request.userAgent = "UpdateChecker/1.0";
+            request.timeoutSeconds = 0; // Large files take as long as they take; stalls are caught instead
+            request.stallTimeoutSeconds = DOWNLOAD_STALL_TIMEOUT_SECONDS;
+            request.rangeStart = *offset;
+            request.onBody = [&writer](long statusCode, std::string_view chunk) {
+                return writer.OnBody(statusCode, chunk);
+            };
+            response = co_await m_http.Get(std::move(request), stopToken);
+
+            // Resumed on the HTTP I/O thread; finish file work on the pool
+            co_await m_scheduler.Schedule();
         }
+        const bool written = writer.Close();
 
-        // Extract body (release notes)
-        if (j.contains("body") && j["body"].is_string()) {
-            info.releaseNotes = j["body"].get<std::string>();
-            LOG_INFO("Update Checker: Release notes: {} chars", info.releaseNotes.length());
+        if (stopToken.stop_requested()) {
+            LOG_INFO("Update Checker: Download cancelled, keeping {} to resume", partial.string());
+            result.cancelled = true;
+            result.error = "Cancelled";
+            break;
+        }
+        if (!written) {
+            result.error = writer.GetError();
+            writer.Discard();
+            break;
+        }
+        if (!response.Succeeded() && !complete) {
+            // Keep the partial file and continue from where the transfer stopped
+            result.error = "Download interrupted: " + response.error;
+            LOG_WARNING("Update Checker: {} (attempt {} of {})", result.error, attempt, MAX_DOWNLOAD_ATTEMPTS);
+            if (attempt < MAX_DOWNLOAD_ATTEMPTS) {
+                co_await m_scheduler.SleepFor(DOWNLOAD_RETRY_DELAY * attempt, stopToken);
+            }
+            continue;
+        }
+        if (response.statusCode == 416) {
+            // The partial file does not fit the asset on the server; start again
+            result.error = "Download could not be resumed";
+            writer.Discard();
+            continue;
+        }
+        if (response.statusCode >= 400) {
+            result.error = "Download failed: HTTP " + std::to_string(response.statusCode);
+            LOG_ERROR("Update Checker: {}", result.error);
+            break;
         }
 
-        // Extract download_url (if available)
-        if (j.contains("assets") && j["assets"].is_array() && !j["assets"].empty()) {
-            auto& firstAsset = j["assets"][0];
-            if (firstAsset.contains("browser_download_url") && firstAsset["browser_download_url"].is_string()) {
-                info.downloadUrl = firstAsset["browser_download_url"].get<std::string>();
+        // Without a published checksum (patch files) the caller verifies the result instead
+        if (const std::string actualSha256 = writer.FinishHex();
+            !expectedSha256.empty() && actualSha256 != expectedSha256) {
+            writer.Discard();
+            result.error = "Checksum mismatch for " + name;
+            LOG_ERROR("Update Checker: {}", result.error);
+            // A stale partial file can cause this, so one fresh attempt is still worthwhile
+            if (*offset > 0) {
+                continue;
             }
+            break;
         }
 
+        std::filesystem::rename(partial, target, fsError);
+        if (fsError) {
+            result.error = "Cannot move download to " + target.string() + ": " + fsError.message();
+            LOG_ERROR("Update Checker: {}", result.error);
+            break;
+        }
+
+        LOG_INFO("Update Checker: Downloaded {}", target.string());
+        result.succeeded = true;
+        result.file = target;
+        result.error.clear();
+    }
+
+    co_return result;
+}
+
+UpdateInfo UpdateChecker::ParseReleaseInfo(const std::string& jsonResponse) {
+    return ParseReleaseInfo(jsonResponse, UpdateAssetFilter::ForThisBuild());
+}
+
+UpdateInfo UpdateChecker::ParseReleaseInfo(const std::string& jsonResponse, const UpdateAssetFilter& filter) {
+    UpdateInfo info;
+
+    if (jsonResponse.empty()) {
+        LOG_ERROR("Update Checker: Empty JSON response");
+        return info;
+    }
+
+    try {
+        // Parse JSON using nlohmann/json library
+        info = ReadRelease(nlohmann::json::parse(jsonResponse), filter);
     } catch (const nlohmann::json::parse_error& e) {
         LOG_ERROR("Update Checker: JSON parse error: {} at byte {}", e.what(), e.byte);
     } catch (const nlohmann::json::type_error& e) {
@@ -240,53 +1070,25 @@ UpdateInfo UpdateChecker::ParseReleaseInfo(const std::string& jsonResponse) {
     return info;
 }
 
-int UpdateChecker::CompareVersions(const std::string& v1, const std::string& v2) {
-    auto parseVersion = [](std::string version) {
-        // Remove leading 'v' or 'V' if present
-        if (!version.empty() && (version[0] == 'v' || version[0] == 'V')) {
-            version = version.substr(1);
-        }
-
-        std::vector<int> parts;
-        std::stringstream ss(version);
-        std::string part;
-
-        while (std::getline(ss, part, '.')) {
-            // Extract numeric part only
-            std::string numStr;
-            for (const char c : part) {
-                if (std::isdigit(c) != 0) {
-                    numStr += c;
-                } else {
-                    break;
-                }
-            }
-            if (!numStr.empty()) {
-                parts.push_back(std::stoi(numStr));
-            }
-        }
-
-        // Ensure at least 3 parts (major.minor.patch)
-        while (parts.size() < 3) {
-            parts.push_back(0);
-        }
-
-        return parts;
-    };
-
-    auto parts1 = parseVersion(v1);
-    auto parts2 = parseVersion(v2);
+std::optional<UpdateInfo> UpdateChecker::FindRelease(std::string_view releaseList, UpdateChannel channel,
+                                                     const UpdateAssetFilter& filter) {
+    ReleaseScan scan = ScanReleaseList(releaseList, channel, filter);
+    if (!scan.error.empty()) {
+        LOG_ERROR("Update Checker: Cannot read release list: {}", scan.error);
+    }
+    return std::move(scan.release);
+}
 
-    for (size_t i = 0; i < (std::min)(parts1.size(), parts2.size()); ++i) {
-        if (parts1[i] < parts2[i]) {
-            return -1;
-        }
-        if (parts1[i] > parts2[i]) {
-            return 1;
-        }
+int UpdateChecker::CompareVersions(std::string_view v1, std::string_view v2) {
+    const std::optional<SemVer> a = SemVer::Parse(v1);
+    const std::optional<SemVer> b = SemVer::Parse(v2);
+    if (!a || !b) {
+        // Unparseable versions order below valid ones, so a malformed tag is never offered as an update
+        return (a ? 1 : 0) - (b ? 1 : 0);
     }
 
-    return 0;
+    const std::weak_ordering order = *a <=> *b;
+    return (order < 0) ? -1 : ((order > 0) ? 1 : 0);
 }
 
 } // namespace MetaImGUI
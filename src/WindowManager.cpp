@@ -77,6 +77,15 @@ bool WindowManager::Initialize() {
     glfwMakeContextCurrent(m_window);
     glfwSwapInterval(1); // Enable vsync
 
+    // Unchanged frames are not presented; exposed or damaged contents must be redrawn
+    glfwSetWindowRefreshCallback(m_window, WindowRefreshCallbackInternal);
+    if (GLFWmonitor* monitor = glfwGetPrimaryMonitor(); monitor != nullptr) {
+        const GLFWvidmode* mode = glfwGetVideoMode(monitor);
+        if (mode != nullptr && mode->refreshRate > 0) {
+            m_frameInterval = 1.0 / mode->refreshRate;
+        }
+    }
+
     // Print OpenGL information
     const GLubyte* version = glGetString(GL_VERSION);
     const GLubyte* vendor = glGetString(GL_VENDOR);
@@ -143,8 +152,17 @@ void WindowManager::BeginFrame() {
     int width = 0;
     int height = 0;
     glfwGetFramebufferSize(m_window, &width, &height);
+    if (width != m_width || height != m_height) {
+        m_framebufferInvalidated = true;
+    }
     m_width = width;
     m_height = height;
+}
+
+void WindowManager::PrepareFramebuffer() {
+    if (m_window == nullptr) {
+        return;
+    }
 
     glViewport(0, 0, m_width, m_height);
     glClearColor(0.45f, 0.55f, 0.60f, 1.00f);
@@ -173,6 +191,18 @@ void WindowManager::EndFrame() {
     glfwSwapBuffers(m_window);
 }
 
+bool WindowManager::ConsumeFramebufferInvalidated() {
+    const bool invalidated = m_framebufferInvalidated;
+    m_framebufferInvalidated = false;
+    return invalidated;
+}
+
+void WindowManager::WaitForNextFrame() {
+    if (m_window != nullptr) {
+        glfwWaitEventsTimeout(m_frameInterval);
+    }
+}
+
 void WindowManager::GetFramebufferSize(int& width, int& height) const {
     if (m_window != nullptr) {
         glfwGetFramebufferSize(m_window, &width, &height);
@@ -296,6 +326,7 @@ bool WindowManager::RecreateContext() {
     }
 
     LOG_INFO("OpenGL context successfully recovered");
+    m_framebufferInvalidated = true;
     m_contextRecoveryAttempts = 0; // Reset on successful recovery
     return true;
 }
@@ -327,4 +358,11 @@ void WindowManager::WindowCloseCallbackInternal(GLFWwindow* window) {
     }
 }
 
+void WindowManager::WindowRefreshCallbackInternal(GLFWwindow* window) {
+    auto* manager = static_cast<WindowManager*>(glfwGetWindowUserPointer(window));
+    if (manager != nullptr) {
+        manager->m_framebufferInvalidated = true;
+    }
+}
+
 } // namespace MetaImGUI
@@ -0,0 +1,38 @@
+#include "ActionTable.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace MetaImGUI;
+
+TEST_CASE("ActionTable dispatches bound actions by id", "[action_table]") {
+    ActionTable actions;
+    int aboutCount = 0;
+    int exitCount = 0;
+
+    SECTION("Unbound actions are no-ops") {
+        REQUIRE_FALSE(actions.IsBound(ActionId::ShowAbout));
+        actions.Invoke(ActionId::ShowAbout);
+    }
+
+    SECTION("Each id runs its own handler") {
+        actions.Bind(ActionId::ShowAbout, [&aboutCount]() { ++aboutCount; });
+        actions.Bind(ActionId::Exit, [&exitCount]() { ++exitCount; });
+        REQUIRE(actions.IsBound(ActionId::ShowAbout));
+
+        actions.Invoke(ActionId::ShowAbout);
+        actions.Invoke(ActionId::ShowAbout);
+        actions.Invoke(ActionId::Exit);
+        actions.Invoke(ActionId::CheckForUpdates);
+
+        REQUIRE(aboutCount == 2);
+        REQUIRE(exitCount == 1);
+    }
+
+    SECTION("Rebinding replaces the handler") {
+        actions.Bind(ActionId::Exit, [&exitCount]() { ++exitCount; });
+        actions.Bind(ActionId::Exit, [&aboutCount]() { ++aboutCount; });
+        actions.Invoke(ActionId::Exit);
+        REQUIRE(exitCount == 0);
+        REQUIRE(aboutCount == 1);
+    }
+}
@@ -0,0 +1,83 @@
+#include "AllocationTracker.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+#include <new>
+#include <thread>
+
+using namespace MetaImGUI;
+
+namespace {
+AllocationCounts LastFrameCounts(const char* name) {
+    for (const AllocationTracker::ScopeCounts& entry : AllocationTracker::GetLastFrameScopes()) {
+        if (std::strcmp(entry.name, name) == 0) {
+            return entry.counts;
+        }
+    }
+    return {};
+}
+
+// A plain call, unlike a new-expression, may not be optimized away
+void AllocateAndFree(size_t bytes) {
+    ::operator delete(::operator new(bytes));
+}
+} // namespace
+
+TEST_CASE("AllocationTracker counts allocations per scope and frame", "[allocation_tracker]") {
+    // The test target is built with the operator new hook
+    REQUIRE(AllocationTracker::IsEnabled());
+    AllocationTracker::EndFrame(); // Drop anything counted before the test
+
+    SECTION("The innermost scope is charged") {
+        {
+            const AllocationScope outer("Test outer");
+            AllocateAndFree(100);
+            {
+                const AllocationScope inner("Test inner");
+                AllocateAndFree(10);
+                AllocateAndFree(20);
+            }
+            AllocateAndFree(100);
+        }
+        AllocationTracker::EndFrame();
+
+        REQUIRE(LastFrameCounts("Test outer").allocations == 2);
+        REQUIRE(LastFrameCounts("Test outer").bytes == 200);
+        REQUIRE(LastFrameCounts("Test inner").allocations == 2);
+        REQUIRE(LastFrameCounts("Test inner").bytes == 30);
+        REQUIRE(AllocationTracker::GetLastFrame().allocations >= 4);
+    }
+
+    SECTION("Counting restarts each frame") {
+        {
+            const AllocationScope scope("Test outer");
+            AllocateAndFree(64);
+        }
+        AllocationTracker::EndFrame();
+        REQUIRE(LastFrameCounts("Test outer").allocations == 1);
+
+        AllocationTracker::EndFrame();
+        REQUIRE(LastFrameCounts("Test outer").allocations == 0);
+    }
+
+    SECTION("Other threads do not inherit the scope") {
+        {
+            const AllocationScope scope("Test outer");
+            std::thread([]() { AllocateAndFree(12345); }).join();
+        }
+        AllocationTracker::EndFrame();
+        REQUIRE(LastFrameCounts(AllocationTracker::UNSCOPED).bytes >= 12345);
+        REQUIRE(LastFrameCounts("Test outer").bytes < 12345);
+    }
+
+    SECTION("ImGui allocator functions are counted") {
+        {
+            const AllocationScope scope("Test inner");
+            AllocationTracker::TrackedFree(AllocationTracker::TrackedMalloc(48, nullptr), nullptr);
+        }
+        AllocationTracker::EndFrame();
+        REQUIRE(LastFrameCounts("Test inner").allocations == 1);
+        REQUIRE(LastFrameCounts("Test inner").bytes == 48);
+    }
+}
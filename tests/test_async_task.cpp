@@ -0,0 +1,179 @@
+#include "AsyncTask.h"
+#include "MainThreadDispatcher.h"
+#include "TaskScheduler.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace MetaImGUI;
+using namespace std::chrono_literals;
+
+namespace {
+AsyncTask<int> Add(int a, int b) {
+    co_return a + b;
+}
+
+AsyncTask<int64_t> Sum(int count) {
+    int64_t total = 0;
+    for (int i = 0; i < count; ++i) {
+        total += co_await Add(i, 1);
+    }
+    co_return total;
+}
+
+AsyncTask<std::string> Fail() {
+    throw std::runtime_error("coroutine failure");
+    co_return std::string{};
+}
+
+AsyncTask<void> SetFlag(bool& flag) {
+    flag = true;
+    co_return;
+}
+
+AsyncTask<std::thread::id> WorkerThreadId(TaskScheduler& scheduler) {
+    co_await scheduler.Schedule();
+    co_return std::this_thread::get_id();
+}
+} // namespace
+
+TEST_CASE("AsyncTask basics", "[async_task]") {
+    SECTION("Result is returned through chained awaits") {
+        REQUIRE(Sum(100).SyncWait() == 5050);
+    }
+
+    SECTION("Long chains of synchronously completing tasks") {
+        REQUIRE(Sum(1000).SyncWait() == 500500);
+    }
+
+    SECTION("Exceptions propagate to the awaiter") {
+        REQUIRE_THROWS_AS(Fail().SyncWait(), std::runtime_error);
+    }
+
+    SECTION("Body does not run until started") {
+        bool ran = false;
+        auto task = SetFlag(ran);
+        REQUIRE_FALSE(ran);
+        std::move(task).SyncWait();
+        REQUIRE(ran);
+    }
+
+    SECTION("Start reports completion and exceptions") {
+        bool completed = false;
+        std::exception_ptr failure;
+        Add(1, 2).Start([&](std::exception_ptr exception) {
+            completed = true;
+            failure = exception;
+        });
+        REQUIRE(completed);
+        REQUIRE(failure == nullptr);
+
+        Fail().Start([&](std::exception_ptr exception) { failure = exception; });
+        REQUIRE(failure != nullptr);
+    }
+}
+
+TEST_CASE("AsyncTask executors", "[async_task]") {
+    TaskScheduler scheduler(2);
+
+    SECTION("Schedule continues on a worker") {
+        const auto workerId = WorkerThreadId(scheduler).SyncWait();
+        REQUIRE(workerId != std::this_thread::get_id());
+    }
+
+    SECTION("SleepFor waits without blocking and ends early on stop") {
+        const auto start = std::chrono::steady_clock::now();
+        [&]() -> AsyncTask<void> { co_await scheduler.SleepFor(20ms); }().SyncWait();
+        REQUIRE(std::chrono::steady_clock::now() - start >= 20ms);
+
+        std::stop_source stopSource;
+        std::atomic<bool> woke{false};
+        std::thread stopper([&] {
+            std::this_thread::sleep_for(20ms);
+            stopSource.request_stop();
+        });
+        const auto sleepStart = std::chrono::steady_clock::now();
+        [&]() -> AsyncTask<void> {
+            co_await scheduler.SleepFor(1h, stopSource.get_token());
+            woke = true;
+        }().SyncWait();
+        stopper.join();
+        REQUIRE(woke);
+        REQUIRE(std::chrono::steady_clock::now() - sleepStart < 10s);
+    }
+
+    SECTION("Spawned coroutine completes its handle and sees cancellation") {
+        std::atomic<int> iterations{0};
+        auto handle = scheduler.Spawn([&](std::stop_token stopToken) -> AsyncTask<void> {
+            while (!stopToken.stop_requested()) {
+                ++iterations;
+                co_await scheduler.SleepFor(1ms, stopToken);
+            }
+        });
+        while (iterations < 3) {
+            std::this_thread::sleep_for(1ms);
+        }
+        REQUIRE_FALSE(handle.IsDone());
+        handle.Cancel();
+        handle.Wait();
+        REQUIRE(handle.IsDone());
+    }
+
+    SECTION("Main thread dispatcher resumes during Drain") {
+        MainThreadDispatcher dispatcher;
+        std::atomic<bool> resumed{false};
+        std::thread::id resumedOn;
+
+        bool scheduled = false;
+
+        auto handle = scheduler.Spawn([&](std::stop_token) -> AsyncTask<void> {
+            scheduled = co_await dispatcher.Schedule();
+            resumedOn = std::this_thread::get_id();
+            resumed = true;
+        });
+
+        while (!resumed) {
+            dispatcher.Drain(std::chrono::milliseconds(1));
+            std::this_thread::yield();
+        }
+        handle.Wait();
+        REQUIRE(scheduled);
+        REQUIRE(resumedOn == std::this_thread::get_id());
+    }
+
+    SECTION("Main thread dispatcher continues inline when its queue is full") {
+        MainThreadDispatcher dispatcher(2);
+        REQUIRE(dispatcher.Post([] {}));
+        REQUIRE(dispatcher.Post([] {}));
+        std::atomic<bool> scheduled{true};
+        std::thread::id resumedOn;
+
+        // Nothing drains the queue, so waiting for room would never finish
+        auto handle = scheduler.Spawn([&](std::stop_token) -> AsyncTask<void> {
+            scheduled = co_await dispatcher.Schedule();
+            resumedOn = std::this_thread::get_id();
+        });
+        handle.Wait();
+        REQUIRE_FALSE(scheduled);
+        REQUIRE(resumedOn != std::this_thread::get_id());
+        REQUIRE(dispatcher.GetDroppedCount() == 0);
+    }
+
+    SECTION("Coroutines waiting on a shut down scheduler still finish") {
+        std::atomic<bool> finished{false};
+        auto handle = scheduler.Spawn([&](std::stop_token) -> AsyncTask<void> {
+            co_await scheduler.SleepFor(1h);
+            finished = true;
+        });
+        std::this_thread::sleep_for(10ms); // Let the coroutine park on its timer
+        scheduler.Shutdown();
+        handle.Wait();
+        REQUIRE(finished);
+    }
+}
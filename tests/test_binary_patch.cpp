@@ -0,0 +1,185 @@
+#include "BinaryPatch.h"
+#include "Sha256.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <bzlib.h>
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace MetaImGUI;
+
+namespace {
+// {diff bytes, extra bytes, old file seek} as in a bsdiff control record
+using Control = std::array<int64_t, 3>;
+
+void AppendOfftout(std::string& out, int64_t value) {
+    uint64_t magnitude = (value < 0) ? static_cast<uint64_t>(-value) : static_cast<uint64_t>(value);
+    if (value < 0) {
+        magnitude |= uint64_t{1} << 63;
+    }
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<char>(magnitude >> (8 * i)));
+    }
+}
+
+std::string Compress(std::string data) {
+    std::vector<char> out(data.size() + data.size() / 100 + 600);
+    auto length = static_cast<unsigned int>(out.size());
+    BZ2_bzBuffToBuffCompress(out.data(), &length, data.data(), static_cast<unsigned int>(data.size()), 9, 0, 0);
+    return {out.data(), length};
+}
+
+// Writes a BSDIFF40 patch turning oldData into newData with the given control records
+std::string MakePatch(const std::string& oldData, const std::string& newData, const std::vector<Control>& controls) {
+    std::string control;
+    std::string diff;
+    std::string extra;
+    int64_t oldPosition = 0;
+    size_t newPosition = 0;
+    for (const auto& [diffCount, extraCount, seek] : controls) {
+        AppendOfftout(control, diffCount);
+        AppendOfftout(control, extraCount);
+        AppendOfftout(control, seek);
+        for (int64_t i = 0; i < diffCount; ++i, ++oldPosition, ++newPosition) {
+            const bool inOld = oldPosition >= 0 && oldPosition < static_cast<int64_t>(oldData.size());
+            const auto oldByte = inOld ? static_cast<unsigned char>(oldData[static_cast<size_t>(oldPosition)]) : 0;
+            diff.push_back(static_cast<char>(static_cast<unsigned char>(newData[newPosition]) - oldByte));
+        }
+        extra += newData.substr(newPosition, static_cast<size_t>(extraCount));
+        newPosition += static_cast<size_t>(extraCount);
+        oldPosition += seek;
+    }
+
+    const std::string controlBlock = Compress(control);
+    const std::string diffBlock = Compress(diff);
+    std::string patch = "BSDIFF40";
+    AppendOfftout(patch, static_cast<int64_t>(controlBlock.size()));
+    AppendOfftout(patch, static_cast<int64_t>(diffBlock.size()));
+    AppendOfftout(patch, static_cast<int64_t>(newData.size()));
+    return patch + controlBlock + diffBlock + Compress(extra);
+}
+
+void WriteFile(const std::filesystem::path& path, const std::string& contents) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << contents;
+}
+
+std::string ReadFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+} // namespace
+
+TEST_CASE("BinaryPatch applies bsdiff patches", "[binary_patch]") {
+    const auto dir = std::filesystem::temp_directory_path() / "metaimgui_test_binary_patch";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const auto oldPath = dir / "old.bin";
+    const auto patchPath = dir / "update.bsdiff";
+    const auto newPath = dir / "new.bin";
+
+    SECTION("Diff, extra and backward seeks reconstruct the new file") {
+        const std::string oldData = "The quick brown fox jumps over the lazy dog";
+        const std::string newData = "The quick red fox jumps over the lazy cat, the quick red fox";
+        WriteFile(oldPath, oldData);
+        WriteFile(patchPath, MakePatch(oldData, newData, {{41, 4, -41}, {15, 0, 0}}));
+
+        const BinaryPatch::Result result = BinaryPatch::Apply(oldPath, patchPath, newPath);
+        REQUIRE(result.succeeded);
+        REQUIRE(ReadFile(newPath) == newData);
+        REQUIRE(result.size == newData.size());
+        REQUIRE(result.sha256 == Sha256::HashHex(newData));
+    }
+
+    SECTION("Files larger than the buffers stream through") {
+        std::string oldData(3 * BinaryPatch::BUFFER_SIZE + 123, '\0');
+        for (size_t i = 0; i < oldData.size(); ++i) {
+            oldData[i] = static_cast<char>(i * 2654435761u >> 24);
+        }
+        std::string newData = oldData;
+        for (size_t i = 0; i < newData.size(); i += 1000) {
+            newData[i] = static_cast<char>(newData[i] + 1);
+        }
+        newData += std::string(BinaryPatch::BUFFER_SIZE + 7, 'x');
+        WriteFile(oldPath, oldData);
+        WriteFile(patchPath, MakePatch(oldData, newData,
+                                       {{static_cast<int64_t>(oldData.size()), BinaryPatch::BUFFER_SIZE + 7, 0}}));
+
+        const BinaryPatch::Result result = BinaryPatch::Apply(oldPath, patchPath, newPath);
+        REQUIRE(result.succeeded);
+        REQUIRE(result.sha256 == Sha256::HashHex(newData));
+    }
+
+    SECTION("Reads outside the old file count as zero bytes") {
+        const std::string oldData = "abc";
+        const std::string newData = "abcdefgh";
+        WriteFile(oldPath, oldData);
+        WriteFile(patchPath, MakePatch(oldData, newData, {{8, 0, 0}}));
+
+        const BinaryPatch::Result result = BinaryPatch::Apply(oldPath, patchPath, newPath);
+        REQUIRE(result.succeeded);
+        REQUIRE(ReadFile(newPath) == newData);
+    }
+
+    SECTION("Malformed patches fail without leaving output") {
+        const std::string oldData = "old contents";
+        const std::string newData = "new contents!";
+        WriteFile(oldPath, oldData);
+        const std::string patch = MakePatch(oldData, newData, {{12, 1, 0}});
+
+        WriteFile(patchPath, "BSDIFF41" + patch.substr(8));
+        REQUIRE_FALSE(BinaryPatch::Apply(oldPath, patchPath, newPath).succeeded);
+
+        // Truncated: the extra section is missing
+        WriteFile(patchPath, patch.substr(0, patch.size() - Compress("!").size()));
+        REQUIRE_FALSE(BinaryPatch::Apply(oldPath, patchPath, newPath).succeeded);
+        REQUIRE_FALSE(std::filesystem::exists(newPath));
+
+        // A control record claiming more output than the header declares
+        WriteFile(patchPath, MakePatch(oldData, newData + "!", {{12, 2, 0}}).replace(24, 8, patch.substr(24, 8)));
+        const BinaryPatch::Result result = BinaryPatch::Apply(oldPath, patchPath, newPath);
+        REQUIRE_FALSE(result.succeeded);
+        REQUIRE_FALSE(result.error.empty());
+        REQUIRE_FALSE(std::filesystem::exists(newPath));
+    }
+
+    SECTION("Seeks outside the reachable old file range are rejected") {
+        const std::string oldData = "old contents";
+        const std::string newData = "new contents";
+        WriteFile(oldPath, oldData);
+
+        // Past the end by more than the new file could ever read, then another diff from there
+        const int64_t farSeek = std::numeric_limits<int64_t>::max() - 100;
+        WriteFile(patchPath, MakePatch(oldData, newData, {{4, 0, farSeek}, {8, 0, 0}}));
+        REQUIRE_FALSE(BinaryPatch::Apply(oldPath, patchPath, newPath).succeeded);
+        REQUIRE_FALSE(std::filesystem::exists(newPath));
+
+        const int64_t beforeStart = -static_cast<int64_t>(newData.size()) - 5; // Lands below -newSize
+        WriteFile(patchPath, MakePatch(oldData, newData, {{4, 0, beforeStart}, {8, 0, 0}}));
+        REQUIRE_FALSE(BinaryPatch::Apply(oldPath, patchPath, newPath).succeeded);
+
+        // Within range, even outside the old file, is still valid bsdiff
+        WriteFile(patchPath, MakePatch(oldData, newData, {{4, 0, -10}, {8, 0, 0}}));
+        REQUIRE(BinaryPatch::Apply(oldPath, patchPath, newPath).succeeded);
+        REQUIRE(ReadFile(newPath) == newData);
+    }
+
+    SECTION("Cancellation abandons the output") {
+        WriteFile(oldPath, "old");
+        WriteFile(patchPath, MakePatch("old", "new", {{3, 0, 0}}));
+        std::stop_source stopSource;
+        stopSource.request_stop();
+        const BinaryPatch::Result result = BinaryPatch::Apply(oldPath, patchPath, newPath, stopSource.get_token());
+        REQUIRE(result.error == "Cancelled");
+        REQUIRE_FALSE(std::filesystem::exists(newPath));
+    }
+
+    std::filesystem::remove_all(dir);
+}
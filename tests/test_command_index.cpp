@@ -0,0 +1,116 @@
+#include "CommandIndex.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace MetaImGUI;
+
+namespace {
+std::vector<uint32_t> Commands(const CommandSearch& search) {
+    std::vector<uint32_t> commands;
+    for (const CommandSearch::Result& result : search.GetResults()) {
+        commands.push_back(result.command);
+    }
+    return commands;
+}
+} // namespace
+
+TEST_CASE("CommandIndex matches queries as subsequences", "[command_index]") {
+    const CommandIndex index({"Show Demo Window", "File: Exit", "Theme: Dark", "checkForUpdates"});
+
+    SECTION("Characters must appear in order, case-insensitively") {
+        REQUIRE(index.Score(0, "sdw") > 0);
+        REQUIRE(index.Score(0, "showdemo") > 0);
+        REQUIRE(index.Score(0, "dsw") == 0);
+        REQUIRE(index.Score(1, "exit") > 0);
+        REQUIRE(index.Score(1, "exits") == 0);
+    }
+
+    SECTION("Word starts, runs and the label start score higher") {
+        REQUIRE(index.Score(0, "dw") > index.Score(0, "ew"));   // D-emo W-indow over d-E-mo W-indow
+        REQUIRE(index.Score(0, "demo") > index.Score(0, "dmo")); // One run over a gap
+        REQUIRE(index.Score(0, "sho") > index.Score(0, "how"));  // Label start
+        REQUIRE(index.Score(3, "cfu") > index.Score(3, "cku"));  // camelCase humps are word starts
+    }
+
+    SECTION("Queries fold case and ignore spaces") {
+        REQUIRE(CommandIndex::FoldQuery("Theme Dark") == "themedark");
+        REQUIRE(index.Score(2, CommandIndex::FoldQuery("Theme Dark")) > 0);
+    }
+
+    SECTION("The character mask prefilter only drops labels that cannot match") {
+        std::vector<uint32_t> candidates;
+        index.Prefilter(CommandIndex::CharacterMask("xt"), candidates);
+        REQUIRE(candidates == std::vector<uint32_t>{1});
+
+        candidates.clear();
+        index.Prefilter(CommandIndex::CharacterMask("k"), candidates);
+        REQUIRE(candidates == std::vector<uint32_t>{2, 3});
+    }
+}
+
+TEST_CASE("CommandSearch ranks and narrows incrementally", "[command_index]") {
+    std::vector<std::string> labels = {"View: Show Demo Window", "View: Performance", "File: Exit",
+                                       "Theme: Dark",            "Theme: Light",      "Language: Deutsch"};
+    for (int i = 0; i < 200; ++i) {
+        labels.push_back("Filler entry " + std::to_string(i));
+    }
+    CommandSearch search;
+    search.SetIndex(std::make_shared<const CommandIndex>(labels));
+
+    SECTION("An empty query lists every command in order") {
+        REQUIRE(search.GetResults().size() == labels.size());
+        REQUIRE(search.GetResults()[3].command == 3);
+    }
+
+    SECTION("Results are ordered by score") {
+        search.SetQuery("dark");
+        REQUIRE(Commands(search) == std::vector<uint32_t>{3});
+
+        search.SetQuery("d");
+        REQUIRE(search.GetResults().size() == 3);
+        REQUIRE(search.GetResults()[0].command == 0); // "D" of Demo: word start
+        REQUIRE(search.GetResults()[0].score >= search.GetResults()[1].score);
+    }
+
+    SECTION("Typing more re-scores only the previous results") {
+        search.SetQuery("th");
+        const size_t previous = search.GetResults().size();
+        REQUIRE(previous == 3); // Both themes and "Language: Deutsch"
+
+        search.SetQuery("thl");
+        REQUIRE(search.GetScoredCount() == previous);
+        REQUIRE(Commands(search) == std::vector<uint32_t>{4});
+
+        // Editing the middle of the query is not narrowing: the whole index is prefiltered again
+        search.SetQuery("tdl");
+        REQUIRE(search.GetScoredCount() > 0);
+        REQUIRE(search.GetResults().empty());
+
+        search.SetQuery("t");
+        REQUIRE(search.GetResults().size() > previous);
+    }
+
+    SECTION("Narrowing gives the same results as a fresh search") {
+        search.SetQuery("f");
+        search.SetQuery("fe");
+        search.SetQuery("fe1");
+        search.SetQuery("fe 19");
+
+        CommandSearch fresh;
+        fresh.SetIndex(search.GetIndex());
+        fresh.SetQuery("FE19");
+        REQUIRE(Commands(search) == Commands(fresh));
+        REQUIRE(search.GetResults().size() == 20); // 19, 109-189 by tens, 190-199
+    }
+
+    SECTION("A replaced index keeps the query") {
+        search.SetQuery("dark");
+        search.SetIndex(std::make_shared<const CommandIndex>(std::vector<std::string>{"Tema: Oscuro", "Dark"}));
+        REQUIRE(Commands(search) == std::vector<uint32_t>{1});
+    }
+}
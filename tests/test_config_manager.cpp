@@ -94,6 +94,13 @@ TEST_CASE("ConfigManager numeric settings", "[config]") {
         REQUIRE(value.value() == 42);
     }
 
+    SECTION("64-bit integer values work correctly") {
+        config.SetInt64("timestamp_key", int64_t{4102444800}); // Beyond the 32-bit range
+        auto value = config.GetInt64("timestamp_key");
+        REQUIRE(value.has_value());
+        REQUIRE(value.value() == 4102444800);
+    }
+
     SECTION("Boolean values work correctly") {
         config.SetBool("bool_key", true);
         auto value = config.GetBool("bool_key");
@@ -0,0 +1,64 @@
+#include "DrawBatcher.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+using namespace MetaImGUI;
+
+TEST_CASE("DrawBatcher merges commands sharing a texture", "[draw_batcher]") {
+    DrawBatcher batcher;
+
+    SECTION("Contiguous commands on one texture become one range") {
+        batcher.Add(1, 0, 6, 0);
+        batcher.Add(1, 6, 12, 0);
+        batcher.Add(1, 18, 3, 0);
+
+        REQUIRE(batcher.GetCommandCount() == 3);
+        REQUIRE(batcher.GetBatches().size() == 1);
+        REQUIRE(batcher.GetBatches()[0].rangeCount == 1);
+        REQUIRE(batcher.GetCounts() == std::vector<int32_t>{21});
+        REQUIRE(batcher.GetFirstIndices() == std::vector<size_t>{0});
+    }
+
+    SECTION("Commands from different lists stay separate ranges of one batch") {
+        batcher.Add(1, 0, 6, 0);
+        batcher.Add(1, 6, 6, 4);  // Next list: new base vertex
+        batcher.Add(1, 20, 3, 4); // Gap in the indices
+
+        REQUIRE(batcher.GetBatches().size() == 1);
+        REQUIRE(batcher.GetBatches()[0].rangeCount == 3);
+        REQUIRE(batcher.GetCounts() == std::vector<int32_t>{6, 6, 3});
+        REQUIRE(batcher.GetFirstIndices() == std::vector<size_t>{0, 6, 20});
+        REQUIRE(batcher.GetBaseVertices() == std::vector<int32_t>{0, 4, 4});
+    }
+
+    SECTION("A texture change starts a new batch and order is kept") {
+        batcher.Add(1, 0, 6, 0);
+        batcher.Add(2, 6, 6, 0);
+        batcher.Add(1, 12, 6, 0);
+
+        const auto& batches = batcher.GetBatches();
+        REQUIRE(batches.size() == 3);
+        REQUIRE(batches[0].texture == 1);
+        REQUIRE(batches[1].texture == 2);
+        REQUIRE(batches[2].texture == 1);
+        REQUIRE(batches[2].firstRange == 2);
+        REQUIRE(batches[2].rangeCount == 1);
+    }
+
+    SECTION("Empty commands are ignored") {
+        batcher.Add(1, 0, 0, 0);
+        REQUIRE(batcher.IsEmpty());
+        REQUIRE(batcher.GetCommandCount() == 0);
+    }
+
+    SECTION("Reset clears batches for the next frame") {
+        batcher.Add(1, 0, 6, 0);
+        batcher.Reset();
+        REQUIRE(batcher.IsEmpty());
+        REQUIRE(batcher.GetCounts().empty());
+        batcher.Add(3, 0, 3, 0);
+        REQUIRE(batcher.GetBatches()[0].firstRange == 0);
+    }
+}
@@ -0,0 +1,65 @@
+#include "FrameArena.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+using namespace MetaImGUI;
+
+TEST_CASE("FrameArena bump-allocates frame scratch memory", "[frame_arena]") {
+    FrameArena arena(1024);
+
+    SECTION("Allocations are aligned and come from the arena") {
+        void* first = arena.allocate(3, 1);
+        void* second = arena.allocate(8, 8);
+        void* wide = arena.allocate(64, 64);
+        REQUIRE(first != second);
+        REQUIRE(reinterpret_cast<uintptr_t>(second) % 8 == 0);
+        REQUIRE(reinterpret_cast<uintptr_t>(wide) % 64 == 0);
+        REQUIRE(arena.GetBytesUsed() >= 3 + 8 + 64);
+        REQUIRE(arena.GetHeapAllocations() == 0);
+    }
+
+    SECTION("pmr containers use the arena") {
+        std::pmr::vector<double> values(&arena);
+        values.resize(16, 1.5);
+        std::pmr::string label(&arena);
+        label = "a label long enough to leave the small string buffer";
+        REQUIRE(arena.GetBytesUsed() >= 16 * sizeof(double) + label.size());
+        REQUIRE(arena.GetHeapAllocations() == 0);
+    }
+
+    SECTION("Reset rewinds and records the frame") {
+        const void* first = arena.allocate(100, 8);
+        arena.Reset();
+        REQUIRE(arena.GetBytesUsed() == 0);
+        REQUIRE(arena.GetLastFrameBytes() >= 100);
+        REQUIRE(arena.allocate(100, 8) == first);
+    }
+
+    SECTION("A spilling frame is merged so the next one fits without the heap") {
+        for (int i = 0; i < 4; ++i) {
+            (void)arena.allocate(512, 8);
+        }
+        REQUIRE(arena.GetHeapAllocations() > 0);
+        const size_t capacity = arena.GetCapacity();
+
+        arena.Reset();
+        REQUIRE(arena.GetLastFrameHeapAllocations() > 0);
+        REQUIRE(arena.GetCapacity() == capacity);
+        for (int i = 0; i < 4; ++i) {
+            (void)arena.allocate(512, 8);
+        }
+        REQUIRE(arena.GetHeapAllocations() == 0);
+        REQUIRE(arena.GetPeakBytes() >= 4 * 512);
+    }
+
+    SECTION("Requests larger than a chunk get their own") {
+        void* big = arena.allocate(10000, 16);
+        REQUIRE(big != nullptr);
+        REQUIRE(arena.GetCapacity() >= 1024 + 10000);
+    }
+}
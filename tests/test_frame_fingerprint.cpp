@@ -0,0 +1,87 @@
+#include "FrameFingerprint.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <numeric>
+#include <vector>
+
+using namespace MetaImGUI;
+
+namespace {
+uint64_t HashOf(const std::vector<unsigned char>& bytes) {
+    FrameHasher hasher;
+    hasher.Add(bytes.data(), bytes.size());
+    return hasher.Finish();
+}
+} // namespace
+
+TEST_CASE("FrameHasher fingerprints byte ranges", "[frame_fingerprint]") {
+    std::vector<unsigned char> vertices(1000);
+    std::iota(vertices.begin(), vertices.end(), static_cast<unsigned char>(0));
+
+    SECTION("Equal input hashes equal") {
+        REQUIRE(HashOf(vertices) == HashOf(vertices));
+        REQUIRE(FrameHasher().Finish() == FrameHasher().Finish());
+    }
+
+    SECTION("A change to any byte changes the hash") {
+        const uint64_t original = HashOf(vertices);
+        for (const size_t position : {size_t{0}, size_t{31}, size_t{32}, size_t{500}, size_t{999}}) {
+            std::vector<unsigned char> changed = vertices;
+            changed[position] ^= 1;
+            REQUIRE(HashOf(changed) != original);
+        }
+    }
+
+    SECTION("Lengths and boundaries are part of the hash") {
+        std::vector<unsigned char> longer = vertices;
+        longer.push_back(0);
+        REQUIRE(HashOf(longer) != HashOf(vertices));
+
+        FrameHasher split;
+        split.Add(vertices.data(), 10);
+        split.Add(vertices.data() + 10, vertices.size() - 10);
+        FrameHasher otherSplit;
+        otherSplit.Add(vertices.data(), 11);
+        otherSplit.Add(vertices.data() + 11, vertices.size() - 11);
+        REQUIRE(split.Finish() != otherSplit.Finish());
+    }
+
+    SECTION("Values are hashed by their bytes") {
+        FrameHasher first;
+        first.AddValue(1.5f);
+        first.AddValue(uint32_t{7});
+        FrameHasher second;
+        second.AddValue(1.5f);
+        second.AddValue(uint32_t{8});
+        REQUIRE(first.Finish() != second.Finish());
+    }
+}
+
+TEST_CASE("PresentGate skips frames identical to the one on screen", "[frame_fingerprint]") {
+    PresentGate gate;
+
+    SECTION("The first frame is always presented") {
+        REQUIRE(gate.ShouldPresent(42));
+        REQUIRE(gate.GetPresentedFrames() == 1);
+    }
+
+    SECTION("Repeated fingerprints are skipped until one changes") {
+        REQUIRE(gate.ShouldPresent(42));
+        REQUIRE_FALSE(gate.ShouldPresent(42));
+        REQUIRE_FALSE(gate.ShouldPresent(42));
+        REQUIRE(gate.ShouldPresent(43));
+        REQUIRE_FALSE(gate.ShouldPresent(43));
+        REQUIRE(gate.GetPresentedFrames() == 2);
+        REQUIRE(gate.GetSkippedFrames() == 3);
+    }
+
+    SECTION("Invalidation and forced frames present an unchanged frame") {
+        REQUIRE(gate.ShouldPresent(42));
+        gate.Invalidate();
+        REQUIRE(gate.ShouldPresent(42));
+        REQUIRE_FALSE(gate.ShouldPresent(42));
+        REQUIRE(gate.ShouldPresent(42, true));
+        REQUIRE_FALSE(gate.ShouldPresent(42));
+    }
+}
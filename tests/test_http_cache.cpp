@@ -0,0 +1,178 @@
+#include "HttpCache.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace MetaImGUI;
+
+namespace {
+const std::string URL = "https://api.example.com/releases/latest";
+
+HttpResponse Response(std::string body, std::map<std::string, std::string> headers) {
+    HttpResponse response;
+    response.statusCode = 200;
+    response.body = std::move(body);
+    response.headers = std::move(headers);
+    return response;
+}
+
+std::filesystem::path TempCacheDir() {
+    const auto dir = std::filesystem::temp_directory_path() / "metaimgui_test_http_cache";
+    std::filesystem::remove_all(dir);
+    return dir;
+}
+} // namespace
+
+TEST_CASE("HttpCache freshness from Cache-Control", "[http_cache]") {
+    const auto now = HttpCache::Clock::now();
+
+    SECTION("max-age sets the lifetime, less Age") {
+        const auto freshUntil =
+            HttpCache::ComputeFreshUntil(Response("", {{"cache-control", "public, max-age=60"}, {"age", "10"}}), now);
+        REQUIRE(freshUntil.has_value());
+        REQUIRE(*freshUntil == now + std::chrono::seconds(50));
+    }
+
+    SECTION("no-cache and missing max-age always revalidate") {
+        REQUIRE(HttpCache::ComputeFreshUntil(Response("", {{"cache-control", "no-cache, max-age=60"}}), now) ==
+                HttpCache::Clock::time_point{});
+        REQUIRE(HttpCache::ComputeFreshUntil(Response("", {}), now) == HttpCache::Clock::time_point{});
+    }
+
+    SECTION("no-store is never stored") {
+        REQUIRE_FALSE(HttpCache::ComputeFreshUntil(Response("", {{"cache-control", "No-Store"}}), now).has_value());
+    }
+}
+
+TEST_CASE("HttpCache stores and revalidates entries", "[http_cache]") {
+    HttpCache cache;
+
+    SECTION("Responses without validators or lifetime are not stored") {
+        REQUIRE_FALSE(cache.Store(URL, Response("body", {})));
+        REQUIRE_FALSE(cache.Lookup(URL).has_value());
+    }
+
+    SECTION("Errors and non-200 responses are not stored") {
+        HttpResponse notFound = Response("missing", {{"etag", "\"a\""}});
+        notFound.statusCode = 404;
+        REQUIRE_FALSE(cache.Store(URL, notFound));
+    }
+
+    SECTION("Stale entries supply conditional headers") {
+        REQUIRE(cache.Store(URL, Response("v1", {{"etag", "W/\"abc\""}, {"last-modified", "Tue, 01 Sep 2026"}})));
+
+        const auto entry = cache.Lookup(URL);
+        REQUIRE(entry.has_value());
+        REQUIRE_FALSE(entry->IsFresh(HttpCache::Clock::now()));
+
+        std::vector<std::string> headers;
+        entry->AddConditionalHeaders(headers);
+        REQUIRE(headers == std::vector<std::string>{"If-None-Match: W/\"abc\"",
+                                                    "If-Modified-Since: Tue, 01 Sep 2026"});
+    }
+
+    SECTION("A 304 refreshes the lifetime and keeps the body") {
+        REQUIRE(cache.Store(URL, Response("v1", {{"etag", "\"a\""}})));
+
+        HttpResponse notModified;
+        notModified.statusCode = 304;
+        notModified.headers = {{"cache-control", "max-age=60"}, {"etag", "\"b\""}};
+        const auto refreshed = cache.Revalidate(URL, notModified);
+
+        REQUIRE(refreshed.has_value());
+        REQUIRE(refreshed->body == "v1");
+        REQUIRE(refreshed->etag == "\"b\"");
+        REQUIRE(refreshed->IsFresh(HttpCache::Clock::now()));
+
+        const HttpResponse response = refreshed->ToResponse();
+        REQUIRE(response.statusCode == 200);
+        REQUIRE(response.fromCache);
+        REQUIRE(cache.GetStats().revalidated == 1);
+    }
+
+    SECTION("Memory is bounded by evicting the least recently used entry") {
+        for (size_t i = 0; i <= HttpCache::MAX_MEMORY_ENTRIES; ++i) {
+            cache.Store(URL + std::to_string(i), Response("v", {{"etag", "\"e\""}}));
+            (void)cache.Lookup(URL + "0"); // Keep the first entry hot
+        }
+        REQUIRE(cache.GetMemoryEntryCount() == HttpCache::MAX_MEMORY_ENTRIES);
+        REQUIRE(cache.Lookup(URL + "0").has_value());
+        REQUIRE_FALSE(cache.Lookup(URL + "1").has_value());
+    }
+}
+
+TEST_CASE("HttpCache persists entries on disk", "[http_cache]") {
+    const auto dir = TempCacheDir();
+
+    {
+        HttpCache cache(dir);
+        REQUIRE(cache.Store(URL, Response("persisted", {{"etag", "\"p\""}, {"cache-control", "max-age=3600"}})));
+    }
+
+    HttpCache reloaded(dir);
+    const auto entry = reloaded.Lookup(URL);
+    REQUIRE(entry.has_value());
+    REQUIRE(entry->body == "persisted");
+    REQUIRE(entry->etag == "\"p\"");
+    REQUIRE(entry->IsFresh(HttpCache::Clock::now()));
+    REQUIRE(reloaded.GetStats().freshHits == 1);
+
+    reloaded.Clear();
+    REQUIRE_FALSE(HttpCache(dir).Lookup(URL).has_value());
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("HttpCache writes bodies and metadata separately", "[http_cache]") {
+    const auto dir = TempCacheDir();
+    const auto findFile = [&dir](const std::string& extension) {
+        for (const auto& file : std::filesystem::directory_iterator(dir)) {
+            if (file.path().extension() == extension) {
+                return file.path();
+            }
+        }
+        return std::filesystem::path{};
+    };
+
+    HttpCache cache(dir);
+    REQUIRE(cache.Store(URL, Response("release document", {{"etag", "\"a\""}})));
+    cache.Flush();
+    const std::filesystem::path body = findFile(".body");
+    REQUIRE_FALSE(body.empty());
+    REQUIRE_FALSE(findFile(".json").empty());
+
+    SECTION("A 304 rewrites only the metadata") {
+        const auto marker = std::filesystem::file_time_type::clock::now() - std::chrono::hours(24);
+        std::filesystem::last_write_time(body, marker);
+
+        HttpResponse notModified;
+        notModified.statusCode = 304;
+        notModified.headers = {{"cache-control", "max-age=60"}};
+        REQUIRE(cache.Revalidate(URL, notModified).has_value());
+        cache.Flush();
+        REQUIRE(std::filesystem::last_write_time(body) == marker);
+
+        const auto entry = HttpCache(dir).Lookup(URL);
+        REQUIRE(entry.has_value());
+        REQUIRE(entry->body == "release document");
+        REQUIRE(entry->IsFresh(HttpCache::Clock::now()));
+    }
+
+    SECTION("A body that does not match its metadata is ignored") {
+        std::ofstream(body, std::ios::binary | std::ios::trunc) << "release documenT";
+        REQUIRE_FALSE(HttpCache(dir).Lookup(URL).has_value());
+    }
+
+    SECTION("Clear removes both files") {
+        cache.Clear();
+        REQUIRE(findFile(".body").empty());
+        REQUIRE(findFile(".json").empty());
+    }
+
+    std::filesystem::remove_all(dir);
+}
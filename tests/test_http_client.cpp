@@ -0,0 +1,158 @@
+#include "HttpClient.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+using namespace MetaImGUI;
+
+namespace {
+// file:// URLs exercise the multi-handle path without network access
+std::string FileUrl(const std::filesystem::path& path) {
+    return "file://" + path.generic_string();
+}
+
+HttpRequest Request(std::string url) {
+    HttpRequest request;
+    request.url = std::move(url);
+    return request;
+}
+
+AsyncTask<void> FetchAndCount(HttpClient& client, std::string url, std::atomic<int>& completed,
+                              std::atomic<int>& succeeded) {
+    const HttpResponse response = co_await client.Get(Request(std::move(url)));
+    if (response.Succeeded() && !response.body.empty()) {
+        ++succeeded;
+    }
+    ++completed;
+}
+
+#ifndef _WIN32
+// Accepts connections (via the kernel backlog) but never answers, keeping transfers in flight
+class SilentServer {
+public:
+    SilentServer() : m_fd(socket(AF_INET, SOCK_STREAM, 0)) {
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        bind(m_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        listen(m_fd, SOMAXCONN);
+        getsockname(m_fd, reinterpret_cast<sockaddr*>(&address), &length);
+        m_port = ntohs(address.sin_port);
+    }
+    ~SilentServer() {
+        close(m_fd);
+    }
+
+    SilentServer(const SilentServer&) = delete;
+    SilentServer& operator=(const SilentServer&) = delete;
+    SilentServer(SilentServer&&) = delete;
+    SilentServer& operator=(SilentServer&&) = delete;
+
+    [[nodiscard]] std::string GetUrl() const {
+        return "http://127.0.0.1:" + std::to_string(m_port) + "/";
+    }
+
+private:
+    int m_fd;
+    uint16_t m_port = 0;
+};
+#endif
+} // namespace
+
+TEST_CASE("HttpClient fetches through the I/O thread", "[http_client]") {
+    const auto path = std::filesystem::temp_directory_path() / "metaimgui_test_http_client.json";
+    {
+        std::ofstream file(path);
+        file << R"({"latitude": 1.0, "longitude": 2.0})";
+    }
+
+    HttpClient client;
+
+    SECTION("Single fetch returns the body") {
+        const HttpResponse response = client.Get(Request(FileUrl(path))).SyncWait();
+        REQUIRE(response.Succeeded());
+        REQUIRE(response.body == R"({"latitude": 1.0, "longitude": 2.0})");
+    }
+
+    SECTION("Concurrent fetches all complete") {
+        constexpr int FETCH_COUNT = 64;
+        std::atomic<int> completed{0};
+        std::atomic<int> succeeded{0};
+        for (int i = 0; i < FETCH_COUNT; ++i) {
+            FetchAndCount(client, FileUrl(path), completed, succeeded).Start();
+        }
+        while (completed < FETCH_COUNT) {
+            std::this_thread::yield();
+        }
+        REQUIRE(succeeded == FETCH_COUNT);
+        REQUIRE(client.GetActiveTransferCount() == 0);
+    }
+
+    SECTION("Missing files report a transport error") {
+        const HttpResponse response = client.Get(Request(FileUrl(path.string() + ".missing"))).SyncWait();
+        REQUIRE_FALSE(response.Succeeded());
+        REQUIRE(response.body.empty());
+    }
+
+    SECTION("Cancelled requests complete without a transfer") {
+        std::stop_source stopSource;
+        stopSource.request_stop();
+        const HttpResponse response = client.Get(Request(FileUrl(path)), stopSource.get_token()).SyncWait();
+        REQUIRE_FALSE(response.Succeeded());
+    }
+
+    SECTION("Requests after shutdown fail immediately") {
+        client.Shutdown();
+        client.Shutdown();
+        const HttpResponse response = client.Get(Request(FileUrl(path))).SyncWait();
+        REQUIRE_FALSE(response.Succeeded());
+        REQUIRE(client.GetActiveTransferCount() == 0);
+    }
+
+    std::filesystem::remove(path);
+}
+
+#ifndef _WIN32
+TEST_CASE("HttpClient handles stalled socket transfers", "[http_client]") {
+    SilentServer server;
+    HttpClient client;
+
+    SECTION("Transfer timeouts fire without socket activity") {
+        HttpRequest request = Request(server.GetUrl());
+        request.timeoutSeconds = 1;
+        const auto start = std::chrono::steady_clock::now();
+        const HttpResponse response = client.Get(request).SyncWait();
+        REQUIRE_FALSE(response.Succeeded());
+        REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::seconds(10));
+    }
+
+    SECTION("Stopping an in-flight transfer completes it promptly") {
+        std::stop_source stopSource;
+        std::thread stopper([&stopSource] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            stopSource.request_stop();
+        });
+        const auto start = std::chrono::steady_clock::now();
+        const HttpResponse response = client.Get(Request(server.GetUrl()), stopSource.get_token()).SyncWait();
+        stopper.join();
+        REQUIRE(response.error == "Cancelled");
+        REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::seconds(10));
+        REQUIRE(client.GetActiveTransferCount() == 0);
+    }
+}
+#endif
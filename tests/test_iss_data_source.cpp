@@ -0,0 +1,132 @@
+#include "ISSDataSource.h"
+#include "ISSTracker.h"
+#include "MainThreadDispatcher.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace MetaImGUI;
+
+TEST_CASE("SyntheticDataSource generates a plausible orbit", "[iss_data_source]") {
+    SyntheticDataSource source(10.0, 1000);
+
+    SECTION("Responses parse like the real API") {
+        const ISSPosition position = ISSTracker::ParseJSON(source.Fetch());
+        REQUIRE(position.valid);
+        REQUIRE(position.timestamp == 1000);
+        REQUIRE(position.altitude == SyntheticDataSource::ALTITUDE_KM);
+    }
+
+    SECTION("Track stays within the inclination and valid longitudes") {
+        for (int i = 0; i < 20000; ++i) {
+            const ISSPosition position = ISSTracker::ParseJSON(source.Fetch());
+            REQUIRE(position.valid);
+            REQUIRE(std::abs(position.latitude) <= SyntheticDataSource::INCLINATION_DEG + 1e-6);
+            REQUIRE(position.longitude >= -180.0);
+            REQUIRE(position.longitude < 180.0);
+        }
+        REQUIRE(source.GetSampleCount() == 20000);
+    }
+
+    SECTION("Simulated time advances at the sample rate") {
+        for (int i = 0; i < 10; ++i) {
+            (void)source.Fetch();
+        }
+        REQUIRE(ISSTracker::ParseJSON(source.Fetch()).timestamp == 1001);
+    }
+}
+
+TEST_CASE("FileDataSource replays a response log", "[iss_data_source]") {
+    const auto path = std::filesystem::temp_directory_path() / "metaimgui_test_responses.jsonl";
+    {
+        std::ofstream file(path);
+        file << "# recorded\n";
+        file << R"({"latitude": 1.0, "longitude": 2.0, "timestamp": 10})" << '\n';
+        file << '\n';
+        file << R"({"latitude": 3.0, "longitude": 4.0, "timestamp": 11})" << '\n';
+    }
+
+    SECTION("Responses come back in order and loop") {
+        FileDataSource source(path);
+        REQUIRE(source.GetResponseCount() == 2);
+        REQUIRE(ISSTracker::ParseJSON(source.Fetch()).timestamp == 10);
+        REQUIRE(ISSTracker::ParseJSON(source.Fetch()).timestamp == 11);
+        REQUIRE(ISSTracker::ParseJSON(source.Fetch()).timestamp == 10);
+    }
+
+    SECTION("Non-looping source runs dry") {
+        FileDataSource source(path, false);
+        (void)source.Fetch();
+        (void)source.Fetch();
+        REQUIRE(source.Fetch().empty());
+    }
+
+    SECTION("Missing file yields no responses") {
+        FileDataSource source(path.parent_path() / "metaimgui_missing_responses.jsonl");
+        REQUIRE(source.GetResponseCount() == 0);
+        REQUIRE(source.Fetch().empty());
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("ISSTracker runs offline against a synthetic source", "[iss_data_source]") {
+    std::atomic<int> published{0}; // Outlives the tracker thread that increments it
+    ISSTracker tracker;
+    tracker.SetDataSource(std::make_shared<SyntheticDataSource>(1000.0));
+    tracker.SetPollInterval(std::chrono::milliseconds(0));
+    REQUIRE(tracker.GetPollInterval().count() == 0);
+
+    tracker.StartTracking([&published](const ISSPosition&) { ++published; });
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (published < 500 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    tracker.StopTracking();
+
+    REQUIRE(published >= 500);
+    REQUIRE(tracker.GetCurrentPosition().valid);
+
+    std::vector<double> latitudes, longitudes;
+    tracker.GetPositionHistory(latitudes, longitudes);
+    REQUIRE(latitudes.size() >= 500);
+
+    const auto metrics = tracker.GetMetrics();
+    REQUIRE(metrics.fetchSuccesses >= 500);
+    REQUIRE(metrics.fetchFailures == 0);
+    REQUIRE(metrics.parseTimeUs.count >= 500);
+    REQUIRE(metrics.bytesReceived > 0);
+}
+
+TEST_CASE("ISSTracker delivers callbacks through a dispatcher", "[iss_data_source]") {
+    MainThreadDispatcher dispatcher; // Must outlive the tracker
+    int delivered = 0;               // Only touched by this (the draining) thread
+    const auto mainThread = std::this_thread::get_id();
+    bool onMainThread = true;
+
+    ISSTracker tracker;
+    tracker.SetDataSource(std::make_shared<SyntheticDataSource>(1000.0));
+    tracker.SetPollInterval(std::chrono::milliseconds(1));
+    tracker.SetCallbackDispatcher(&dispatcher);
+    tracker.StartTracking([&](const ISSPosition&) {
+        onMainThread = onMainThread && (std::this_thread::get_id() == mainThread);
+        ++delivered;
+    });
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (delivered < 20 && std::chrono::steady_clock::now() < deadline) {
+        dispatcher.Drain(std::chrono::milliseconds(2));
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    tracker.StopTracking();
+
+    REQUIRE(delivered >= 20);
+    REQUIRE(onMainThread);
+}
@@ -0,0 +1,142 @@
+#include "ListDataProvider.h"
+#include "ListFilter.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace MetaImGUI;
+
+namespace {
+// Generates "Item <n>" on demand, like a provider over data that is never materialized
+class GeneratedProvider : public ListDataProvider {
+public:
+    explicit GeneratedProvider(size_t count) : m_count(count) {}
+
+    [[nodiscard]] size_t GetCount() const override {
+        return m_count;
+    }
+
+    [[nodiscard]] const char* GetItem(size_t index) const override {
+        m_buffer = "Item " + std::to_string(index);
+        ++m_reads;
+        return m_buffer.c_str();
+    }
+
+    [[nodiscard]] size_t GetReads() const {
+        return m_reads;
+    }
+
+private:
+    size_t m_count;
+    mutable std::string m_buffer;
+    mutable size_t m_reads = 0;
+};
+
+std::vector<size_t> Rows(const ListFilter& filter) {
+    std::vector<size_t> rows;
+    for (size_t row = 0; row < filter.GetRowCount(); ++row) {
+        rows.push_back(filter.GetItemIndex(row));
+    }
+    return rows;
+}
+
+void RunToCompletion(ListFilter& filter, size_t budget) {
+    while (!filter.Step(budget)) {
+    }
+}
+} // namespace
+
+TEST_CASE("ListFilter filters a provider incrementally", "[list_filter]") {
+    const VectorListDataProvider fruit({"Apple", "banana", "Cherry", "pineapple", "Grape", "APRICOT"});
+    ListFilter filter(fruit);
+
+    SECTION("Without a query every item is a row") {
+        REQUIRE(filter.GetRowCount() == 6);
+        REQUIRE(filter.GetItemIndex(4) == 4);
+        REQUIRE_FALSE(filter.IsComplete());
+        RunToCompletion(filter, 2);
+        REQUIRE(filter.GetIndexedCount() == 6);
+    }
+
+    SECTION("Matching is a case-insensitive substring search") {
+        filter.SetQuery("AP");
+        RunToCompletion(filter, 100);
+        REQUIRE(Rows(filter) == std::vector<size_t>{0, 3, 4, 5});
+
+        filter.SetQuery("apple");
+        RunToCompletion(filter, 100);
+        REQUIRE(Rows(filter) == std::vector<size_t>{0, 3});
+    }
+
+    SECTION("Matches appear as the budgeted scan advances") {
+        filter.SetQuery("a");
+        REQUIRE_FALSE(filter.Step(3));
+        REQUIRE(filter.GetScannedCount() == 3);
+        REQUIRE(Rows(filter) == std::vector<size_t>{0, 1});
+        RunToCompletion(filter, 3);
+        REQUIRE(filter.GetRowCount() == 5);
+    }
+
+    SECTION("Clearing or broadening the query rescans") {
+        filter.SetQuery("apple");
+        RunToCompletion(filter, 100);
+        filter.SetQuery("ap");
+        RunToCompletion(filter, 100);
+        REQUIRE(Rows(filter) == std::vector<size_t>{0, 3, 4, 5});
+
+        filter.SetQuery("");
+        REQUIRE(filter.GetRowCount() == 6);
+        REQUIRE(filter.IsComplete());
+    }
+}
+
+TEST_CASE("ListFilter narrows without rescanning the provider", "[list_filter]") {
+    const GeneratedProvider items(10000);
+    ListFilter filter(items);
+
+    SECTION("Narrowing a finished query re-tests only its matches") {
+        filter.SetQuery("item 1");
+        RunToCompletion(filter, 1000);
+        const size_t readsAfterFirstQuery = items.GetReads();
+        REQUIRE(readsAfterFirstQuery == 10000); // Each item folded into the index once
+        REQUIRE(filter.GetRowCount() == 1111);  // 1, 10-19, 100-199, 1000-1999
+
+        filter.SetQuery("item 12");
+        REQUIRE_FALSE(filter.Step(100));
+        RunToCompletion(filter, 100);
+        REQUIRE(items.GetReads() == readsAfterFirstQuery);
+        REQUIRE(filter.GetRowCount() == 111); // 12, 120-129, 1200-1299
+        REQUIRE(filter.GetItemIndex(0) == 12);
+        REQUIRE(filter.GetItemIndex(110) == 1299);
+    }
+
+    SECTION("Narrowing mid-scan matches a fresh filter") {
+        filter.SetQuery("item 9");
+        filter.Step(500);
+        filter.Step(500);
+        filter.SetQuery("item 99");
+        filter.Step(7);
+        filter.SetQuery("item 995");
+        RunToCompletion(filter, 250);
+
+        ListFilter fresh(items);
+        fresh.SetQuery("ITEM 995");
+        RunToCompletion(fresh, 10000);
+        REQUIRE(Rows(filter) == Rows(fresh));
+        REQUIRE(Rows(filter) == std::vector<size_t>{995, 9950, 9951, 9952, 9953, 9954, 9955, 9956, 9957, 9958, 9959});
+    }
+
+    SECTION("Opening reads nothing; the index is built within the step budgets") {
+        const GeneratedProvider million(1000000);
+        ListFilter large(million);
+        REQUIRE(large.GetRowCount() == 1000000);
+        REQUIRE(million.GetReads() == 0);
+
+        large.Step(1000);
+        REQUIRE(million.GetReads() == 1000);
+        REQUIRE(large.GetIndexedCount() == 1000);
+    }
+}
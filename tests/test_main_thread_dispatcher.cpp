@@ -0,0 +1,194 @@
+#include "MainThreadDispatcher.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace MetaImGUI;
+
+TEST_CASE("InlineTask stores callables inline", "[main_thread_dispatcher]") {
+    SECTION("Default task is empty") {
+        const MainThreadDispatcher::Task task;
+        REQUIRE_FALSE(task);
+    }
+
+    SECTION("Invokes the stored callable") {
+        int value = 0;
+        MainThreadDispatcher::Task task([&value] { value = 42; });
+        REQUIRE(task);
+        task();
+        REQUIRE(value == 42);
+    }
+
+    SECTION("Move-only captures are supported and destroyed once") {
+        auto counter = std::make_shared<int>(0);
+        {
+            auto payload = std::make_unique<std::shared_ptr<int>>(counter);
+            MainThreadDispatcher::Task task([payload = std::move(payload)] { ++**payload; });
+            MainThreadDispatcher::Task moved(std::move(task));
+            REQUIRE_FALSE(task); // NOLINT(bugprone-use-after-move)
+            moved();
+            REQUIRE(counter.use_count() == 2);
+        }
+        REQUIRE(*counter == 1);
+        REQUIRE(counter.use_count() == 1);
+    }
+}
+
+TEST_CASE("MainThreadDispatcher runs posted tasks in order", "[main_thread_dispatcher]") {
+    MainThreadDispatcher dispatcher(8);
+    std::vector<int> order;
+
+    SECTION("Capacity rounds up to a power of two") {
+        REQUIRE(MainThreadDispatcher(5).GetCapacity() == 8);
+    }
+
+    SECTION("Tasks run in posting order") {
+        for (int i = 0; i < 5; ++i) {
+            REQUIRE(dispatcher.Post([&order, i] { order.push_back(i); }));
+        }
+        REQUIRE(dispatcher.Drain(std::chrono::seconds(1)) == 5);
+        REQUIRE(order == std::vector<int>{0, 1, 2, 3, 4});
+        REQUIRE(dispatcher.Drain(std::chrono::seconds(1)) == 0);
+    }
+
+    SECTION("Full queue drops and counts") {
+        for (int i = 0; i < 8; ++i) {
+            REQUIRE(dispatcher.Post([&order, i] { order.push_back(i); }));
+        }
+        REQUIRE_FALSE(dispatcher.Post([&order] { order.push_back(-1); }));
+        REQUIRE(dispatcher.GetDroppedCount() == 1);
+
+        dispatcher.Drain(std::chrono::seconds(1));
+        REQUIRE(order.size() == 8);
+        REQUIRE(dispatcher.Post([&order] { order.push_back(8); }));
+    }
+
+    SECTION("Budget limits work per drain but always makes progress") {
+        for (int i = 0; i < 4; ++i) {
+            dispatcher.Post([&order, i] {
+                order.push_back(i);
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            });
+        }
+        REQUIRE(dispatcher.Drain(std::chrono::microseconds(0)) == 1);
+        REQUIRE(dispatcher.Drain(std::chrono::seconds(1)) == 3);
+    }
+
+    SECTION("Throwing task does not stop the drain") {
+        dispatcher.Post([] { throw std::runtime_error("task failure"); });
+        dispatcher.Post([&order] { order.push_back(1); });
+        REQUIRE(dispatcher.Drain(std::chrono::seconds(1)) == 2);
+        REQUIRE(order == std::vector<int>{1});
+    }
+
+    SECTION("Clear discards pending tasks") {
+        dispatcher.Post([&order] { order.push_back(1); });
+        dispatcher.Clear();
+        REQUIRE(dispatcher.Drain(std::chrono::seconds(1)) == 0);
+        REQUIRE(order.empty());
+    }
+}
+
+TEST_CASE("MainThreadDispatcher accepts concurrent producers", "[main_thread_dispatcher]") {
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 5000;
+    MainThreadDispatcher dispatcher(256);
+
+    std::atomic<int> posted{0};
+    std::vector<int> lastSeen(PRODUCERS, -1);
+    bool ordered = true;
+    int executed = 0;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&, p] {
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                while (!dispatcher.Post([&, p, i] {
+                    ordered = ordered && (i > lastSeen[p]);
+                    lastSeen[p] = i;
+                    ++executed;
+                })) {
+                    std::this_thread::yield();
+                }
+                ++posted;
+            }
+        });
+    }
+
+    // This thread plays the main thread
+    while (executed < PRODUCERS * PER_PRODUCER) {
+        dispatcher.Drain(std::chrono::milliseconds(1));
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    REQUIRE(posted == PRODUCERS * PER_PRODUCER);
+    REQUIRE(executed == PRODUCERS * PER_PRODUCER);
+    REQUIRE(ordered);
+}
+
+TEST_CASE("MainThreadSlot delivers results a full dispatcher would drop", "[main_thread_dispatcher]") {
+    MainThreadDispatcher dispatcher(4);
+    MainThreadSlot<std::string> slot;
+
+    // Mirrors the application's update check: a second check is refused while one is in progress
+    bool checkInProgress = false;
+    int checksRun = 0;
+    std::string latest;
+    const auto startCheck = [&](const std::string& result) {
+        if (checkInProgress) {
+            return false;
+        }
+        checkInProgress = true;
+        ++checksRun;
+        std::thread worker([&slot, result] { slot.Publish(result); });
+        worker.join();
+        return true;
+    };
+    const auto drainFrame = [&] {
+        dispatcher.Drain(std::chrono::seconds(1));
+        slot.Consume([&](std::string& value) {
+            checkInProgress = false;
+            std::swap(latest, value);
+        });
+    };
+
+    // Tracker callbacks fill the ring faster than the frames drain it
+    while (dispatcher.Post([] {})) {
+    }
+    REQUIRE(dispatcher.GetDroppedCount() == 1);
+
+    REQUIRE(startCheck("1.2.0"));
+    REQUIRE_FALSE(startCheck("ignored"));
+    REQUIRE(slot.HasValue());
+
+    drainFrame();
+    REQUIRE_FALSE(checkInProgress);
+    REQUIRE(latest == "1.2.0");
+    REQUIRE_FALSE(slot.Consume([](std::string&) {}));
+
+    // A later check (e.g. from the Help menu) still runs and is delivered
+    while (dispatcher.Post([] {})) {
+    }
+    REQUIRE(startCheck("1.3.0"));
+    REQUIRE(checksRun == 2);
+    drainFrame();
+    REQUIRE(latest == "1.3.0");
+
+    SECTION("An untaken value is replaced by a newer one") {
+        slot.Publish("a");
+        slot.Publish("b");
+        REQUIRE(slot.Consume([&](std::string& value) { latest = value; }));
+        REQUIRE(latest == "b");
+        REQUIRE_FALSE(slot.HasValue());
+    }
+}
@@ -0,0 +1,190 @@
+#include "MarkdownDocument.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace MetaImGUI;
+
+namespace {
+constexpr float GLYPH_WIDTH = 10.0f;
+
+// Every character is GLYPH_WIDTH wide at scale 1, so widths are easy to reason about
+MarkdownMetrics FixedMetrics() {
+    MarkdownMetrics metrics;
+    metrics.measure = [](const void*, std::string_view text, uint8_t, float fontScale) {
+        return static_cast<float>(text.size()) * GLYPH_WIDTH * fontScale;
+    };
+    metrics.lineHeight = 20.0f;
+    metrics.indentWidth = 20.0f;
+    metrics.blockSpacing = 5.0f;
+    return metrics;
+}
+
+std::string SpanText(const MarkdownDocument& document, size_t index) {
+    const MarkdownSpan& span = document.GetSpans().at(index);
+    return std::string(document.GetText(span.offset, span.length));
+}
+
+// Text of each laid-out line, runs concatenated
+std::vector<std::string> LineTexts(const MarkdownDocument& document, const MarkdownLayout& layout) {
+    std::vector<std::string> lines;
+    for (const MarkdownLine& line : layout.lines) {
+        std::string text;
+        for (uint32_t r = line.firstRun; r < line.firstRun + line.runCount; ++r) {
+            text += document.GetText(layout.runs[r].offset, layout.runs[r].length);
+        }
+        lines.push_back(text);
+    }
+    return lines;
+}
+} // namespace
+
+TEST_CASE("MarkdownDocument parses release-note blocks", "[markdown]") {
+    const MarkdownDocument document("# What's Changed ##\n"
+                                    "\n"
+                                    "Intro line\r\n"
+                                    "continues here.\n"
+                                    "\n"
+                                    "- First item\n"
+                                    "  wraps on\n"
+                                    "  - Nested\n"
+                                    "3. Third\n"
+                                    "---\n"
+                                    "> quoted\n"
+                                    "```cpp\n"
+                                    "int x = 1;\n"
+                                    "  # not a heading\n"
+                                    "```\n");
+
+    const auto& blocks = document.GetBlocks();
+    REQUIRE(blocks.size() == 8);
+
+    REQUIRE(blocks[0].type == MarkdownBlockType::Heading);
+    REQUIRE(blocks[0].level == 1);
+    REQUIRE(SpanText(document, blocks[0].firstSpan) == "What's Changed");
+
+    REQUIRE(blocks[1].type == MarkdownBlockType::Paragraph);
+    REQUIRE(SpanText(document, blocks[1].firstSpan) == "Intro line continues here.");
+
+    REQUIRE(blocks[2].type == MarkdownBlockType::ListItem);
+    REQUIRE(blocks[2].level == 0);
+    REQUIRE(blocks[2].number == 0);
+    REQUIRE(SpanText(document, blocks[2].firstSpan) == "First item wraps on");
+    REQUIRE(blocks[3].type == MarkdownBlockType::ListItem);
+    REQUIRE(blocks[3].level == 1);
+    REQUIRE(blocks[4].type == MarkdownBlockType::ListItem);
+    REQUIRE(blocks[4].number == 3);
+
+    REQUIRE(blocks[5].type == MarkdownBlockType::Rule);
+    REQUIRE(blocks[5].spanCount == 0);
+    REQUIRE(blocks[6].type == MarkdownBlockType::Quote);
+
+    REQUIRE(blocks[7].type == MarkdownBlockType::CodeBlock);
+    REQUIRE(blocks[7].spanCount == 1);
+    REQUIRE(SpanText(document, blocks[7].firstSpan) == "int x = 1;\n  # not a heading");
+    REQUIRE(document.GetSpans()[blocks[7].firstSpan].style == MarkdownStyle::CODE);
+}
+
+TEST_CASE("MarkdownDocument parses inline styles and links", "[markdown]") {
+    SECTION("Strong, emphasis and code") {
+        const MarkdownDocument document("Plain **bold *both*** _em_ `a*b` snake_case_name 2 * 3");
+        const auto& spans = document.GetSpans();
+        REQUIRE(spans.size() == 8);
+        REQUIRE(SpanText(document, 0) == "Plain ");
+        REQUIRE(SpanText(document, 1) == "bold ");
+        REQUIRE(spans[1].style == MarkdownStyle::STRONG);
+        REQUIRE(SpanText(document, 2) == "both");
+        REQUIRE(spans[2].style == (MarkdownStyle::STRONG | MarkdownStyle::EMPHASIS));
+        REQUIRE(SpanText(document, 4) == "em");
+        REQUIRE(spans[4].style == MarkdownStyle::EMPHASIS);
+        REQUIRE(SpanText(document, 6) == "a*b");
+        REQUIRE(spans[6].style == MarkdownStyle::CODE);
+        REQUIRE(SpanText(document, 7) == " snake_case_name 2 * 3");
+        REQUIRE(spans[7].style == MarkdownStyle::PLAIN);
+    }
+
+    SECTION("Links, autolinks and bare URLs") {
+        const MarkdownDocument document(
+            "See [the **docs**](https://example.com/docs \"Docs\"), <https://a.test/x> and "
+            "https://github.com/o/r/compare/v1...v2.");
+        const auto& links = document.GetLinks();
+        REQUIRE(links == std::vector<std::string>{"https://example.com/docs", "https://a.test/x",
+                                                  "https://github.com/o/r/compare/v1...v2"});
+
+        std::vector<std::string> linkText;
+        for (size_t i = 0; i < document.GetSpans().size(); ++i) {
+            if ((document.GetSpans()[i].style & MarkdownStyle::LINK) != 0) {
+                linkText.push_back(SpanText(document, i));
+            }
+        }
+        REQUIRE(linkText ==
+                std::vector<std::string>{"the ", "docs", "https://a.test/x", "https://github.com/o/r/compare/v1...v2"});
+        REQUIRE(document.GetSpans()[2].style == (MarkdownStyle::LINK | MarkdownStyle::STRONG));
+        REQUIRE(document.GetSpans()[2].link == 0);
+        REQUIRE(SpanText(document, document.GetSpans().size() - 1) == ".");
+    }
+
+    SECTION("Escapes and unmatched markers stay literal") {
+        const MarkdownDocument document("\\*not em\\* and *open and `tick");
+        REQUIRE(document.GetSpans().size() == 1);
+        REQUIRE(SpanText(document, 0) == "*not em* and *open and `tick");
+    }
+}
+
+TEST_CASE("MarkdownDocument wraps and caches its layout", "[markdown]") {
+    MarkdownDocument document("alpha beta gamma delta\n\n- item one");
+    const MarkdownMetrics metrics = FixedMetrics();
+
+    SECTION("Words wrap to the width without leading spaces") {
+        const MarkdownLayout& layout = document.Layout(100.0f, 1, metrics);
+        REQUIRE(LineTexts(document, layout) == std::vector<std::string>{"alpha beta", "gamma", "delta", "item one"});
+        REQUIRE(layout.lines[0].firstOfBlock);
+        REQUIRE_FALSE(layout.lines[1].firstOfBlock);
+        REQUIRE(layout.lines[1].y == 20.0f);
+        // Block spacing before the list item, which is indented one level
+        REQUIRE(layout.lines[3].y == 65.0f);
+        REQUIRE(layout.runs[layout.lines[3].firstRun].x == 20.0f);
+        REQUIRE(layout.height == 85.0f);
+    }
+
+    SECTION("Same width and font reuse the cached layout") {
+        const size_t lines = document.Layout(120.0f, 1, metrics).lines.size();
+        // Fractional width changes round to the same pixel width
+        REQUIRE(document.Layout(120.4f, 1, metrics).lines.size() == lines);
+        REQUIRE(document.GetLayoutCount() == 1);
+    }
+
+    SECTION("A resize or font change recomputes it") {
+        (void)document.Layout(120.0f, 1, metrics);
+        REQUIRE(LineTexts(document, document.Layout(300.0f, 1, metrics)).size() == 2);
+        REQUIRE(document.GetLayoutCount() == 2);
+        (void)document.Layout(300.0f, 2, metrics);
+        REQUIRE(document.GetLayoutCount() == 3);
+        document.InvalidateLayout();
+        (void)document.Layout(300.0f, 2, metrics);
+        REQUIRE(document.GetLayoutCount() == 4);
+    }
+
+    SECTION("Words wider than the line are split") {
+        document.Parse("abcdefghijklmnopqrstuvwxyz");
+        const MarkdownLayout& layout = document.Layout(100.0f, 1, metrics);
+        REQUIRE(LineTexts(document, layout) == std::vector<std::string>{"abcdefghij", "klmnopqrst", "uvwxyz"});
+    }
+
+    SECTION("Headings are measured at their scale") {
+        document.Parse("# abc def");
+        const MarkdownLayout& layout = document.Layout(60.0f, 1, metrics);
+        REQUIRE(layout.lines.size() == 2);
+        REQUIRE(layout.lines[0].fontScale == MarkdownDocument::HeadingScale(1));
+        REQUIRE(layout.lines[0].height == metrics.lineHeight * MarkdownDocument::HeadingScale(1));
+    }
+
+    SECTION("Code blocks keep line breaks and indentation") {
+        document.Parse("```\nif (x) {\n    y();\n}\n```");
+        const MarkdownLayout& layout = document.Layout(400.0f, 1, metrics);
+        REQUIRE(LineTexts(document, layout) == std::vector<std::string>{"if (x) {", "    y();", "}"});
+    }
+}
@@ -0,0 +1,77 @@
+#include "SemVer.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <compare>
+#include <string_view>
+#include <type_traits>
+
+using namespace MetaImGUI;
+
+// Parsing and precedence are usable in constant expressions
+static_assert(SemVer::Parse("1.2.3").has_value());
+static_assert(SemVer::Parse("1.2.3-rc.1") < SemVer::Parse("1.2.3"));
+static_assert(SemVer::Parse("v2.0") == SemVer::Parse("2.0.0+build.7"));
+// Build metadata makes versions equivalent without being substitutable
+static_assert(std::is_same_v<decltype(SemVer{} <=> SemVer{}), std::weak_ordering>);
+
+TEST_CASE("SemVer parsing", "[semver]") {
+    SECTION("Core, pre-release and build parts") {
+        const auto version = SemVer::Parse("1.22.333-alpha.1+sha.5114f85");
+        REQUIRE(version.has_value());
+        REQUIRE(version->major == 1);
+        REQUIRE(version->minor == 22);
+        REQUIRE(version->patch == 333);
+        REQUIRE(version->preRelease == "alpha.1");
+        REQUIRE(version->build == "sha.5114f85");
+    }
+
+    SECTION("Tag forms: leading v and omitted components") {
+        REQUIRE(SemVer::Parse("v1.0.0").has_value());
+        REQUIRE(SemVer::Parse("V3").has_value());
+        REQUIRE(SemVer::Parse("1.2")->patch == 0);
+    }
+
+    SECTION("Invalid versions are rejected without throwing") {
+        constexpr std::array<std::string_view, 12> invalid = {
+            "", "v", "1.", "1..2", "1.2.3.4", "01.2.3", "1.2.3-", "1.2.3-01", "1.2.3-a..b", "1.2.3+", "1.2.x",
+            "99999999999999999999.0.0"};
+        for (const auto text : invalid) {
+            INFO(text);
+            REQUIRE_FALSE(SemVer::Parse(text).has_value());
+        }
+    }
+
+    SECTION("Components above the packed range are rejected") {
+        REQUIRE(SemVer::Parse("2097151.0.0").has_value());
+        REQUIRE_FALSE(SemVer::Parse("2097152.0.0").has_value());
+    }
+}
+
+TEST_CASE("SemVer precedence", "[semver]") {
+    SECTION("Specification example ordering") {
+        constexpr std::array<std::string_view, 8> ordered = {"1.0.0-alpha",  "1.0.0-alpha.1", "1.0.0-alpha.beta",
+                                                             "1.0.0-beta",   "1.0.0-beta.2",  "1.0.0-beta.11",
+                                                             "1.0.0-rc.1",   "1.0.0"};
+        for (size_t i = 1; i < ordered.size(); ++i) {
+            INFO(ordered[i - 1] << " < " << ordered[i]);
+            REQUIRE(*SemVer::Parse(ordered[i - 1]) < *SemVer::Parse(ordered[i]));
+        }
+    }
+
+    SECTION("Core components compare numerically") {
+        REQUIRE(*SemVer::Parse("1.9.0") < *SemVer::Parse("1.10.0"));
+        REQUIRE(*SemVer::Parse("1.0.10") > *SemVer::Parse("1.0.9"));
+    }
+
+    SECTION("Build metadata is ignored") {
+        REQUIRE(*SemVer::Parse("1.0.0+a") == *SemVer::Parse("1.0.0+b"));
+        REQUIRE((*SemVer::Parse("1.0.0+a") <=> *SemVer::Parse("1.0.0+b")) == std::weak_ordering::equivalent);
+    }
+
+    SECTION("Packed keys order releases by core version") {
+        REQUIRE(SemVer::Parse("1.2.3")->PackedKey() < SemVer::Parse("1.3.0")->PackedKey());
+        REQUIRE(SemVer::Parse("1.2.3-rc.1")->PackedKey() < SemVer::Parse("1.2.3")->PackedKey());
+    }
+}
@@ -0,0 +1,55 @@
+#include "Sha256.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+
+using namespace MetaImGUI;
+
+TEST_CASE("Sha256 matches the FIPS 180-4 test vectors", "[sha256]") {
+    SECTION("Empty input") {
+        REQUIRE(Sha256::HashHex("") == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    }
+
+    SECTION("One block") {
+        REQUIRE(Sha256::HashHex("abc") == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    }
+
+    SECTION("Padding spills into a second block") {
+        REQUIRE(Sha256::HashHex("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+                "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+    }
+
+    SECTION("One million repetitions of 'a'") {
+        REQUIRE(Sha256::HashHex(std::string(1000000, 'a')) ==
+                "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+    }
+}
+
+TEST_CASE("Sha256 hashes incrementally", "[sha256]") {
+    std::string data;
+    for (int i = 0; i < 1000; ++i) {
+        data += static_cast<char>(i * 7);
+    }
+    const std::string expected = Sha256::HashHex(data);
+
+    SECTION("Chunk boundaries do not change the digest") {
+        for (const size_t chunkSize : {size_t{1}, size_t{13}, size_t{63}, size_t{64}, size_t{65}, size_t{999}}) {
+            INFO("chunk size " << chunkSize);
+            Sha256 hash;
+            for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+                hash.Update(std::string_view(data).substr(offset, chunkSize));
+            }
+            REQUIRE(hash.GetByteCount() == data.size());
+            REQUIRE(Sha256::ToHex(hash.Finish()) == expected);
+        }
+    }
+
+    SECTION("Finish resets the hasher for reuse") {
+        Sha256 hash;
+        hash.Update("discarded");
+        (void)hash.Finish();
+        hash.Update(data);
+        REQUIRE(Sha256::ToHex(hash.Finish()) == expected);
+    }
+}
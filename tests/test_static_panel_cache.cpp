@@ -0,0 +1,102 @@
+#include "StaticPanelCache.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string_view>
+
+using namespace MetaImGUI;
+
+namespace {
+StaticPanelKey MakeKey(float x) {
+    StaticPanelKey key;
+    key.rect = {x, 10.0f, 400.0f, 300.0f};
+    key.clipRect = {0.0f, 0.0f, 1280.0f, 720.0f};
+    key.styleHash = 1;
+    key.fontHash = 2;
+    key.languageHash = 3;
+    return key;
+}
+} // namespace
+
+TEST_CASE("StaticPanelCache replays panels while their key is unchanged", "[static_panel_cache]") {
+    StaticPanelCache cache;
+    const StaticPanelKey key = MakeKey(5.0f);
+
+    SECTION("Unrecorded panels miss") {
+        REQUIRE(cache.Find("about", key) == nullptr);
+        REQUIRE(cache.GetMisses() == 1);
+        REQUIRE(cache.GetHits() == 0);
+    }
+
+    SECTION("Recorded geometry is returned for the same key") {
+        StaticPanelCache::Geometry& recorded = cache.Record("about", key);
+        recorded.vertices.push_back({.x = 1.0f, .y = 2.0f, .u = 0.5f, .v = 0.5f, .color = 0xFFFFFFFF});
+        recorded.indices = {0, 0, 0};
+        recorded.width = 120.0f;
+        recorded.height = 40.0f;
+
+        const StaticPanelCache::Geometry* geometry = cache.Find("about", key);
+        REQUIRE(geometry != nullptr);
+        REQUIRE(geometry->vertices.size() == 1);
+        REQUIRE(geometry->indices.size() == 3);
+        REQUIRE(geometry->width == 120.0f);
+        REQUIRE(cache.GetHits() == 1);
+
+        // Panels are independent
+        REQUIRE(cache.Find("welcome", key) == nullptr);
+    }
+
+    SECTION("Any key change forces a new recording") {
+        cache.Record("about", key).width = 1.0f;
+
+        StaticPanelKey moved = key;
+        moved.rect[0] += 1.0f;
+        REQUIRE(cache.Find("about", moved) == nullptr);
+
+        StaticPanelKey themed = key;
+        themed.styleHash = 99;
+        REQUIRE(cache.Find("about", themed) == nullptr);
+
+        StaticPanelKey translated = key;
+        translated.languageHash = 99;
+        REQUIRE(cache.Find("about", translated) == nullptr);
+
+        StaticPanelKey clipped = key;
+        clipped.clipRect[3] = 100.0f;
+        REQUIRE(cache.Find("about", clipped) == nullptr);
+
+        REQUIRE(cache.GetMisses() == 4);
+        REQUIRE(cache.Find("about", key) != nullptr);
+    }
+
+    SECTION("Re-recording replaces the geometry and key") {
+        cache.Record("about", key).vertices.resize(10);
+        const StaticPanelKey moved = MakeKey(50.0f);
+        cache.Record("about", moved).vertices.resize(4);
+
+        REQUIRE(cache.GetPanelCount() == 1);
+        REQUIRE(cache.Find("about", key) == nullptr);
+        REQUIRE(cache.Find("about", moved)->vertices.size() == 4);
+    }
+
+    SECTION("Discarded panels are drawn again") {
+        cache.Record("about", key);
+        cache.Discard("about");
+        REQUIRE(cache.Find("about", key) == nullptr);
+        REQUIRE(cache.GetPanelCount() == 0);
+    }
+}
+
+TEST_CASE("StaticPanelCache hashes key components", "[static_panel_cache]") {
+    const std::string_view english = "en";
+    const std::string_view german = "de";
+    REQUIRE(StaticPanelCache::Hash(english.data(), english.size()) ==
+            StaticPanelCache::Hash(english.data(), english.size()));
+    REQUIRE(StaticPanelCache::Hash(english.data(), english.size()) !=
+            StaticPanelCache::Hash(german.data(), german.size()));
+
+    // Chaining through the seed combines components
+    const uint64_t first = StaticPanelCache::Hash(english.data(), english.size());
+    REQUIRE(StaticPanelCache::Hash(german.data(), german.size(), first) !=
+            StaticPanelCache::Hash(german.data(), german.size()));
+}
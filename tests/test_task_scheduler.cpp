@@ -0,0 +1,186 @@
+#include "TaskScheduler.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace MetaImGUI;
+using namespace std::chrono_literals;
+
+namespace {
+// Poll a condition for up to a few seconds so slow CI machines do not flake
+template <typename Predicate>
+bool WaitFor(Predicate predicate) {
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("TaskScheduler runs submitted tasks", "[task_scheduler]") {
+    TaskScheduler scheduler(4);
+    REQUIRE(scheduler.GetThreadCount() == 4);
+
+    SECTION("Every task runs exactly once") {
+        std::atomic<int> count{0};
+        std::vector<TaskHandle> handles;
+        for (int i = 0; i < 1000; ++i) {
+            handles.push_back(scheduler.Submit([&count](const std::stop_token&) { ++count; }));
+        }
+        for (const auto& handle : handles) {
+            handle.Wait();
+            REQUIRE(handle.IsDone());
+        }
+        REQUIRE(count == 1000);
+    }
+
+    SECTION("Tasks submitted from a task run too") {
+        std::atomic<int> count{0};
+        TaskHandle inner;
+        std::mutex innerMutex;
+        scheduler
+            .Submit([&](const std::stop_token&) {
+                const std::lock_guard<std::mutex> lock(innerMutex);
+                inner = scheduler.Submit([&count](const std::stop_token&) { ++count; });
+            })
+            .Wait();
+        const std::lock_guard<std::mutex> lock(innerMutex);
+        inner.Wait();
+        REQUIRE(count == 1);
+    }
+
+    SECTION("Exceptions are contained") {
+        auto handle = scheduler.Submit([](const std::stop_token&) { throw std::runtime_error("task failure"); });
+        handle.Wait();
+        std::atomic<bool> ran{false};
+        scheduler.Submit([&ran](const std::stop_token&) { ran = true; }).Wait();
+        REQUIRE(ran);
+    }
+}
+
+TEST_CASE("TaskScheduler honours priorities", "[task_scheduler]") {
+    TaskScheduler scheduler(2);
+
+    // Occupy both workers so the queued tasks have to wait
+    std::atomic<bool> release{false};
+    std::atomic<int> blocked{0};
+    std::vector<TaskHandle> blockers;
+    for (int i = 0; i < 2; ++i) {
+        blockers.push_back(scheduler.Submit([&](const std::stop_token&) {
+            ++blocked;
+            while (!release) {
+                std::this_thread::sleep_for(1ms);
+            }
+        }));
+    }
+    REQUIRE(WaitFor([&] { return blocked == 2; }));
+
+    std::mutex orderMutex;
+    std::vector<int> order;
+    const auto record = [&](int value) {
+        return [&, value](const std::stop_token&) {
+            const std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(value);
+        };
+    };
+    std::vector<TaskHandle> handles;
+    handles.push_back(scheduler.Submit(record(2), TaskPriority::Low));
+    handles.push_back(scheduler.Submit(record(1), TaskPriority::Normal));
+    handles.push_back(scheduler.Submit(record(0), TaskPriority::High));
+
+    release = true;
+    for (const auto& handle : handles) {
+        handle.Wait();
+    }
+    // Two workers may pick the first two concurrently, but Low can never run first
+    REQUIRE(order.size() == 3);
+    REQUIRE(order.front() != 2);
+}
+
+TEST_CASE("TaskScheduler delayed and periodic tasks", "[task_scheduler]") {
+    TaskScheduler scheduler(2);
+
+    SECTION("Delayed task waits for its delay") {
+        const auto start = std::chrono::steady_clock::now();
+        std::atomic<int64_t> ranAfterMs{-1};
+        scheduler
+            .ScheduleAfter(50ms,
+                           [&](const std::stop_token&) {
+                               ranAfterMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                std::chrono::steady_clock::now() - start)
+                                                .count();
+                           })
+            .Wait();
+        REQUIRE(ranAfterMs >= 50);
+    }
+
+    SECTION("Periodic task repeats until cancelled") {
+        std::atomic<int> runs{0};
+        auto handle = scheduler.SchedulePeriodic(1ms, [&runs](const std::stop_token&) { ++runs; });
+        REQUIRE(WaitFor([&] { return runs >= 5; }));
+
+        handle.Cancel();
+        handle.Wait();
+        const int finalRuns = runs;
+        std::this_thread::sleep_for(20ms);
+        REQUIRE(runs == finalRuns);
+    }
+
+    SECTION("Cancelling a parked task completes it immediately") {
+        std::atomic<bool> ran{false};
+        auto handle = scheduler.ScheduleAfter(1h, [&ran](const std::stop_token&) { ran = true; });
+        REQUIRE_FALSE(handle.IsDone());
+        handle.Cancel();
+        handle.Wait();
+        REQUIRE_FALSE(ran);
+    }
+
+    SECTION("Running task sees its stop token") {
+        std::atomic<bool> started{false};
+        std::atomic<bool> sawStop{false};
+        auto handle = scheduler.Submit([&](const std::stop_token& stopToken) {
+            started = true;
+            while (!stopToken.stop_requested()) {
+                std::this_thread::sleep_for(1ms);
+            }
+            sawStop = true;
+        });
+        REQUIRE(WaitFor([&] { return started.load(); }));
+        handle.Cancel();
+        handle.Wait();
+        REQUIRE(sawStop);
+    }
+}
+
+TEST_CASE("TaskScheduler shutdown", "[task_scheduler]") {
+    TaskScheduler scheduler(2);
+
+    std::atomic<bool> ran{false};
+    auto parked = scheduler.ScheduleAfter(1h, [&ran](const std::stop_token&) { ran = true; });
+    auto periodic = scheduler.SchedulePeriodic(1ms, [](const std::stop_token&) {});
+
+    scheduler.Shutdown();
+    REQUIRE(parked.IsDone());
+    REQUIRE(periodic.IsDone());
+    REQUIRE_FALSE(ran);
+
+    SECTION("Work submitted after shutdown is cancelled") {
+        auto late = scheduler.Submit([&ran](const std::stop_token&) { ran = true; });
+        REQUIRE(late.IsDone());
+        REQUIRE_FALSE(ran);
+    }
+
+    SECTION("Shutdown is idempotent") {
+        scheduler.Shutdown();
+        REQUIRE(scheduler.GetThreadCount() == 2);
+    }
+}
@@ -0,0 +1,169 @@
+#include "TrackHistory.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory_resource>
+#include <vector>
+
+using namespace MetaImGUI;
+
+namespace {
+// Feed a sinusoidal ground track (roughly one orbit every 90 samples)
+void FillOrbit(TrackHistory& history, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const double phase = static_cast<double>(i) * 0.07;
+        history.Append(std::fmod(static_cast<double>(i) * 4.0, 360.0) - 180.0, 51.6 * std::sin(phase),
+                       static_cast<long>(i));
+    }
+}
+} // namespace
+
+TEST_CASE("TrackHistory stores samples as parallel arrays", "[track_history]") {
+    TrackHistory history(100);
+
+    SECTION("Starts empty") {
+        REQUIRE(history.Empty());
+        REQUIRE(history.GetLevelPointCount(1) == 0);
+    }
+
+    SECTION("Appended samples are kept in order") {
+        history.Append(10.0, 20.0, 1);
+        history.Append(11.0, 21.0, 2);
+
+        REQUIRE(history.Size() == 2);
+        REQUIRE(history.GetLongitudes() == std::vector<double>{10.0, 11.0});
+        REQUIRE(history.GetLatitudes() == std::vector<double>{20.0, 21.0});
+        REQUIRE(history.GetTimestamps() == std::vector<long>{1, 2});
+    }
+
+    SECTION("Oldest samples are dropped beyond capacity") {
+        FillOrbit(history, 1000);
+
+        REQUIRE(history.Size() >= history.GetCapacity());
+        REQUIRE(history.Size() <= history.GetCapacity() + (history.GetCapacity() / 4));
+        REQUIRE(history.GetTimestamps().back() == 999);
+    }
+
+    SECTION("Clear removes everything") {
+        FillOrbit(history, 50);
+        history.Clear();
+        REQUIRE(history.Empty());
+    }
+}
+
+TEST_CASE("TrackHistory level-of-detail pyramid", "[track_history]") {
+    TrackHistory history(20000);
+    FillOrbit(history, 10000);
+
+    SECTION("Level 0 is the raw history") {
+        std::vector<double> lats, lons;
+        history.CopyLevel(0, lats, lons);
+        REQUIRE(lats.size() == 10000);
+        REQUIRE(lons == history.GetLongitudes());
+    }
+
+    SECTION("Each level is no finer than the one below") {
+        // Coarse levels bottom out at the extremes of each antimeridian segment
+        REQUIRE(history.GetLevelPointCount(1) < history.GetLevelPointCount(0));
+        for (size_t level = 2; level < history.GetLevelCount(); ++level) {
+            REQUIRE(history.GetLevelPointCount(level) <= history.GetLevelPointCount(level - 1));
+        }
+    }
+
+    SECTION("Selected level fits the point budget") {
+        const size_t budget = 1600;
+        const size_t level = history.SelectLevel(budget);
+        REQUIRE(level > 0);
+
+        std::vector<double> lats, lons;
+        history.CopyLevel(level, lats, lons);
+        REQUIRE(lats.size() == history.GetLevelPointCount(level));
+        REQUIRE(lats.size() <= budget);
+        REQUIRE(lats.size() == lons.size());
+    }
+
+    SECTION("Small histories are not decimated") {
+        TrackHistory small(1000);
+        FillOrbit(small, 300);
+        REQUIRE(small.SelectLevel(1000) == 0);
+    }
+
+    SECTION("Decimated trail keeps the extremes and the newest sample") {
+        std::vector<double> lats, lons;
+        history.CopyLevel(history.SelectLevel(500), lats, lons);
+
+        const auto& raw = history.GetLatitudes();
+        REQUIRE(*std::max_element(lats.begin(), lats.end()) == *std::max_element(raw.begin(), raw.end()));
+        REQUIRE(*std::min_element(lats.begin(), lats.end()) == *std::min_element(raw.begin(), raw.end()));
+        REQUIRE(lons.back() == history.GetLongitudes().back());
+    }
+}
+
+TEST_CASE("TrackHistory antimeridian segmentation", "[track_history]") {
+    TrackHistory history(20000);
+
+    SECTION("Continuous track is a single segment") {
+        history.Append(-10.0, 0.0, 0);
+        history.Append(0.0, 1.0, 1);
+        history.Append(10.0, 2.0, 2);
+        REQUIRE(history.GetSegmentStarts() == std::vector<size_t>{0});
+    }
+
+    SECTION("Wrapping from +180 to -180 starts a new segment") {
+        history.Append(170.0, 0.0, 0);
+        history.Append(178.0, 1.0, 1);
+        history.Append(-176.0, 2.0, 2);
+        history.Append(-168.0, 3.0, 3);
+        REQUIRE(history.GetSegmentStarts() == std::vector<size_t>{0, 2});
+    }
+
+    SECTION("Decimated segments never bridge a wrap") {
+        FillOrbit(history, 10000);
+
+        for (size_t level = 0; level < history.GetLevelCount(); ++level) {
+            std::vector<double> lats, lons;
+            std::vector<size_t> starts;
+            history.CopyLevel(level, lats, lons, starts);
+
+            REQUIRE_FALSE(starts.empty());
+            REQUIRE(starts.front() == 0);
+            REQUIRE(starts.size() == history.GetSegmentStarts().size());
+            for (size_t segment = 0; segment < starts.size(); ++segment) {
+                const size_t end = (segment + 1 < starts.size()) ? starts[segment + 1] : lons.size();
+                REQUIRE(end > starts[segment]);
+                for (size_t i = starts[segment] + 1; i < end; ++i) {
+                    REQUIRE(std::abs(lons[i] - lons[i - 1]) <= TrackHistory::WRAP_THRESHOLD);
+                }
+            }
+        }
+    }
+
+    SECTION("Polymorphic-allocator copies match") {
+        FillOrbit(history, 10000);
+        std::pmr::monotonic_buffer_resource scratch;
+        for (size_t level = 0; level < history.GetLevelCount(); ++level) {
+            std::vector<double> lats, lons;
+            std::vector<size_t> starts;
+            history.CopyLevel(level, lats, lons, starts);
+
+            std::pmr::vector<double> pmrLats(&scratch), pmrLons(&scratch);
+            std::pmr::vector<size_t> pmrStarts(&scratch);
+            history.CopyLevel(level, pmrLats, pmrLons, pmrStarts);
+
+            REQUIRE(std::equal(lats.begin(), lats.end(), pmrLats.begin(), pmrLats.end()));
+            REQUIRE(std::equal(lons.begin(), lons.end(), pmrLons.begin(), pmrLons.end()));
+            REQUIRE(std::equal(starts.begin(), starts.end(), pmrStarts.begin(), pmrStarts.end()));
+        }
+    }
+
+    SECTION("Segments survive trimming") {
+        TrackHistory small(500);
+        FillOrbit(small, 2000);
+        const auto& starts = small.GetSegmentStarts();
+        REQUIRE(starts.front() == 0);
+        REQUIRE(std::is_sorted(starts.begin(), starts.end()));
+        REQUIRE(starts.back() < small.Size());
+    }
+}
@@ -0,0 +1,99 @@
+#include "TrackReplay.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+
+using namespace MetaImGUI;
+
+TEST_CASE("TrackReplay loads session files", "[track_replay]") {
+    TrackReplay replay;
+
+    SECTION("Captured API responses") {
+        std::istringstream input(
+            R"({"latitude": 10.5, "longitude": -20.25, "altitude": 420.1, "velocity": 27600.0, "timestamp": 1000})"
+            "\n"
+            R"({"latitude": 11.0, "longitude": -19.0, "altitude": 420.2, "velocity": 27600.0, "timestamp": 1001})"
+            "\n");
+        REQUIRE(replay.Load(input));
+        REQUIRE(replay.GetSampleCount() == 2);
+        REQUIRE(replay.GetSample(0).latitude == 10.5);
+        REQUIRE(replay.GetSample(0).longitude == -20.25);
+        REQUIRE(replay.GetSample(1).altitude == 420.2);
+    }
+
+    SECTION("History rows with optional fields") {
+        std::istringstream input("# timestamp,latitude,longitude,altitude,velocity\n"
+                                 "2000,1.5,2.5,410.0,27500.0\n"
+                                 "2001, 1.6, 2.6\r\n");
+        REQUIRE(replay.Load(input));
+        REQUIRE(replay.GetSampleCount() == 2);
+        REQUIRE(replay.GetSample(0).altitude == 410.0);
+        REQUIRE(replay.GetSample(1).longitude == 2.6);
+        REQUIRE(replay.GetSample(1).valid);
+    }
+
+    SECTION("Unreadable and out-of-range lines are skipped") {
+        std::istringstream input("not a sample\n"
+                                 "3000,95.0,0.0\n"
+                                 "3001,1.0\n"
+                                 "{\"latitude\": 1.0}\n"
+                                 "3002,1.0,1.0\n");
+        REQUIRE(replay.Load(input));
+        REQUIRE(replay.GetSampleCount() == 1);
+        REQUIRE(replay.GetStartTime() == 3002);
+    }
+
+    SECTION("Rows with an unrepresentable timestamp or extra fields are skipped") {
+        std::istringstream input("nan,10,20\n"
+                                 "inf,10,20\n"
+                                 "1e300,10,20\n"
+                                 "-1e300,10,20\n"
+                                 "1700000000,1,2,3,4,5,6,junk\n"
+                                 "1700000000,1,2,3,4,\n"
+                                 "1700000001,1,2,3,4 \n");
+        REQUIRE(replay.Load(input));
+        REQUIRE(replay.GetSampleCount() == 1);
+        REQUIRE(replay.GetStartTime() == 1700000001);
+    }
+
+    SECTION("Empty session") {
+        std::istringstream input("\n# nothing here\n");
+        REQUIRE_FALSE(replay.Load(input));
+        REQUIRE(replay.Empty());
+        REQUIRE(replay.GetStartTime() == 0);
+        REQUIRE(replay.GetEndTime() == 0);
+    }
+}
+
+TEST_CASE("TrackReplay indexes samples by time", "[track_replay]") {
+    TrackReplay replay;
+    std::istringstream input("105,5.0,5.0\n"
+                             "100,0.0,0.0\n"
+                             "110,10.0,10.0\n"
+                             "102,2.0,2.0\n");
+    REQUIRE(replay.Load(input));
+
+    SECTION("Samples are sorted by timestamp") {
+        REQUIRE(replay.GetStartTime() == 100);
+        REQUIRE(replay.GetEndTime() == 110);
+        for (size_t i = 1; i < replay.GetSampleCount(); ++i) {
+            REQUIRE(replay.GetSample(i - 1).timestamp <= replay.GetSample(i).timestamp);
+        }
+    }
+
+    SECTION("CountUpTo finds the samples at or before a time") {
+        REQUIRE(replay.CountUpTo(99) == 0);
+        REQUIRE(replay.CountUpTo(100) == 1);
+        REQUIRE(replay.CountUpTo(104) == 2);
+        REQUIRE(replay.CountUpTo(105) == 3);
+        REQUIRE(replay.CountUpTo(1000) == 4);
+    }
+
+    SECTION("Reloading replaces the previous session") {
+        std::istringstream other("500,1.0,1.0\n");
+        REQUIRE(replay.Load(other));
+        REQUIRE(replay.GetSampleCount() == 1);
+        REQUIRE(replay.GetStartTime() == 500);
+    }
+}
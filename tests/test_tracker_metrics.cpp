@@ -0,0 +1,104 @@
+#include "TrackerMetrics.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace MetaImGUI;
+
+TEST_CASE("LatencyHistogram buckets by powers of two", "[tracker_metrics]") {
+    LatencyHistogram histogram;
+
+    SECTION("Empty histogram") {
+        const auto snapshot = histogram.GetSnapshot();
+        REQUIRE(snapshot.count == 0);
+        REQUIRE(snapshot.Mean() == 0.0);
+        REQUIRE(snapshot.Percentile(99.0) == 0);
+    }
+
+    SECTION("Values land in their bit-width bucket") {
+        histogram.Record(0);
+        histogram.Record(1);
+        histogram.Record(5);
+        histogram.Record(7);
+        histogram.Record(8);
+
+        const auto snapshot = histogram.GetSnapshot();
+        REQUIRE(snapshot.buckets[0] == 1);
+        REQUIRE(snapshot.buckets[1] == 1);
+        REQUIRE(snapshot.buckets[3] == 2);
+        REQUIRE(snapshot.buckets[4] == 1);
+        REQUIRE(snapshot.count == 5);
+        REQUIRE(snapshot.sum == 21);
+        REQUIRE(snapshot.max == 8);
+    }
+
+    SECTION("Percentiles report bucket upper bounds capped at the maximum") {
+        for (int i = 0; i < 99; ++i) {
+            histogram.Record(100);
+        }
+        histogram.Record(5000);
+
+        const auto snapshot = histogram.GetSnapshot();
+        REQUIRE(snapshot.Percentile(50.0) == LatencyHistogram::BucketUpperBound(7));
+        REQUIRE(snapshot.Percentile(99.0) == LatencyHistogram::BucketUpperBound(7));
+        REQUIRE(snapshot.Percentile(100.0) == 5000);
+    }
+
+    SECTION("Huge values are kept in the last bucket") {
+        histogram.Record(uint64_t{1} << 40);
+        const auto snapshot = histogram.GetSnapshot();
+        REQUIRE(snapshot.buckets[LatencyHistogram::BUCKET_COUNT - 1] == 1);
+        REQUIRE(snapshot.Percentile(50.0) == (uint64_t{1} << 40));
+    }
+
+    SECTION("Reset clears everything") {
+        histogram.Record(42);
+        histogram.Reset();
+        const auto snapshot = histogram.GetSnapshot();
+        REQUIRE(snapshot.count == 0);
+        REQUIRE(snapshot.max == 0);
+    }
+}
+
+TEST_CASE("LatencyHistogram records concurrently", "[tracker_metrics]") {
+    LatencyHistogram histogram;
+    constexpr int THREADS = 4;
+    constexpr int PER_THREAD = 10000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&histogram, t] {
+            for (int i = 0; i < PER_THREAD; ++i) {
+                histogram.Record(static_cast<uint64_t>((t * PER_THREAD) + i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto snapshot = histogram.GetSnapshot();
+    REQUIRE(snapshot.count == THREADS * PER_THREAD);
+    REQUIRE(snapshot.max == (THREADS * PER_THREAD) - 1);
+}
+
+TEST_CASE("TrackerMetrics snapshot and reset", "[tracker_metrics]") {
+    TrackerMetrics metrics;
+    metrics.fetchLatencyUs.Record(1200);
+    metrics.bytesReceived += 300;
+    metrics.fetchSuccesses += 1;
+    metrics.parseFailures += 1;
+
+    auto snapshot = metrics.GetSnapshot();
+    REQUIRE(snapshot.fetchLatencyUs.count == 1);
+    REQUIRE(snapshot.bytesReceived == 300);
+    REQUIRE(snapshot.fetchSuccesses == 1);
+    REQUIRE(snapshot.parseFailures == 1);
+
+    metrics.Reset();
+    snapshot = metrics.GetSnapshot();
+    REQUIRE(snapshot.fetchLatencyUs.count == 0);
+    REQUIRE(snapshot.bytesReceived == 0);
+}
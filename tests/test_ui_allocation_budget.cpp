@@ -0,0 +1,175 @@
+#include "ActionTable.h"
+#include "AllocationTracker.h"
+#include "ISSDataSource.h"
+#include "ISSTracker.h"
+#include "UIRenderer.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <imgui.h>
+#include <implot.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace MetaImGUI;
+
+namespace {
+// Enough frames for windows, fonts and plot items to settle before measuring
+constexpr int WARMUP_FRAMES = 30;
+constexpr int MEASURED_FRAMES = 120;
+
+// Idle frames must not touch the heap at all
+constexpr uint64_t IDLE_FRAME_ALLOCATION_BUDGET = 0;
+
+// ImGui and ImPlot without a window or GPU; texture requests are completed as a backend would
+class HeadlessImGui {
+public:
+    HeadlessImGui() {
+        ImGui::SetAllocatorFunctions(&AllocationTracker::TrackedMalloc, &AllocationTracker::TrackedFree);
+        ImGui::CreateContext();
+        ImPlot::CreateContext();
+
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = nullptr;
+        io.DisplaySize = ImVec2(1280.0f, 800.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+    }
+
+    ~HeadlessImGui() {
+        ImPlot::DestroyContext();
+        ImGui::DestroyContext();
+    }
+
+    HeadlessImGui(const HeadlessImGui&) = delete;
+    HeadlessImGui& operator=(const HeadlessImGui&) = delete;
+    HeadlessImGui(HeadlessImGui&&) = delete;
+    HeadlessImGui& operator=(HeadlessImGui&&) = delete;
+
+    static void CompleteTextureRequests() {
+        for (ImTextureData* texture : ImGui::GetPlatformIO().Textures) {
+            if (texture->Status == ImTextureStatus_WantCreate || texture->Status == ImTextureStatus_WantUpdates) {
+                texture->SetTexID(static_cast<ImTextureID>(1));
+                texture->SetStatus(ImTextureStatus_OK);
+            } else if (texture->Status == ImTextureStatus_WantDestroy) {
+                texture->SetTexID(ImTextureID_Invalid);
+                texture->SetStatus(ImTextureStatus_Destroyed);
+            }
+        }
+    }
+};
+
+struct UIState {
+    UIRenderer renderer; // Never initialized: no backends, nothing is submitted
+    ActionTable actions;
+    ISSTracker tracker;
+    std::string statusMessage = "Ready";
+    bool showISSTracker = false;
+};
+
+// One frame laid out as Application::Render() does it
+void RenderFrame(UIState& ui) {
+    const AllocationScope scope("Headless frame");
+    ImGui::NewFrame();
+
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(viewport->Pos);
+    ImGui::SetNextWindowSize(viewport->Size);
+    const ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove |
+                                   ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings |
+                                   ImGuiWindowFlags_MenuBar | ImGuiWindowFlags_NoBringToFrontOnFocus;
+    if (ImGui::Begin("MetaImGUI Main", nullptr, flags)) {
+        ui.renderer.RenderMenuBar(ui.actions, false, ui.showISSTracker, false);
+        ui.renderer.RenderMainWindow(ui.actions);
+        ui.renderer.RenderStatusBar(ui.statusMessage, 60.0f, "0.0.0", false);
+    }
+    ImGui::End();
+
+    if (ui.showISSTracker) {
+        ui.renderer.RenderISSTrackerWindow(ui.showISSTracker, &ui.tracker);
+    }
+
+    ui.renderer.EndFrame(false);
+    HeadlessImGui::CompleteTextureRequests();
+}
+
+// Allocations of the last frame made under a scope; unscoped ones (listed first) belong to other threads
+uint64_t ScopedAllocations() {
+    uint64_t allocations = 0;
+    for (const AllocationTracker::ScopeCounts& entry : AllocationTracker::GetLastFrameScopes().subspan(1)) {
+        allocations += entry.counts.allocations;
+    }
+    return allocations;
+}
+
+// Renders warm-up frames, then returns a per-scope report of the worst measured frame
+uint64_t MeasureWorstFrame(UIState& ui, std::string& report) {
+    for (int frame = 0; frame < WARMUP_FRAMES; ++frame) {
+        RenderFrame(ui);
+    }
+
+    uint64_t worst = 0;
+    std::array<AllocationTracker::ScopeCounts, AllocationTracker::MAX_SCOPES> worstScopes{};
+    size_t worstScopeCount = 0;
+    for (int frame = 0; frame < MEASURED_FRAMES; ++frame) {
+        AllocationTracker::EndFrame(); // Drop anything counted between frames
+        RenderFrame(ui);
+        AllocationTracker::EndFrame();
+
+        const uint64_t allocations = ScopedAllocations();
+        if (allocations > worst) {
+            worst = allocations;
+            const auto scopes = AllocationTracker::GetLastFrameScopes();
+            std::copy(scopes.begin(), scopes.end(), worstScopes.begin());
+            worstScopeCount = scopes.size();
+        }
+    }
+
+    for (size_t i = 0; i < worstScopeCount; ++i) {
+        if (worstScopes[i].counts.allocations > 0) {
+            report += std::string(worstScopes[i].name) + ": " + std::to_string(worstScopes[i].counts.allocations) +
+                      " allocations, " + std::to_string(worstScopes[i].counts.bytes) + " bytes\n";
+        }
+    }
+    return worst;
+}
+} // namespace
+
+TEST_CASE("Idle UI frames stay within the allocation budget", "[allocation_budget]") {
+    REQUIRE(AllocationTracker::IsEnabled());
+    HeadlessImGui imgui;
+    std::atomic<int> published{0}; // Outlives the tracker thread that increments it
+    UIState ui;
+
+    // Give the tracker a trail to plot, then leave it idle as after Stop Tracking
+    ui.tracker.SetDataSource(std::make_shared<SyntheticDataSource>(1000.0));
+    ui.tracker.SetPollInterval(std::chrono::milliseconds(0));
+    ui.tracker.StartTracking([&published](const ISSPosition&) { ++published; });
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (published < 300 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ui.tracker.StopTracking();
+    REQUIRE(ui.tracker.GetCurrentPosition().valid);
+
+    std::string report;
+
+    SECTION("Main window, menu bar and status bar") {
+        const uint64_t worst = MeasureWorstFrame(ui, report);
+        INFO("Worst frame:\n" << report);
+        REQUIRE(worst <= IDLE_FRAME_ALLOCATION_BUDGET);
+    }
+
+    SECTION("With the ISS tracker window open") {
+        ui.showISSTracker = true;
+        const uint64_t worst = MeasureWorstFrame(ui, report);
+        INFO("Worst frame:\n" << report);
+        REQUIRE(ui.showISSTracker);
+        REQUIRE(worst <= IDLE_FRAME_ALLOCATION_BUDGET);
+    }
+}
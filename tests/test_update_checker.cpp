@@ -1,9 +1,174 @@
+#include "Sha256.h"
 #include "UpdateChecker.h"
+#include "version.h"
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <bzlib.h>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace MetaImGUI;
 
+namespace {
+#ifdef _WIN32
+const std::string PLATFORM_ASSET = "MetaImGUI-1.2.0-Setup.exe";
+#elif defined(__APPLE__)
+const std::string PLATFORM_ASSET = "MetaImGUI-1.2.0-macos-x64.dmg";
+#else
+const std::string PLATFORM_ASSET = "MetaImGUI-1.2.0-linux-x64.AppImage";
+#endif
+
+std::string FileUrl(const std::filesystem::path& path) {
+    return "file://" + path.generic_string();
+}
+
+std::string ReadFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+void WriteFile(const std::filesystem::path& path, const std::string& contents) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << contents;
+}
+
+std::string AssetContents() {
+    std::string data(300 * 1024, '\0');
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<char>((i * 31) ^ (i >> 7));
+    }
+    return data;
+}
+
+std::string Bzip2(const std::string& data) {
+    std::vector<char> out(data.size() + data.size() / 100 + 600);
+    auto length = static_cast<unsigned int>(out.size());
+    std::string input = data;
+    BZ2_bzBuffToBuffCompress(out.data(), &length, input.data(), static_cast<unsigned int>(input.size()), 9, 0, 0);
+    return {out.data(), length};
+}
+
+void AppendOfftout(std::string& out, uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<char>(value >> (8 * i)));
+    }
+}
+
+// A BSDIFF40 patch with a single control record: diff over the common prefix length, the rest as extra bytes
+std::string MakeDelta(const std::string& oldData, const std::string& newData) {
+    const size_t common = std::min(oldData.size(), newData.size());
+    std::string control;
+    AppendOfftout(control, common);
+    AppendOfftout(control, newData.size() - common);
+    AppendOfftout(control, 0);
+    std::string diff(common, '\0');
+    for (size_t i = 0; i < common; ++i) {
+        diff[i] = static_cast<char>(static_cast<unsigned char>(newData[i]) - static_cast<unsigned char>(oldData[i]));
+    }
+
+    const std::string controlBlock = Bzip2(control);
+    const std::string diffBlock = Bzip2(diff);
+    std::string patch = "BSDIFF40";
+    AppendOfftout(patch, controlBlock.size());
+    AppendOfftout(patch, diffBlock.size());
+    AppendOfftout(patch, newData.size());
+    return patch + controlBlock + diffBlock + Bzip2(newData.substr(common));
+}
+
+#ifndef _WIN32
+// Answers every request with the whole body and a 200, as servers without range support do
+class NoRangeServer {
+public:
+    explicit NoRangeServer(std::string body) : m_body(std::move(body)), m_fd(socket(AF_INET, SOCK_STREAM, 0)) {
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        bind(m_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        listen(m_fd, SOMAXCONN);
+        getsockname(m_fd, reinterpret_cast<sockaddr*>(&address), &length);
+        m_port = ntohs(address.sin_port);
+        m_thread = std::thread([this] { Serve(); });
+    }
+    ~NoRangeServer() {
+        shutdown(m_fd, SHUT_RDWR); // Wakes the blocked accept()
+        m_thread.join();
+        close(m_fd);
+    }
+
+    NoRangeServer(const NoRangeServer&) = delete;
+    NoRangeServer& operator=(const NoRangeServer&) = delete;
+    NoRangeServer(NoRangeServer&&) = delete;
+    NoRangeServer& operator=(NoRangeServer&&) = delete;
+
+    [[nodiscard]] std::string GetUrl() const {
+        return "http://127.0.0.1:" + std::to_string(m_port) + "/asset";
+    }
+
+    [[nodiscard]] int GetRangeRequestCount() const {
+        return m_rangeRequests;
+    }
+
+private:
+    void Serve() {
+        for (;;) {
+            const int client = accept(m_fd, nullptr, nullptr);
+            if (client < 0) {
+                return;
+            }
+            std::string request;
+            std::array<char, 1024> buffer{};
+            while (request.find("\r\n\r\n") == std::string::npos) {
+                const ssize_t count = recv(client, buffer.data(), buffer.size(), 0);
+                if (count <= 0) {
+                    break;
+                }
+                request.append(buffer.data(), static_cast<size_t>(count));
+            }
+            if (request.find("Range:") != std::string::npos) {
+                ++m_rangeRequests;
+            }
+            const std::string response = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(m_body.size()) +
+                                         "\r\nConnection: close\r\n\r\n" + m_body;
+            for (size_t sent = 0; sent < response.size();) {
+                const ssize_t count = send(client, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+                if (count <= 0) {
+                    break;
+                }
+                sent += static_cast<size_t>(count);
+            }
+            close(client);
+        }
+    }
+
+    std::string m_body;
+    int m_fd;
+    uint16_t m_port = 0;
+    std::atomic<int> m_rangeRequests{0};
+    std::thread m_thread;
+};
+#endif
+} // namespace
+
 TEST_CASE("UpdateChecker version comparison", "[version]") {
     SECTION("Equal versions") {
         REQUIRE(UpdateChecker::CompareVersions("1.0.0", "1.0.0") == 0);
@@ -31,6 +196,16 @@ TEST_CASE("UpdateChecker version comparison", "[version]") {
         REQUIRE(UpdateChecker::CompareVersions("1.0", "1.0.0") == 0);
         REQUIRE(UpdateChecker::CompareVersions("1.0.0", "1.0") == 0);
     }
+
+    SECTION("Pre-releases rank below the release") {
+        REQUIRE(UpdateChecker::CompareVersions("1.2.0-rc.1", "1.2.0") < 0);
+        REQUIRE(UpdateChecker::CompareVersions("1.2.0-beta.11", "1.2.0-beta.2") > 0);
+    }
+
+    SECTION("Malformed versions never compare as newer") {
+        REQUIRE(UpdateChecker::CompareVersions("1.0.0", "not-a-version") > 0);
+        REQUIRE(UpdateChecker::CompareVersions("1.0.0", "99999999999999999999.0.0") > 0);
+    }
 }
 
 TEST_CASE("UpdateChecker basic functionality", "[update]") {
@@ -40,6 +215,367 @@ TEST_CASE("UpdateChecker basic functionality", "[update]") {
         REQUIRE_FALSE(checker.IsChecking());
     }
 
+    SECTION("Cancelling a deferred check before it starts skips the request") {
+        std::atomic<bool> called{false};
+        checker.CheckForUpdatesAsync([&called](const UpdateInfo&) { called = true; }, std::chrono::hours(1));
+        REQUIRE(checker.IsChecking());
+
+        checker.Cancel();
+        REQUIRE_FALSE(checker.IsChecking());
+        REQUIRE_FALSE(called);
+    }
+
     // Note: We don't test actual network requests in unit tests
     // Those should be integration tests
 }
+
+TEST_CASE("UpdateChecker selects the release asset for this platform", "[update]") {
+    const std::string release = R"({
+        "tag_name": "v1.2.0",
+        "assets": [
+            {"name": "MetaImGUI-1.2.0-linux-x64.tar.gz", "browser_download_url": "https://dl/linux.tar.gz"},
+            {"name": "MetaImGUI-1.2.0-linux-x64.AppImage.sha256", "browser_download_url": "https://dl/a.sha256"},
+            {"name": "MetaImGUI-1.2.0-linux-x64.AppImage", "browser_download_url": "https://dl/linux.AppImage",
+             "size": 1234, "digest": "sha256:ABCDEF0123456789abcdef0123456789abcdef0123456789abcdef0123456789"},
+            {"name": "MetaImGUI-1.2.0-windows-x64-portable.zip", "browser_download_url": "https://dl/win.zip"},
+            {"name": "MetaImGUI-1.2.0-Setup.exe", "browser_download_url": "https://dl/setup.exe",
+             "size": 1234, "digest": "sha256:ABCDEF0123456789abcdef0123456789abcdef0123456789abcdef0123456789"},
+            {"name": "MetaImGUI-1.2.0-Setup.exe.sha256", "browser_download_url": "https://dl/a.sha256"},
+            {"name": "MetaImGUI-1.2.0-macos-x64.dmg", "browser_download_url": "https://dl/mac.dmg",
+             "size": 1234, "digest": "sha256:ABCDEF0123456789abcdef0123456789abcdef0123456789abcdef0123456789"},
+            {"name": "MetaImGUI-1.2.0-macos-x64.dmg.sha256", "browser_download_url": "https://dl/a.sha256"}
+        ]
+    })";
+
+    const UpdateInfo info = UpdateChecker::ParseReleaseInfo(release);
+    REQUIRE(info.latestVersion == "1.2.0");
+    REQUIRE(info.deltaUrl.empty());
+    REQUIRE(info.downloadName == PLATFORM_ASSET);
+    REQUIRE(info.downloadSize == 1234);
+    REQUIRE(info.downloadSha256 == "abcdef0123456789abcdef0123456789abcdef0123456789abcdef0123456789");
+    REQUIRE(info.checksumUrl == "https://dl/a.sha256");
+
+    SECTION("Releases without a matching asset offer no download") {
+        const UpdateInfo bare = UpdateChecker::ParseReleaseInfo(
+            R"({"tag_name": "v1.2.0", "assets": [{"name": "notes.txt", "browser_download_url": "https://dl/n"}]})");
+        REQUIRE(bare.downloadUrl.empty());
+    }
+
+    SECTION("A delta from the running version is offered alongside the full asset") {
+        const std::string deltaName = PLATFORM_ASSET + ".from-" + Version::VERSION + ".bsdiff";
+        const UpdateInfo delta = UpdateChecker::ParseReleaseInfo(
+            R"({"tag_name": "v1.2.0", "assets": [{"name": ")" + PLATFORM_ASSET +
+            R"(", "browser_download_url": "https://dl/full"}, {"name": ")" + deltaName +
+            R"(", "browser_download_url": "https://dl/delta", "size": 99}, {"name": ")" + deltaName +
+            R"(.sha256", "browser_download_url": "https://dl/delta.sha256"}, {"name": ")" + PLATFORM_ASSET +
+            R"(.from-0.0.1.bsdiff", "browser_download_url": "https://dl/other"}]})");
+        REQUIRE(delta.deltaUrl == "https://dl/delta");
+        REQUIRE(delta.deltaName == deltaName);
+        REQUIRE(delta.deltaSize == 99);
+        REQUIRE(delta.deltaChecksumUrl == "https://dl/delta.sha256");
+    }
+}
+
+TEST_CASE("UpdateChecker selects assets by platform, architecture and package", "[update]") {
+    const std::string release = R"({
+        "tag_name": "v2.0.0",
+        "assets": [
+            {"name": "MetaImGUI-2.0.0-linux-x64.tar.gz", "browser_download_url": "https://dl/x64.tar.gz"},
+            {"name": "MetaImGUI-2.0.0-linux-arm64.AppImage", "browser_download_url": "https://dl/arm64.AppImage"},
+            {"name": "MetaImGUI-2.0.0-linux-arm64.tar.gz", "browser_download_url": "https://dl/arm64.tar.gz"},
+            {"name": "MetaImGUI-2.0.0-windows-arm64-Setup.exe", "browser_download_url": "https://dl/arm64.exe"},
+            {"name": "MetaImGUI-2.0.0-Setup.exe", "browser_download_url": "https://dl/x64.exe"}
+        ]
+    })";
+
+    SECTION("The architecture must match") {
+        const UpdateAssetFilter arm{"linux", "arm64", {UpdatePackage::AppImage, UpdatePackage::Tarball}};
+        REQUIRE(UpdateChecker::ParseReleaseInfo(release, arm).downloadUrl == "https://dl/arm64.AppImage");
+
+        const UpdateAssetFilter x64{"linux", "x64", {UpdatePackage::AppImage, UpdatePackage::Tarball}};
+        REQUIRE(UpdateChecker::ParseReleaseInfo(release, x64).downloadUrl == "https://dl/x64.tar.gz");
+    }
+
+    SECTION("Package preference order is honoured") {
+        const UpdateAssetFilter tarballFirst{"linux", "arm64", {UpdatePackage::Tarball, UpdatePackage::AppImage}};
+        REQUIRE(UpdateChecker::ParseReleaseInfo(release, tarballFirst).downloadUrl == "https://dl/arm64.tar.gz");
+    }
+
+    SECTION("Only x64 falls back to the installer name without an architecture") {
+        const UpdateAssetFilter x64{"windows", "x64", {UpdatePackage::Installer}};
+        REQUIRE(UpdateChecker::ParseReleaseInfo(release, x64).downloadUrl == "https://dl/x64.exe");
+
+        const UpdateAssetFilter arm{"windows", "arm64", {UpdatePackage::Installer}};
+        REQUIRE(UpdateChecker::ParseReleaseInfo(release, arm).downloadUrl == "https://dl/arm64.exe");
+    }
+
+    SECTION("No matching package offers no download") {
+        const UpdateAssetFilter mac{"macos", "x64", {UpdatePackage::DiskImage}};
+        REQUIRE(UpdateChecker::ParseReleaseInfo(release, mac).downloadUrl.empty());
+    }
+}
+
+TEST_CASE("UpdateChecker finds the newest release on a channel", "[update]") {
+    // Newest first, as GitHub lists them
+    const std::string releases = R"([
+        {"tag_name": "v3.0.0", "draft": true, "prerelease": false, "assets": []},
+        {"tag_name": "nightly", "prerelease": true, "assets": []},
+        {"tag_name": "v2.1.0-nightly.20261017", "prerelease": true, "body": "nightly", "assets": []},
+        {"tag_name": "v2.1.0-rc.1", "prerelease": true, "body": "beta", "author": {"login": "a", "id": 1},
+         "assets": [{"name": "MetaImGUI-2.1.0-rc.1-linux-x64.AppImage", "browser_download_url": "https://dl/rc"}]},
+        {"tag_name": "v2.0.0", "prerelease": false, "body": "stable", "assets": []},
+        {"tag_name": "v1.9.0", "prerelease": false, "body": "older", "assets": []}
+    ])";
+
+    SECTION("Each channel takes the first release it includes") {
+        const UpdateAssetFilter filter{"linux", "x64", {UpdatePackage::AppImage}};
+        const auto stable = UpdateChecker::FindRelease(releases, UpdateChannel::Stable, filter);
+        REQUIRE(stable);
+        REQUIRE(stable->latestVersion == "2.0.0");
+        REQUIRE_FALSE(stable->preRelease);
+
+        const auto beta = UpdateChecker::FindRelease(releases, UpdateChannel::Beta, filter);
+        REQUIRE(beta);
+        REQUIRE(beta->latestVersion == "2.1.0-rc.1");
+        REQUIRE(beta->preRelease);
+        REQUIRE(beta->downloadUrl == "https://dl/rc");
+
+        const auto nightly = UpdateChecker::FindRelease(releases, UpdateChannel::Nightly, filter);
+        REQUIRE(nightly);
+        REQUIRE(nightly->releaseNotes == "nightly");
+    }
+
+    SECTION("Parsing stops at the match, so the rest of the page is never read") {
+        const std::string truncated = releases.substr(0, releases.find(R"({"tag_name": "v1.9.0")")) + "{ not json";
+        const auto stable = UpdateChecker::FindRelease(truncated, UpdateChannel::Stable, UpdateAssetFilter{});
+        REQUIRE(stable);
+        REQUIRE(stable->latestVersion == "2.0.0");
+    }
+
+    SECTION("Pages without a match, error objects and malformed lists find nothing") {
+        REQUIRE_FALSE(UpdateChecker::FindRelease(R"([{"tag_name": "v2.0.0-beta.1", "prerelease": true}])",
+                                                 UpdateChannel::Stable, UpdateAssetFilter{}));
+        REQUIRE_FALSE(UpdateChecker::FindRelease("[]", UpdateChannel::Nightly, UpdateAssetFilter{}));
+        REQUIRE_FALSE(UpdateChecker::FindRelease(R"({"message": "API rate limit exceeded"})", UpdateChannel::Stable,
+                                                 UpdateAssetFilter{}));
+        REQUIRE_FALSE(UpdateChecker::FindRelease(R"([{"tag_name": "v2.0.0")", UpdateChannel::Stable,
+                                                 UpdateAssetFilter{}));
+    }
+}
+
+TEST_CASE("UpdateChecker channel names", "[update]") {
+    REQUIRE(ParseUpdateChannel("stable") == UpdateChannel::Stable);
+    REQUIRE(ParseUpdateChannel("Beta") == UpdateChannel::Beta);
+    REQUIRE(ParseUpdateChannel("NIGHTLY") == UpdateChannel::Nightly);
+    REQUIRE_FALSE(ParseUpdateChannel("canary"));
+    REQUIRE_FALSE(ParseUpdateChannel("stab"));
+    REQUIRE(std::string(UpdateChannelName(UpdateChannel::Beta)) == "beta");
+
+    UpdateChecker checker("test-owner", "test-repo");
+    REQUIRE(checker.GetChannel() == UpdateChannel::Stable);
+    checker.SetChannel(UpdateChannel::Nightly);
+    REQUIRE(checker.GetChannel() == UpdateChannel::Nightly);
+}
+
+TEST_CASE("UpdateChecker downloads and verifies release assets", "[update]") {
+    const auto root = std::filesystem::temp_directory_path() / "metaimgui_test_update_download";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "server");
+    const auto downloads = root / "downloads";
+
+    const std::string contents = AssetContents();
+    const auto source = root / "server" / PLATFORM_ASSET;
+    WriteFile(source, contents);
+
+    UpdateInfo info;
+    info.downloadUrl = FileUrl(source);
+    info.downloadName = PLATFORM_ASSET;
+    info.downloadSize = contents.size();
+    info.downloadSha256 = Sha256::HashHex(contents);
+
+    const auto target = downloads / PLATFORM_ASSET;
+    const auto partial = downloads / (PLATFORM_ASSET + ".part");
+
+    UpdateChecker checker("test-owner", "test-repo");
+    uint64_t firstProgress = UINT64_MAX;
+    uint64_t lastProgress = 0;
+    const UpdateDownloadProgress onProgress = [&](uint64_t received, uint64_t total) {
+        REQUIRE(total == contents.size());
+        firstProgress = std::min(firstProgress, received);
+        lastProgress = received;
+    };
+
+    SECTION("A fresh download streams to disk and is verified") {
+        const UpdateDownloadResult result = checker.DownloadUpdateCoro(info, downloads, onProgress).SyncWait();
+        REQUIRE(result.succeeded);
+        REQUIRE(result.file == target);
+        REQUIRE(ReadFile(target) == contents);
+        REQUIRE_FALSE(std::filesystem::exists(partial));
+        REQUIRE(lastProgress == contents.size());
+    }
+
+    SECTION("An interrupted download resumes from the partial file") {
+        std::filesystem::create_directories(downloads);
+        WriteFile(partial, contents.substr(0, 100000));
+
+        const UpdateDownloadResult result = checker.DownloadUpdateCoro(info, downloads, onProgress).SyncWait();
+        REQUIRE(result.succeeded);
+        REQUIRE(ReadFile(target) == contents);
+        REQUIRE(firstProgress == 100000);
+    }
+
+    SECTION("A corrupt partial file is discarded and downloaded again") {
+        std::filesystem::create_directories(downloads);
+        WriteFile(partial, std::string(100000, 'x'));
+
+        const UpdateDownloadResult result = checker.DownloadUpdateCoro(info, downloads, onProgress).SyncWait();
+        REQUIRE(result.succeeded);
+        REQUIRE(ReadFile(target) == contents);
+    }
+
+    SECTION("A checksum mismatch fails and leaves nothing behind") {
+        info.downloadSha256 = Sha256::HashHex("something else");
+        const UpdateDownloadResult result = checker.DownloadUpdateCoro(info, downloads, onProgress).SyncWait();
+        REQUIRE_FALSE(result.succeeded);
+        REQUIRE(result.error.find("Checksum mismatch") != std::string::npos);
+        REQUIRE_FALSE(std::filesystem::exists(target));
+        REQUIRE_FALSE(std::filesystem::exists(partial));
+    }
+
+    SECTION("The checksum can come from a companion .sha256 file") {
+        std::string sidecar = Sha256::HashHex(contents);
+        std::transform(sidecar.begin(), sidecar.end(), sidecar.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+        const auto checksumFile = root / "server" / (PLATFORM_ASSET + ".sha256");
+        WriteFile(checksumFile, sidecar + "  " + PLATFORM_ASSET + "\r\n");
+        info.downloadSha256.clear();
+        info.checksumUrl = FileUrl(checksumFile);
+
+        const UpdateDownloadResult result = checker.DownloadUpdateCoro(info, downloads, onProgress).SyncWait();
+        REQUIRE(result.succeeded);
+    }
+
+    SECTION("Downloads without a published checksum are refused") {
+        info.downloadSha256.clear();
+        const UpdateDownloadResult result = checker.DownloadUpdateCoro(info, downloads, onProgress).SyncWait();
+        REQUIRE_FALSE(result.succeeded);
+        REQUIRE_FALSE(std::filesystem::exists(target));
+    }
+
+    SECTION("Asset names cannot escape the download directory") {
+        info.downloadName = "../escape";
+        const UpdateDownloadResult result = checker.DownloadUpdateCoro(info, downloads, onProgress).SyncWait();
+        REQUIRE_FALSE(result.succeeded);
+    }
+
+    SECTION("Cancelled downloads report cancellation") {
+        std::stop_source stopSource;
+        stopSource.request_stop();
+        const UpdateDownloadResult result =
+            checker.DownloadUpdateCoro(info, downloads, onProgress, stopSource.get_token()).SyncWait();
+        REQUIRE(result.cancelled);
+        REQUIRE_FALSE(result.succeeded);
+    }
+
+#ifndef _WIN32
+    SECTION("Servers that ignore the range restart the download") {
+        NoRangeServer server(contents);
+        info.downloadUrl = server.GetUrl();
+        std::filesystem::create_directories(downloads);
+        WriteFile(partial, contents.substr(0, 1000));
+
+        const UpdateDownloadResult result = checker.DownloadUpdateCoro(info, downloads, onProgress).SyncWait();
+        REQUIRE(result.succeeded);
+        REQUIRE(ReadFile(target) == contents);
+        REQUIRE(server.GetRangeRequestCount() == 1);
+    }
+#endif
+
+    SECTION("Background downloads report completion") {
+        std::atomic<bool> done{false};
+        bool succeeded = false;
+        const bool started =
+            checker.DownloadUpdateAsync(info, downloads, nullptr, [&](const UpdateDownloadResult& result) {
+                succeeded = result.succeeded;
+                done = true;
+            });
+        REQUIRE(started);
+        REQUIRE_FALSE(checker.DownloadUpdateAsync(info, downloads, nullptr, nullptr));
+        while (!done) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        REQUIRE(succeeded);
+        while (checker.IsDownloading()) {
+            std::this_thread::yield();
+        }
+    }
+
+    std::filesystem::remove_all(root);
+}
+
+TEST_CASE("UpdateChecker applies delta updates to the installed asset", "[update]") {
+    const auto root = std::filesystem::temp_directory_path() / "metaimgui_test_update_delta";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "server");
+    const auto downloads = root / "downloads";
+
+    const std::string installedContents = AssetContents();
+    std::string contents = installedContents;
+    for (size_t i = 0; i < contents.size(); i += 4096) {
+        contents[i] = static_cast<char>(contents[i] + 1);
+    }
+    contents += "new in this release";
+
+    const auto installed = root / "installed.AppImage";
+    WriteFile(installed, installedContents);
+    const auto full = root / "server" / PLATFORM_ASSET;
+    WriteFile(full, contents);
+    const std::string deltaName = PLATFORM_ASSET + ".from-" + Version::VERSION + ".bsdiff";
+    const auto delta = root / "server" / deltaName;
+
+    UpdateInfo info;
+    info.downloadUrl = FileUrl(root / "server" / "missing");
+    info.downloadName = PLATFORM_ASSET;
+    info.downloadSize = contents.size();
+    info.downloadSha256 = Sha256::HashHex(contents);
+    info.deltaUrl = FileUrl(delta);
+    info.deltaName = deltaName;
+
+    const auto target = downloads / PLATFORM_ASSET;
+    UpdateChecker checker("test-owner", "test-repo");
+    checker.SetInstalledAsset(installed);
+
+    SECTION("The patched file is verified against the full asset's checksum") {
+        WriteFile(delta, MakeDelta(installedContents, contents));
+        const UpdateDownloadResult result = checker.DownloadUpdateCoro(info, downloads, nullptr).SyncWait();
+        REQUIRE(result.succeeded);
+        REQUIRE(result.file == target);
+        REQUIRE(ReadFile(target) == contents);
+        REQUIRE_FALSE(std::filesystem::exists(downloads / deltaName));
+    }
+
+    SECTION("A delta that does not fit the installed file falls back to the full asset") {
+        WriteFile(delta, MakeDelta(std::string(installedContents.size(), 'x'), contents));
+        info.downloadUrl = FileUrl(full);
+        const UpdateDownloadResult result = checker.DownloadUpdateCoro(info, downloads, nullptr).SyncWait();
+        REQUIRE(result.succeeded);
+        REQUIRE(ReadFile(target) == contents);
+    }
+
+    SECTION("A corrupt delta falls back to the full asset") {
+        WriteFile(delta, "BSDIFF40 but nothing else");
+        info.downloadUrl = FileUrl(full);
+        const UpdateDownloadResult result = checker.DownloadUpdateCoro(info, downloads, nullptr).SyncWait();
+        REQUIRE(result.succeeded);
+        REQUIRE(ReadFile(target) == contents);
+    }
+
+    SECTION("Without an installed asset the delta is not used") {
+        WriteFile(delta, MakeDelta(installedContents, contents));
+        checker.SetInstalledAsset({});
+        const UpdateDownloadResult result = checker.DownloadUpdateCoro(info, downloads, nullptr).SyncWait();
+        REQUIRE_FALSE(result.succeeded);
+    }
+
+    std::filesystem::remove_all(root);
+}